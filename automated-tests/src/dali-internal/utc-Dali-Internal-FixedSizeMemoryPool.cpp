@@ -15,6 +15,8 @@
  *
  */
 
+#include <thread>
+#include <algorithm>
 #include <dali/public-api/dali-core.h>
 #include <dali-test-suite-utils.h>
 
@@ -144,3 +146,101 @@ int UtcDaliFixedSizeMemoryPoolStressTest(void)
 
   END_TEST;
 }
+
+int UtcDaliFixedSizeMemoryPoolThreadSafe(void)
+{
+  const unsigned int numObjects = 64 * 1024;
+
+  Internal::FixedSizeMemoryPool memoryPool( Internal::TypeSizeWithAlignment< TestObject >::size );
+
+  std::vector< void* > freedObjects;
+  freedObjects.reserve( numObjects );
+  for( unsigned int i = 0; i < numObjects; ++i )
+  {
+    freedObjects.push_back( memoryPool.AllocateThreadSafe() );
+  }
+
+  // Free from another thread, while allocating more
+  std::thread freeingThread( [ &memoryPool, &freedObjects ]()
+  {
+    for( auto&& memory : freedObjects )
+    {
+      memoryPool.FreeThreadSafe( memory );
+    }
+  } );
+
+  std::vector< void* > allocatedObjects;
+  allocatedObjects.reserve( numObjects );
+  for( unsigned int i = 0; i < numObjects; ++i )
+  {
+    allocatedObjects.push_back( memoryPool.AllocateThreadSafe() );
+  }
+
+  freeingThread.join();
+
+  // The memory freed once the allocations had run out is recycled before allocating more
+  for( unsigned int i = 0; i < numObjects; ++i )
+  {
+    allocatedObjects.push_back( memoryPool.AllocateThreadSafe() );
+  }
+
+  // No allocation has been handed out twice, and all the freed memory has been recycled
+  std::sort( allocatedObjects.begin(), allocatedObjects.end() );
+  DALI_TEST_CHECK( std::adjacent_find( allocatedObjects.begin(), allocatedObjects.end() ) == allocatedObjects.end() );
+
+  std::sort( freedObjects.begin(), freedObjects.end() );
+  DALI_TEST_CHECK( std::includes( allocatedObjects.begin(), allocatedObjects.end(), freedObjects.begin(), freedObjects.end() ) );
+
+  END_TEST;
+}
+
+int UtcDaliFixedSizeMemoryPoolTrim(void)
+{
+  const unsigned int initialCapacity = 32;
+  Internal::FixedSizeMemoryPool memoryPool( Internal::TypeSizeWithAlignment< TestObject >::size, initialCapacity, 1024 );
+
+  Internal::FixedSizeMemoryPool::Statistics statistics = memoryPool.GetStatistics();
+  DALI_TEST_EQUALS( statistics.fixedSize, static_cast< unsigned int >( Internal::TypeSizeWithAlignment< TestObject >::size ), TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.capacity, initialCapacity, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.liveObjects, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.blockCount, 1u, TEST_LOCATION );
+
+  // Blocks of 32, 64, 128 and 256 allocations
+  std::vector< void* > objects;
+  for( unsigned int i = 0; i < 480; ++i )
+  {
+    objects.push_back( memoryPool.Allocate() );
+  }
+  statistics = memoryPool.GetStatistics();
+  DALI_TEST_EQUALS( statistics.capacity, 480u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.liveObjects, 480u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.blockCount, 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( memoryPool.Trim(), 0u, TEST_LOCATION );
+
+  // Free the allocations of the second and the last block, and one of the third block
+  for( unsigned int i = 32; i < 96; ++i )
+  {
+    memoryPool.Free( objects[i] );
+  }
+  for( unsigned int i = 224; i < 480; ++i )
+  {
+    memoryPool.FreeThreadSafe( objects[i] );
+  }
+  memoryPool.Free( objects[100] );
+  DALI_TEST_EQUALS( memoryPool.GetStatistics().liveObjects, 480u - 64u - 256u - 1u, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( memoryPool.TrimThreadSafe(), 2u, TEST_LOCATION );
+  statistics = memoryPool.GetStatistics();
+  DALI_TEST_EQUALS( statistics.capacity, 32u + 128u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.liveObjects, 480u - 64u - 256u - 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.blockCount, 2u, TEST_LOCATION );
+
+  // The freed allocation of the remaining block is recycled first, then a new block is added
+  DALI_TEST_CHECK( memoryPool.Allocate() == objects[100] );
+  memoryPool.Allocate();
+  statistics = memoryPool.GetStatistics();
+  DALI_TEST_EQUALS( statistics.capacity, 32u + 128u + 256u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.blockCount, 3u, TEST_LOCATION );
+
+  END_TEST;
+}
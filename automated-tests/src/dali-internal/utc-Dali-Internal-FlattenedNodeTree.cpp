@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <vector>
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/update/nodes/flattened-node-tree.h>
+#include <dali/internal/update/nodes/node.h>
+
+using namespace Dali;
+using Internal::SceneGraph::FlattenedNodeTree;
+using Internal::SceneGraph::Node;
+
+void utc_dali_internal_flattenednodetree_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_flattenednodetree_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+/**
+ * Creates the nodes of a test and deletes them when the test ends.
+ */
+struct TestNodes
+{
+  ~TestNodes()
+  {
+    for( auto&& node : nodes )
+    {
+      Node::Delete( node );
+    }
+  }
+
+  Node* New()
+  {
+    nodes.push_back( Node::New() );
+    return nodes.back();
+  }
+
+  std::vector< Node* > nodes;
+};
+
+void Connect( FlattenedNodeTree& tree, Node& parent, Node& child )
+{
+  parent.ConnectChild( &child );
+  tree.NodeConnected( child );
+}
+
+void Disconnect( FlattenedNodeTree& tree, Node& child )
+{
+  tree.NodeDisconnected( child );
+  child.GetParent()->DisconnectChild( 0u, child );
+}
+
+void CollectDepthFirst( Node& node, uint32_t depth, std::vector< std::pair< Node*, uint32_t > >& nodes )
+{
+  nodes.push_back( std::make_pair( &node, depth ) );
+  for( auto&& child : node.GetChildren() )
+  {
+    CollectDepthFirst( *child, depth + 1u, nodes );
+  }
+}
+
+uint32_t CountDescendants( Node& node )
+{
+  uint32_t count = 0u;
+  for( auto&& child : node.GetChildren() )
+  {
+    count += 1u + CountDescendants( *child );
+  }
+  return count;
+}
+
+/**
+ * Checks the entries of the tree, skipping the gaps, match a recursive traversal of the scene-graph.
+ */
+bool MatchesSceneGraph( const FlattenedNodeTree& tree, Node& root )
+{
+  std::vector< std::pair< Node*, uint32_t > > expected;
+  CollectDepthFirst( root, 0u, expected );
+
+  std::vector< std::pair< Node*, uint32_t > > actual;
+  for( uint32_t i = 0u; i < tree.Count(); ++i )
+  {
+    const FlattenedNodeTree::Entry& entry = tree[i];
+    if( entry.node )
+    {
+      uint32_t index = 0u;
+      if( !tree.FindNode( *entry.node, index ) || index != i )
+      {
+        return false;
+      }
+
+      // The subtree of the entry contains exactly the descendants of the node
+      uint32_t descendants = 0u;
+      for( uint32_t j = i + 1u; j < i + entry.subtreeSize; ++j )
+      {
+        descendants += tree[j].node ? 1u : 0u;
+      }
+      if( descendants != CountDescendants( *entry.node ) )
+      {
+        return false;
+      }
+
+      actual.push_back( std::make_pair( entry.node, entry.depth ) );
+    }
+  }
+
+  return actual == expected;
+}
+
+} // anonymous namespace
+
+int UtcDaliFlattenedNodeTreeAppend(void)
+{
+  TestApplication application;
+
+  TestNodes nodes;
+  Node* root = nodes.New();
+  root->SetRoot( true );
+
+  FlattenedNodeTree tree( *root );
+  tree.Update();
+  DALI_TEST_EQUALS( tree.Count(), 1u, TEST_LOCATION );
+
+  // The connected nodes are only added in the next update
+  Node* parent = nodes.New();
+  Connect( tree, *root, *parent );
+  for( uint32_t i = 0u; i < 3u; ++i )
+  {
+    Node* child = nodes.New();
+    Connect( tree, *parent, *child );
+    Connect( tree, *child, *nodes.New() );
+  }
+  Connect( tree, *root, *nodes.New() );
+  DALI_TEST_EQUALS( tree.Count(), 1u, TEST_LOCATION );
+
+  tree.Update();
+  DALI_TEST_EQUALS( tree.Count(), 9u, TEST_LOCATION );
+  DALI_TEST_CHECK( MatchesSceneGraph( tree, *root ) );
+
+  // Building the scene-graph depth first only appends entries
+  Node* last = nodes.New();
+  Connect( tree, *root, *last );
+  Connect( tree, *last, *nodes.New() );
+  tree.Update();
+  DALI_TEST_EQUALS( tree.Count(), 11u, TEST_LOCATION );
+  DALI_TEST_CHECK( MatchesSceneGraph( tree, *root ) );
+
+  END_TEST;
+}
+
+int UtcDaliFlattenedNodeTreeConnectInTheMiddle(void)
+{
+  TestApplication application;
+
+  TestNodes nodes;
+  Node* root = nodes.New();
+  root->SetRoot( true );
+
+  FlattenedNodeTree tree( *root );
+  tree.Update();
+
+  Node* first = nodes.New();
+  Connect( tree, *root, *first );
+  Connect( tree, *root, *nodes.New() );
+  tree.Update();
+  DALI_TEST_CHECK( MatchesSceneGraph( tree, *root ) );
+
+  // The subtree of the first child isn't at the end any more
+  Node* child = nodes.New();
+  Connect( tree, *first, *child );
+  tree.Update();
+  DALI_TEST_EQUALS( tree.Count(), 4u, TEST_LOCATION );
+  DALI_TEST_CHECK( MatchesSceneGraph( tree, *root ) );
+
+  uint32_t index = 0u;
+  DALI_TEST_CHECK( tree.FindNode( *child, index ) );
+  DALI_TEST_EQUALS( index, 2u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliFlattenedNodeTreeDisconnect(void)
+{
+  TestApplication application;
+
+  TestNodes nodes;
+  Node* root = nodes.New();
+  root->SetRoot( true );
+
+  FlattenedNodeTree tree( *root );
+
+  std::vector< Node* > children;
+  for( uint32_t i = 0u; i < 4u; ++i )
+  {
+    children.push_back( nodes.New() );
+    root->ConnectChild( children.back() );
+    root->GetChildren()[i]->ConnectChild( nodes.New() );
+  }
+  tree.Update();
+  DALI_TEST_EQUALS( tree.Count(), 9u, TEST_LOCATION );
+  DALI_TEST_CHECK( MatchesSceneGraph( tree, *root ) );
+
+  // A disconnected subtree leaves a gap
+  Disconnect( tree, *children[1] );
+  tree.Update();
+  DALI_TEST_EQUALS( tree.Count(), 9u, TEST_LOCATION );
+  DALI_TEST_CHECK( MatchesSceneGraph( tree, *root ) );
+
+  uint32_t index = 0u;
+  DALI_TEST_CHECK( !tree.FindNode( *children[1], index ) );
+  DALI_TEST_CHECK( tree.FindNode( *children[2], index ) );
+  DALI_TEST_EQUALS( index, 5u, TEST_LOCATION );
+
+  // Nodes can't be appended to a subtree followed by a gap
+  Connect( tree, *children[0], *nodes.New() );
+  tree.Update();
+  DALI_TEST_EQUALS( tree.Count(), 8u, TEST_LOCATION );
+  DALI_TEST_CHECK( MatchesSceneGraph( tree, *root ) );
+
+  Disconnect( tree, *children[2] );
+  Disconnect( tree, *children[3] );
+  tree.Update();
+  DALI_TEST_EQUALS( tree.Count(), 8u, TEST_LOCATION );
+  DALI_TEST_CHECK( MatchesSceneGraph( tree, *root ) );
+
+  // The entries are compacted once the gaps exceed half of them
+  Disconnect( tree, *children[0] );
+  tree.Update();
+  DALI_TEST_EQUALS( tree.Count(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( MatchesSceneGraph( tree, *root ) );
+
+  END_TEST;
+}
+
+int UtcDaliFlattenedNodeTreeConnectIntoGap(void)
+{
+  TestApplication application;
+
+  TestNodes nodes;
+  Node* root = nodes.New();
+  root->SetRoot( true );
+
+  FlattenedNodeTree tree( *root );
+
+  Node* parent = nodes.New();
+  root->ConnectChild( parent );
+  root->ConnectChild( nodes.New() );
+  parent->ConnectChild( nodes.New() );
+  Node* removed = nodes.New();
+  parent->ConnectChild( removed );
+  removed->ConnectChild( nodes.New() );
+  removed->ConnectChild( nodes.New() );
+  tree.Update();
+  DALI_TEST_EQUALS( tree.Count(), 7u, TEST_LOCATION );
+  DALI_TEST_CHECK( MatchesSceneGraph( tree, *root ) );
+
+  // The last child of the parent leaves a gap of three entries
+  Disconnect( tree, *removed );
+  tree.Update();
+
+  // A new last child is written into the start of the gap
+  Node* first = nodes.New();
+  Connect( tree, *parent, *first );
+  Connect( tree, *first, *nodes.New() );
+  tree.Update();
+  DALI_TEST_EQUALS( tree.Count(), 7u, TEST_LOCATION );
+  DALI_TEST_CHECK( MatchesSceneGraph( tree, *root ) );
+
+  uint32_t index = 0u;
+  DALI_TEST_CHECK( tree.FindNode( *first, index ) );
+  DALI_TEST_EQUALS( index, 3u, TEST_LOCATION );
+
+  // The rest of the gap is still skipped, and takes the next child
+  Node* second = nodes.New();
+  Connect( tree, *parent, *second );
+  tree.Update();
+  DALI_TEST_EQUALS( tree.Count(), 7u, TEST_LOCATION );
+  DALI_TEST_CHECK( MatchesSceneGraph( tree, *root ) );
+  DALI_TEST_CHECK( tree.FindNode( *second, index ) );
+  DALI_TEST_EQUALS( index, 5u, TEST_LOCATION );
+
+  // Without a gap left, the entries are rebuilt
+  Connect( tree, *parent, *nodes.New() );
+  tree.Update();
+  DALI_TEST_EQUALS( tree.Count(), 8u, TEST_LOCATION );
+  DALI_TEST_CHECK( MatchesSceneGraph( tree, *root ) );
+
+  END_TEST;
+}
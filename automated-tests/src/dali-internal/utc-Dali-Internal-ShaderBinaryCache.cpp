@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <thread>
+
+#include <dali/public-api/dali-core.h>
+#include <dali-test-suite-utils.h>
+#include <test-platform-abstraction.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/event/effects/shader-binary-cache.h>
+
+using namespace Dali;
+
+void utc_dali_internal_shaderbinarycache_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_shaderbinarycache_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const char* ARCHIVE_FILENAME = "test-shaders.dali-bin";
+
+Dali::Vector< uint8_t > CreateBinary( uint32_t size, uint8_t value )
+{
+  Dali::Vector< uint8_t > binary;
+  binary.Resize( size, value );
+  return binary;
+}
+
+} // namespace
+
+int UtcDaliShaderBinaryCacheFindInserted(void)
+{
+  TestPlatformAbstraction platform;
+
+  Internal::ShaderBinaryCache cache( platform, ARCHIVE_FILENAME );
+
+  Dali::Vector< uint8_t > binary;
+  DALI_TEST_CHECK( !cache.Find( 1u, binary ) );
+  DALI_TEST_EQUALS( cache.GetDriverIdentity(), 0u, TEST_LOCATION );
+
+  cache.SetDriverIdentity( 42u );
+  cache.Insert( 1u, CreateBinary( 16u, 1u ) );
+  cache.Insert( 2u, CreateBinary( 32u, 2u ) );
+  DALI_TEST_CHECK( cache.Find( 2u, binary ) );
+  DALI_TEST_EQUALS( binary.Count(), 32u, TEST_LOCATION );
+  DALI_TEST_EQUALS( binary[0], 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.GetDriverIdentity(), 42u, TEST_LOCATION );
+
+  // Replacing a binary
+  cache.Insert( 2u, CreateBinary( 8u, 3u ) );
+  DALI_TEST_CHECK( cache.Find( 2u, binary ) );
+  DALI_TEST_EQUALS( binary.Count(), 8u, TEST_LOCATION );
+  DALI_TEST_EQUALS( binary[0], 3u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCacheSaveAndPreload(void)
+{
+  TestPlatformAbstraction platform;
+
+  {
+    Internal::ShaderBinaryCache cache( platform, ARCHIVE_FILENAME );
+    cache.SetDriverIdentity( 42u );
+    cache.Insert( 1u, CreateBinary( 16u, 1u ) );
+    cache.Insert( 2u, CreateBinary( 32u, 2u ) );
+
+    platform.ResetTrace();
+    cache.Save();
+    cache.WaitForSave();
+    DALI_TEST_CHECK( platform.WasCalled( TestPlatformAbstraction::SaveShaderBinaryFileFunc ) );
+
+    // Nothing has changed since the archive was saved
+    platform.ResetTrace();
+    cache.Save();
+    cache.WaitForSave();
+    DALI_TEST_CHECK( !platform.WasCalled( TestPlatformAbstraction::SaveShaderBinaryFileFunc ) );
+  }
+
+  Dali::Vector< uint8_t > archive = platform.GetSavedFile();
+  platform.SetLoadFileResult( true, archive );
+
+  Internal::ShaderBinaryCache cache( platform, ARCHIVE_FILENAME );
+  DALI_TEST_EQUALS( cache.GetDriverIdentity(), 42u, TEST_LOCATION );
+
+  Dali::Vector< uint8_t > binary;
+  DALI_TEST_CHECK( cache.Find( 1u, binary ) );
+  DALI_TEST_EQUALS( binary.Count(), 16u, TEST_LOCATION );
+  DALI_TEST_EQUALS( binary[15], 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( cache.Find( 2u, binary ) );
+  DALI_TEST_EQUALS( binary.Count(), 32u, TEST_LOCATION );
+  DALI_TEST_EQUALS( binary[31], 2u, TEST_LOCATION );
+  DALI_TEST_CHECK( !cache.Find( 3u, binary ) );
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCacheArchiveOfAnotherDriver(void)
+{
+  TestPlatformAbstraction platform;
+
+  {
+    Internal::ShaderBinaryCache cache( platform, ARCHIVE_FILENAME );
+    cache.SetDriverIdentity( 42u );
+    cache.Insert( 1u, CreateBinary( 16u, 1u ) );
+  }
+
+  Dali::Vector< uint8_t > archive = platform.GetSavedFile();
+  platform.SetLoadFileResult( true, archive );
+
+  {
+    // The binaries are kept for the driver which compiled them
+    Internal::ShaderBinaryCache cache( platform, ARCHIVE_FILENAME );
+    cache.SetDriverIdentity( 42u );
+
+    Dali::Vector< uint8_t > binary;
+    DALI_TEST_CHECK( cache.Find( 1u, binary ) );
+    DALI_TEST_EQUALS( cache.GetDriverIdentity(), 42u, TEST_LOCATION );
+  }
+
+  // The whole archive is discarded once another driver is known to be used, and the file is rewritten without it
+  Internal::ShaderBinaryCache cache( platform, ARCHIVE_FILENAME );
+  DALI_TEST_EQUALS( cache.GetDriverIdentity(), 42u, TEST_LOCATION );
+  cache.SetDriverIdentity( 43u );
+
+  Dali::Vector< uint8_t > binary;
+  DALI_TEST_CHECK( !cache.Find( 1u, binary ) );
+  DALI_TEST_EQUALS( cache.GetDriverIdentity(), 43u, TEST_LOCATION );
+
+  platform.ResetTrace();
+  cache.Save();
+  cache.WaitForSave();
+  DALI_TEST_CHECK( platform.WasCalled( TestPlatformAbstraction::SaveShaderBinaryFileFunc ) );
+  DALI_TEST_CHECK( platform.GetSavedFile().Count() < archive.Count() );
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCacheDamagedArchive(void)
+{
+  TestPlatformAbstraction platform;
+
+  {
+    Internal::ShaderBinaryCache cache( platform, ARCHIVE_FILENAME );
+    cache.Insert( 1u, CreateBinary( 16u, 1u ) );
+  }
+
+  // A truncated archive is discarded
+  Dali::Vector< uint8_t > archive = platform.GetSavedFile();
+  archive.Resize( archive.Count() - 1u );
+  platform.SetLoadFileResult( true, archive );
+
+  Internal::ShaderBinaryCache cache( platform, ARCHIVE_FILENAME );
+  Dali::Vector< uint8_t > binary;
+  DALI_TEST_CHECK( !cache.Find( 1u, binary ) );
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCacheEvictsLeastRecentlyUsed(void)
+{
+  TestPlatformAbstraction platform;
+
+  Internal::ShaderBinaryCache cache( platform, ARCHIVE_FILENAME );
+
+  // Fill the cache to its maximum size of 8MB
+  const uint32_t binarySize = 1u << 20u;
+  for( uint64_t key = 1u; key <= 8u; ++key )
+  {
+    cache.Insert( key, CreateBinary( binarySize, 0u ) );
+  }
+
+  // Use the first binary, so the second is the least recently used one
+  Dali::Vector< uint8_t > binary;
+  DALI_TEST_CHECK( cache.Find( 1u, binary ) );
+
+  cache.Insert( 9u, CreateBinary( binarySize, 0u ) );
+  DALI_TEST_CHECK( !cache.Find( 2u, binary ) );
+  DALI_TEST_CHECK( cache.Find( 1u, binary ) );
+  DALI_TEST_CHECK( cache.Find( 3u, binary ) );
+  DALI_TEST_CHECK( cache.Find( 9u, binary ) );
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCacheFileOnCallingThread(void)
+{
+  TestPlatformAbstraction platform;
+
+  {
+    Internal::ShaderBinaryCache cache( platform, ARCHIVE_FILENAME );
+    cache.Insert( 1u, CreateBinary( 16u, 1u ) );
+  }
+  Dali::Vector< uint8_t > archive = platform.GetSavedFile();
+  platform.SetLoadFileResult( true, archive );
+
+  // By default the platform abstraction is only called from the thread using the cache
+  Internal::ShaderBinaryCache cache( platform, ARCHIVE_FILENAME );
+  DALI_TEST_CHECK( platform.WasCalled( TestPlatformAbstraction::LoadShaderBinaryFileFunc ) );
+  DALI_TEST_CHECK( platform.GetShaderBinaryFileThread() == std::this_thread::get_id() );
+
+  Dali::Vector< uint8_t > binary;
+  DALI_TEST_CHECK( cache.Find( 1u, binary ) );
+
+  platform.ResetTrace();
+  cache.Insert( 2u, CreateBinary( 16u, 2u ) );
+  cache.Save();
+  DALI_TEST_CHECK( platform.WasCalled( TestPlatformAbstraction::SaveShaderBinaryFileFunc ) );
+  DALI_TEST_CHECK( platform.GetShaderBinaryFileThread() == std::this_thread::get_id() );
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCacheFileOnOtherThreads(void)
+{
+  TestPlatformAbstraction platform;
+  platform.SetShaderBinaryFileThreadSafe( true );
+
+  {
+    Internal::ShaderBinaryCache cache( platform, ARCHIVE_FILENAME );
+    cache.Insert( 1u, CreateBinary( 16u, 1u ) );
+  }
+  DALI_TEST_CHECK( platform.GetShaderBinaryFileThread() != std::this_thread::get_id() );
+
+  Dali::Vector< uint8_t > archive = platform.GetSavedFile();
+  platform.SetLoadFileResult( true, archive );
+
+  // The file is read and written by the threads of the cache
+  Internal::ShaderBinaryCache cache( platform, ARCHIVE_FILENAME );
+  Dali::Vector< uint8_t > binary;
+  DALI_TEST_CHECK( cache.Find( 1u, binary ) );
+  DALI_TEST_CHECK( platform.WasCalled( TestPlatformAbstraction::LoadShaderBinaryFileFunc ) );
+  DALI_TEST_CHECK( platform.GetShaderBinaryFileThread() != std::this_thread::get_id() );
+
+  END_TEST;
+}
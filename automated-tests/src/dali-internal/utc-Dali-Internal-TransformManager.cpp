@@ -0,0 +1,468 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <dali/public-api/dali-core.h>
+#include <dali/devel-api/threading/thread-pool.h>
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/update/manager/transform-kernels.h>
+#include <dali/internal/update/manager/transform-manager.h>
+
+using namespace Dali;
+using Internal::SceneGraph::TransformManager;
+using Internal::SceneGraph::TransformId;
+namespace TransformKernels = Internal::SceneGraph::TransformKernels;
+
+void utc_dali_internal_transformmanager_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_transformmanager_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+
+const uint32_t CHILDREN_PER_COMPONENT = 4u;
+
+/**
+ * Pseudo random number generator so both managers get the same values.
+ */
+struct TestRandom
+{
+  uint32_t seed = 12345u;
+
+  float Next( float min, float max )
+  {
+    seed = seed * 1103515245u + 12345u;
+    return min + ( max - min ) * static_cast<float>( ( seed >> 8 ) & 0xFFFF ) / 65535.0f;
+  }
+};
+
+/**
+ * Creates a tree of componentCount transforms in which every component has CHILDREN_PER_COMPONENT children.
+ * Components are created in reverse order, and some do not inherit all of the parent's transform, so both
+ * the reordering and all the update paths are exercised.
+ */
+void CreateHierarchy( TransformManager& manager, std::vector< TransformId >& ids, uint32_t componentCount )
+{
+  TestRandom random;
+
+  ids.resize( componentCount );
+  for( uint32_t i = componentCount; i > 0u; --i )
+  {
+    ids[i - 1u] = manager.CreateTransform();
+  }
+
+  for( uint32_t i = 0u; i < componentCount; ++i )
+  {
+    const TransformId id = ids[i];
+    if( i > 0u )
+    {
+      manager.SetParent( id, ids[( i - 1u ) / CHILDREN_PER_COMPONENT] );
+    }
+
+    manager.BakeVector3PropertyValue( id, Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION, Vector3( random.Next( -10.0f, 10.0f ), random.Next( -10.0f, 10.0f ), random.Next( -1.0f, 1.0f ) ) );
+    manager.BakeVector3PropertyValue( id, Internal::SceneGraph::TRANSFORM_PROPERTY_SCALE, Vector3( random.Next( 0.9f, 1.1f ), random.Next( 0.9f, 1.1f ), 1.0f ) );
+    manager.BakeVector3PropertyValue( id, Internal::SceneGraph::TRANSFORM_PROPERTY_SIZE, Vector3( random.Next( 1.0f, 100.0f ), random.Next( 1.0f, 100.0f ), 0.0f ) );
+    manager.BakeQuaternionPropertyValue( id, Quaternion( Radian( random.Next( -0.1f, 0.1f ) ), Vector3::ZAXIS ) );
+
+    if( i % 97u == 0u )
+    {
+      manager.SetInheritScale( id, false );
+    }
+    if( i % 101u == 0u )
+    {
+      manager.SetInheritOrientation( id, false );
+    }
+  }
+}
+
+bool CompareManagers( const TransformManager& lhs, const TransformManager& rhs, const std::vector< TransformId >& lhsIds, const std::vector< TransformId >& rhsIds )
+{
+  for( uint32_t i = 0u; i < lhsIds.size(); ++i )
+  {
+    // The results must be bit-identical
+    if( memcmp( lhs.GetWorldMatrix( lhsIds[i] ).AsFloat(), rhs.GetWorldMatrix( rhsIds[i] ).AsFloat(), sizeof( float ) * 16u ) != 0 ||
+        memcmp( lhs.GetBoundingSphere( lhsIds[i] ).AsFloat(), rhs.GetBoundingSphere( rhsIds[i] ).AsFloat(), sizeof( float ) * 4u ) != 0 )
+    {
+      tet_printf( "Component %u differs\n", i );
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+int UtcDaliTransformManagerParallelUpdateMatchesSerial(void)
+{
+  tet_infoline( "Ensure the parallel update produces exactly the same results as the serial update" );
+
+  const uint32_t componentCount = 20000u;
+
+  TransformManager serialManager;
+  TransformManager parallelManager;
+  std::vector< TransformId > serialIds;
+  std::vector< TransformId > parallelIds;
+
+  CreateHierarchy( serialManager, serialIds, componentCount );
+  CreateHierarchy( parallelManager, parallelIds, componentCount );
+
+  ThreadPool threadPool;
+  threadPool.Initialize( 3u );
+  parallelManager.SetThreadPool( &threadPool );
+
+  serialManager.Update();
+  parallelManager.Update();
+  DALI_TEST_CHECK( CompareManagers( serialManager, parallelManager, serialIds, parallelIds ) );
+
+  // Reparent a subtree and remove a component, then update again
+  serialManager.SetParent( serialIds[10], serialIds[componentCount - 1u] );
+  parallelManager.SetParent( parallelIds[10], parallelIds[componentCount - 1u] );
+  serialManager.RemoveTransform( serialIds[componentCount - 2u] );
+  parallelManager.RemoveTransform( parallelIds[componentCount - 2u] );
+  serialIds.erase( serialIds.end() - 2 );
+  parallelIds.erase( parallelIds.end() - 2 );
+
+  serialManager.Update();
+  parallelManager.Update();
+  DALI_TEST_CHECK( CompareManagers( serialManager, parallelManager, serialIds, parallelIds ) );
+
+  // Components created after the last reorder
+  serialIds.push_back( serialManager.CreateTransform() );
+  parallelIds.push_back( parallelManager.CreateTransform() );
+  serialManager.SetVector3PropertyValue( serialIds.back(), Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION, Vector3( 1.0f, 2.0f, 3.0f ) );
+  parallelManager.SetVector3PropertyValue( parallelIds.back(), Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION, Vector3( 1.0f, 2.0f, 3.0f ) );
+
+  serialManager.Update();
+  parallelManager.Update();
+  DALI_TEST_CHECK( CompareManagers( serialManager, parallelManager, serialIds, parallelIds ) );
+
+  parallelManager.SetThreadPool( nullptr );
+
+  END_TEST;
+}
+
+int UtcDaliTransformKernelsMatchMatrix(void)
+{
+  tet_infoline( "Ensure the batched transform kernels give the same results as the Matrix methods" );
+
+  TestRandom random;
+  const uint32_t batchSize = TransformKernels::BATCH_SIZE;
+
+  Vector3 scales[batchSize];
+  Quaternion orientations[batchSize];
+  Vector3 positions[batchSize];
+  Matrix expected[batchSize];
+  Matrix results[batchSize];
+
+  Matrix* resultPointers[batchSize];
+  const Vector3* scalePointers[batchSize];
+  const Quaternion* orientationPointers[batchSize];
+
+  for( uint32_t i = 0u; i < batchSize; ++i )
+  {
+    scales[i] = Vector3( random.Next( 0.5f, 2.0f ), random.Next( 0.5f, 2.0f ), random.Next( 0.5f, 2.0f ) );
+    positions[i] = Vector3( random.Next( -100.0f, 100.0f ), random.Next( -100.0f, 100.0f ), random.Next( -100.0f, 100.0f ) );
+    // Keep one identity orientation to check the identity path
+    orientations[i] = ( i == 1u ) ? Quaternion::IDENTITY : Quaternion( Radian( random.Next( -3.0f, 3.0f ) ), Vector3( random.Next( -1.0f, 1.0f ), random.Next( -1.0f, 1.0f ), 1.0f ) );
+
+    expected[i].SetTransformComponents( scales[i], orientations[i], positions[i] );
+
+    resultPointers[i] = &results[i];
+    scalePointers[i] = &scales[i];
+    orientationPointers[i] = &orientations[i];
+  }
+
+  TransformKernels::ComposeTransforms( resultPointers, scalePointers, orientationPointers, positions );
+  for( uint32_t i = 0u; i < batchSize; ++i )
+  {
+    DALI_TEST_CHECK( memcmp( expected[i].AsFloat(), results[i].AsFloat(), sizeof( float ) * 16u ) == 0 );
+  }
+
+  Matrix expectedProduct;
+  Matrix product;
+  Matrix::Multiply( expectedProduct, expected[0], expected[2] );
+  TransformKernels::Multiply( product, expected[0], expected[2] );
+  DALI_TEST_CHECK( memcmp( expectedProduct.AsFloat(), product.AsFloat(), sizeof( float ) * 16u ) == 0 );
+
+  // Odd count so both the batched and the remaining spheres are computed
+  const uint32_t sphereCount = batchSize + 1u;
+  Matrix worlds[sphereCount];
+  Vector3 sizes[sphereCount];
+  Vector4 spheres[sphereCount];
+  for( uint32_t i = 0u; i < sphereCount; ++i )
+  {
+    worlds[i] = expected[i % batchSize];
+    sizes[i] = Vector3( random.Next( 1.0f, 100.0f ), random.Next( 1.0f, 100.0f ), 0.0f );
+  }
+
+  TransformKernels::ComputeBoundingSpheres( spheres, worlds, sizes, sphereCount );
+  for( uint32_t i = 0u; i < sphereCount; ++i )
+  {
+    const Vector4 radiusVector = worlds[i] * Vector4( sizes[i].Length() * 0.5f, 0.0f, 0.0f, 0.0f );
+    DALI_TEST_EQUALS( Vector3( spheres[i] ), worlds[i].GetTranslation3(), TEST_LOCATION );
+    DALI_TEST_EQUALS( spheres[i].w, Vector3( radiusVector ).Length(), Math::MACHINE_EPSILON_100, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliTransformKernelsMatchFrustumCheck(void)
+{
+  tet_infoline( "Ensure the batched frustum check gives the same results as checking each sphere against each plane" );
+
+  TestRandom random;
+
+  // An axis aligned box from -100 to 100, with normals pointing inside
+  Vector4 planes[TransformKernels::FRUSTUM_PLANE_COUNT] =
+  {
+    Vector4( 1.0f, 0.0f, 0.0f, 100.0f ), Vector4( -1.0f, 0.0f, 0.0f, 100.0f ),
+    Vector4( 0.0f, 1.0f, 0.0f, 100.0f ), Vector4( 0.0f, -1.0f, 0.0f, 100.0f ),
+    Vector4( 0.0f, 0.0f, 1.0f, 100.0f ), Vector4( 0.0f, 0.0f, -1.0f, 100.0f )
+  };
+
+  // Not a multiple of the batch size, so both the batched and the remaining spheres are checked
+  const uint32_t sphereCount = TransformKernels::BATCH_SIZE * 16u + 3u;
+  std::vector< Vector4 > spheres( sphereCount );
+  for( uint32_t i = 0u; i < sphereCount; ++i )
+  {
+    spheres[i] = Vector4( random.Next( -150.0f, 150.0f ), random.Next( -150.0f, 150.0f ), random.Next( -150.0f, 150.0f ), random.Next( 0.0f, 40.0f ) );
+  }
+
+  // Spheres touching a plane, and spheres too small to be visible
+  spheres[1] = Vector4( 110.0f, 0.0f, 0.0f, 10.0f );
+  spheres[2] = Vector4( 0.0f, 0.0f, 0.0f, 0.0f );
+  spheres[sphereCount - 1u] = Vector4( 0.0f, -110.0f, 0.0f, 10.0f );
+  spheres[sphereCount - 2u] = Vector4( 0.0f, 0.0f, 0.0f, Math::MACHINE_EPSILON_1000 );
+
+  std::unique_ptr< bool[] > inside( new bool[sphereCount] );
+  TransformKernels::CheckSpheresInFrustum( inside.get(), spheres.data(), planes, sphereCount );
+
+  uint32_t insideCount = 0u;
+  for( uint32_t i = 0u; i < sphereCount; ++i )
+  {
+    bool expected = spheres[i].w > Math::MACHINE_EPSILON_1000;
+    for( uint32_t plane = 0u; plane < TransformKernels::FRUSTUM_PLANE_COUNT; ++plane )
+    {
+      if( ( planes[plane].w + Vector3( planes[plane] ).Dot( Vector3( spheres[i] ) ) ) < -spheres[i].w )
+      {
+        expected = false;
+      }
+    }
+
+    DALI_TEST_EQUALS( inside[i], expected, TEST_LOCATION );
+    insideCount += inside[i] ? 1u : 0u;
+  }
+
+  DALI_TEST_CHECK( inside[1] && !inside[2] && inside[sphereCount - 1u] && !inside[sphereCount - 2u] );
+  DALI_TEST_CHECK( insideCount > 0u && insideCount < sphereCount );
+
+  END_TEST;
+}
+
+int UtcDaliTransformManagerUpdateOnlyDirtyComponents(void)
+{
+  tet_infoline( "Ensure only the components which changed, and their descendants, are updated" );
+
+  const uint32_t componentCount = 1000u;
+
+  TransformManager manager;
+  std::vector< TransformId > ids;
+  CreateHierarchy( manager, ids, componentCount );
+  manager.ResetToBaseValue();
+  manager.Update();
+
+  // Nothing changed
+  manager.ResetToBaseValue();
+  manager.Update();
+  for( uint32_t i = 0u; i < componentCount; ++i )
+  {
+    DALI_TEST_CHECK( !manager.IsWorldMatrixDirty( ids[i] ) );
+  }
+
+  // Move component 1, whose descendants are 5-8, 21-36, ...
+  manager.ResetToBaseValue();
+  manager.SetVector3PropertyValue( ids[1], Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION, Vector3( 50.0f, 0.0f, 0.0f ) );
+  manager.Update();
+  DALI_TEST_CHECK( manager.IsWorldMatrixDirty( ids[1] ) );
+  DALI_TEST_CHECK( manager.IsWorldMatrixDirty( ids[5] ) );
+  DALI_TEST_CHECK( manager.IsWorldMatrixDirty( ids[21] ) );
+  DALI_TEST_CHECK( !manager.IsWorldMatrixDirty( ids[0] ) );
+  DALI_TEST_CHECK( !manager.IsWorldMatrixDirty( ids[2] ) );
+  DALI_TEST_CHECK( !manager.IsWorldMatrixDirty( ids[9] ) );
+
+  // The results must match a manager which updated everything
+  TransformManager expectedManager;
+  std::vector< TransformId > expectedIds;
+  CreateHierarchy( expectedManager, expectedIds, componentCount );
+  expectedManager.SetVector3PropertyValue( expectedIds[1], Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION, Vector3( 50.0f, 0.0f, 0.0f ) );
+  expectedManager.Update();
+  DALI_TEST_CHECK( CompareManagers( expectedManager, manager, expectedIds, ids ) );
+
+  // The position was not baked so resetting to the base value must restore the original transforms
+  manager.ResetToBaseValue();
+  manager.Update();
+  DALI_TEST_CHECK( manager.IsWorldMatrixDirty( ids[1] ) );
+  DALI_TEST_CHECK( manager.IsWorldMatrixDirty( ids[5] ) );
+  DALI_TEST_CHECK( !manager.IsWorldMatrixDirty( ids[2] ) );
+
+  TransformManager originalManager;
+  std::vector< TransformId > originalIds;
+  CreateHierarchy( originalManager, originalIds, componentCount );
+  originalManager.Update();
+  DALI_TEST_CHECK( CompareManagers( originalManager, manager, originalIds, ids ) );
+
+  END_TEST;
+}
+
+int UtcDaliTransformManagerHierarchyChurn(void)
+{
+  tet_infoline( "Ensure adding, removing and reparenting components keeps the results of a manager built from scratch" );
+
+  using Internal::SceneGraph::INVALID_TRANSFORM_ID;
+
+  TestRandom random;
+  TransformManager manager;
+  std::vector< TransformId > ids;     // Live components
+  std::vector< int > parents;         // Index in ids of the parent of each live component, -1 for none
+
+  auto createComponent = [&]( int parent )
+  {
+    const TransformId id = manager.CreateTransform();
+    if( parent >= 0 )
+    {
+      manager.SetParent( id, ids[parent] );
+    }
+    manager.BakeVector3PropertyValue( id, Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION, Vector3( random.Next( -10.0f, 10.0f ), random.Next( -10.0f, 10.0f ), 0.0f ) );
+    manager.BakeVector3PropertyValue( id, Internal::SceneGraph::TRANSFORM_PROPERTY_SIZE, Vector3( random.Next( 1.0f, 100.0f ), random.Next( 1.0f, 100.0f ), 0.0f ) );
+    manager.BakeQuaternionPropertyValue( id, Quaternion( Radian( random.Next( -0.1f, 0.1f ) ), Vector3::ZAXIS ) );
+    ids.push_back( id );
+    parents.push_back( parent );
+  };
+
+  auto isAncestor = [&]( int ancestor, int index )
+  {
+    for( ; index >= 0; index = parents[index] )
+    {
+      if( index == ancestor )
+      {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  // Builds the same hierarchy from scratch, creating the children before their parents
+  auto matchesNewManager = [&]()
+  {
+    TransformManager expectedManager;
+    std::vector< TransformId > expectedIds( ids.size() );
+    for( uint32_t i = static_cast<uint32_t>( ids.size() ); i > 0u; --i )
+    {
+      expectedIds[i - 1u] = expectedManager.CreateTransform();
+    }
+    for( uint32_t i = 0u; i < ids.size(); ++i )
+    {
+      if( parents[i] >= 0 )
+      {
+        expectedManager.SetParent( expectedIds[i], expectedIds[parents[i]] );
+      }
+      expectedManager.BakeVector3PropertyValue( expectedIds[i], Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION, manager.GetVector3PropertyValue( ids[i], Internal::SceneGraph::TRANSFORM_PROPERTY_POSITION ) );
+      expectedManager.BakeVector3PropertyValue( expectedIds[i], Internal::SceneGraph::TRANSFORM_PROPERTY_SIZE, manager.GetVector3PropertyValue( ids[i], Internal::SceneGraph::TRANSFORM_PROPERTY_SIZE ) );
+      expectedManager.BakeQuaternionPropertyValue( expectedIds[i], manager.GetQuaternionPropertyValue( ids[i] ) );
+    }
+    expectedManager.Update();
+    return CompareManagers( expectedManager, manager, expectedIds, ids );
+  };
+
+  auto removeLeaves = [&]( uint32_t count )
+  {
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      const int index = static_cast<int>( random.Next( 1.0f, static_cast<float>( ids.size() - 1u ) ) );
+      if( std::find( parents.begin(), parents.end(), index ) == parents.end() )
+      {
+        manager.RemoveTransform( ids[index] );
+        const int last = static_cast<int>( ids.size() ) - 1;
+        ids[index] = ids[last];
+        parents[index] = parents[last];
+        ids.pop_back();
+        parents.pop_back();
+        for( int& parent : parents )
+        {
+          parent = ( parent == last ) ? index : parent;
+        }
+      }
+    }
+  };
+
+  auto addLeaves = [&]( uint32_t count )
+  {
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      createComponent( static_cast<int>( random.Next( 0.0f, static_cast<float>( ids.size() - 1u ) ) ) );
+    }
+  };
+
+  for( int i = 0; i < 1000; ++i )
+  {
+    createComponent( ( i > 0 ) ? ( i - 1 ) / static_cast<int>( CHILDREN_PER_COMPONENT ) : -1 );
+  }
+  manager.Update();
+  DALI_TEST_CHECK( matchesNewManager() );
+
+  for( uint32_t frame = 0u; frame < 30u; ++frame )
+  {
+    // Remove some leaves and add new ones
+    removeLeaves( 10u );
+    addLeaves( 10u );
+
+    // Move some subtrees, sometimes making them roots
+    for( uint32_t i = 0u; i < 5u; ++i )
+    {
+      const int index = static_cast<int>( random.Next( 1.0f, static_cast<float>( ids.size() - 1u ) ) );
+      int parent = static_cast<int>( random.Next( -50.0f, static_cast<float>( ids.size() - 1u ) ) );
+      parent = ( parent < 0 ) ? -1 : parent;
+      if( !isAncestor( index, parent ) )
+      {
+        manager.SetParent( ids[index], ( parent >= 0 ) ? ids[parent] : INVALID_TRANSFORM_ID );
+        parents[index] = parent;
+      }
+    }
+
+    // Remove and add leaves again, before the moved subtrees are sorted by the update
+    removeLeaves( 5u );
+    addLeaves( 5u );
+
+    manager.Update();
+    DALI_TEST_CHECK( matchesNewManager() );
+  }
+
+  END_TEST;
+}
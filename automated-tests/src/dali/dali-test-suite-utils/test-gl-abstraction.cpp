@@ -32,10 +32,15 @@ void TestGlAbstraction::Initialize()
   mCurrentProgram = 0;
   mCompileStatus = GL_TRUE;
   mLinkStatus = GL_TRUE;
+  mProgramCompletionStatus = GL_TRUE;
   mNumberOfActiveUniforms = 0;
+  mUniformBlockMembers.clear();
+  mLastUniformBufferData.clear();
   mGetAttribLocationResult = 0;
   mGetErrorResult = 0;
   mGetStringResult = NULL;
+  mGetStringResults.clear();
+  mGetStringResults[GL_VERSION] = "OpenGL ES 3.0";
   mIsBufferResult = 0;
   mIsEnabledResult = 0;
   mIsFramebufferResult = 0;
@@ -82,6 +87,7 @@ void TestGlAbstraction::Initialize()
   mProgramUniforms3f.clear();
   mProgramUniforms4f.clear();
 
+  mBufferTrace.Reset();
   mCullFaceTrace.Reset();
   mDepthFunctionTrace.Reset();
   mEnableDisableTrace.Reset();
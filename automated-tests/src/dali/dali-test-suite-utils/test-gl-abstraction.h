@@ -239,6 +239,11 @@ public:
   inline void BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
   {
      mBufferSubDataCalls.push_back(size);
+     if( target == GL_UNIFORM_BUFFER && data )
+     {
+       const unsigned char* bytes = static_cast< const unsigned char* >( data );
+       mLastUniformBufferData.assign( bytes, bytes + size );
+     }
   }
 
   inline GLenum CheckFramebufferStatus(GLenum target)
@@ -717,6 +722,13 @@ public:
         *size = 1;
         break;
       default:
+        // The members of the uniform block follow the samplers
+        if( index - 3 < mUniformBlockMembers.size() )
+        {
+          *length = snprintf(name, bufsize, "Block.%s", mUniformBlockMembers[index - 3].first.c_str());
+          *type = mUniformBlockMembers[index - 3].second;
+          *size = 1;
+        }
         break;
     }
   }
@@ -788,6 +800,9 @@ public:
       case GL_LINK_STATUS:
         *params = mLinkStatus;
         break;
+      case GL_COMPLETION_STATUS_KHR:
+        *params = mProgramCompletionStatus;
+        break;
       case GL_PROGRAM_BINARY_LENGTH_OES:
         *params = mProgramBinaryLength;
         break;
@@ -797,6 +812,9 @@ public:
       case GL_ACTIVE_UNIFORM_MAX_LENGTH:
         *params = 100;
         break;
+      case GL_ACTIVE_UNIFORM_BLOCKS:
+        *params = mUniformBlockMembers.empty() ? 0 : 1;
+        break;
     }
   }
 
@@ -827,6 +845,11 @@ public:
 
   inline const GLubyte* GetString(GLenum name)
   {
+    std::map< GLenum, std::string >::const_iterator iter = mGetStringResults.find( name );
+    if( iter != mGetStringResults.end() )
+    {
+      return reinterpret_cast< const GLubyte* >( iter->second.c_str() );
+    }
     return mGetStringResult;
   }
 
@@ -856,6 +879,15 @@ public:
       return -1;
     }
 
+    // The members of the uniform block don't have locations
+    for( auto&& member : mUniformBlockMembers )
+    {
+      if( member.first == name )
+      {
+        return -1;
+      }
+    }
+
     UniformIDMap& uniformIDs = it->second;
     UniformIDMap::iterator it2 = uniformIDs.find( name );
     if( it2 == uniformIDs.end() )
@@ -1443,6 +1475,12 @@ public:
 
   inline void VertexAttrib4fv(GLuint indx, const GLfloat* values)
   {
+    std::stringstream out;
+    out << indx << ", " << values[0] << ", " << values[1] << ", " << values[2] << ", " << values[3];
+
+    TraceCallStack::NamedParams namedParams;
+    namedParams["index"] = ToString(indx);
+    mBufferTrace.PushCall("VertexAttrib4fv", out.str(), namedParams);
   }
 
   inline void VertexAttribPointer(GLuint indx, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* ptr)
@@ -1605,6 +1643,16 @@ public:
 
   inline void BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
   {
+    std::stringstream out;
+    out << target << ", " << index << ", " << buffer << ", " << offset << ", " << size;
+
+    TraceCallStack::NamedParams namedParams;
+    namedParams["target"] = ToString(target);
+    namedParams["index"] = ToString(index);
+    namedParams["buffer"] = ToString(buffer);
+    namedParams["offset"] = ToString(offset);
+    namedParams["size"] = ToString(size);
+    mBufferTrace.PushCall("BindBufferRange", out.str(), namedParams);
   }
 
   inline void BindBufferBase(GLenum target, GLuint index, GLuint buffer)
@@ -1719,6 +1767,23 @@ public:
 
   inline void GetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint* uniformIndices, GLenum pname, GLint* params)
   {
+    // Each member of the uniform block is given 64 bytes
+    for( GLsizei i = 0; i < uniformCount; ++i )
+    {
+      const GLuint member = uniformIndices[i] - 3;
+      switch( pname )
+      {
+        case GL_UNIFORM_TYPE:
+          params[i] = member < mUniformBlockMembers.size() ? mUniformBlockMembers[member].second : 0;
+          break;
+        case GL_UNIFORM_OFFSET:
+          params[i] = member * 64;
+          break;
+        case GL_UNIFORM_MATRIX_STRIDE:
+          params[i] = 16;
+          break;
+      }
+    }
   }
 
   inline GLuint GetUniformBlockIndex(GLuint program, const GLchar* uniformBlockName)
@@ -1728,6 +1793,21 @@ public:
 
   inline void GetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint* params)
   {
+    switch( pname )
+    {
+      case GL_UNIFORM_BLOCK_DATA_SIZE:
+        *params = mUniformBlockMembers.size() * 64;
+        break;
+      case GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS:
+        *params = mUniformBlockMembers.size();
+        break;
+      case GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES:
+        for( unsigned int i = 0; i < mUniformBlockMembers.size(); ++i )
+        {
+          params[i] = 3 + i;
+        }
+        break;
+    }
   }
 
   inline void GetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformBlockName)
@@ -1740,10 +1820,26 @@ public:
 
   inline void DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount)
   {
+    std::stringstream out;
+    out << mode << ", " << first << ", " << count << ", " << instanceCount;
+    TraceCallStack::NamedParams namedParams;
+    namedParams["mode"] = ToString(mode);
+    namedParams["first"] = ToString(first);
+    namedParams["count"] = ToString(count);
+    namedParams["instanceCount"] = ToString(instanceCount);
+    mDrawTrace.PushCall("DrawArraysInstanced", out.str(), namedParams);
   }
 
   inline void DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLsizei instanceCount)
   {
+    std::stringstream out;
+    out << mode << ", " << count << ", " << type << ", indices, " << instanceCount;
+    TraceCallStack::NamedParams namedParams;
+    namedParams["mode"] = ToString(mode);
+    namedParams["count"] = ToString(count);
+    namedParams["type"] = ToString(type);
+    namedParams["instanceCount"] = ToString(instanceCount);
+    mDrawTrace.PushCall("DrawElementsInstanced", out.str(), namedParams);
   }
 
   inline GLsync FenceSync(GLenum condition, GLbitfield flags)
@@ -1916,9 +2012,11 @@ private:
 public: // TEST FUNCTIONS
   inline void SetCompileStatus( GLuint value ) { mCompileStatus = value; }
   inline void SetLinkStatus( GLuint value ) { mLinkStatus = value; }
+  inline void SetProgramCompletionStatus( GLuint value ) { mProgramCompletionStatus = value; }
   inline void SetGetAttribLocationResult(  int result) { mGetAttribLocationResult = result; }
   inline void SetGetErrorResult(  GLenum result) { mGetErrorResult = result; }
   inline void SetGetStringResult(  GLubyte* result) { mGetStringResult = result; }
+  inline void SetGetStringResult( GLenum name, const char* result ) { mGetStringResults[name] = result; }
   inline void SetIsBufferResult(  GLboolean result) { mIsBufferResult = result; }
   inline void SetIsEnabledResult(  GLboolean result) { mIsEnabledResult = result; }
   inline void SetIsFramebufferResult(  GLboolean result) { mIsFramebufferResult = result; }
@@ -1948,6 +2046,11 @@ public: // TEST FUNCTIONS
   inline void ResetCullFaceCallStack() { mCullFaceTrace.Reset(); }
   inline TraceCallStack& GetCullFaceTrace() { return mCullFaceTrace; }
 
+  //Methods for buffer binding verification
+  inline void EnableBufferCallTrace(bool enable) { mBufferTrace.Enable(enable); }
+  inline void ResetBufferCallStack() { mBufferTrace.Reset(); }
+  inline TraceCallStack& GetBufferTrace() { return mBufferTrace; }
+
   //Methods for Enable/Disable call verification
   inline void EnableEnableDisableCallTrace(bool enable) { mEnableDisableTrace.Enable(enable); }
   inline void ResetEnableDisableCallStack() { mEnableDisableTrace.Reset(); }
@@ -2164,16 +2267,25 @@ public: // TEST FUNCTIONS
   inline const BufferSubDataCalls& GetBufferSubDataCalls() const { return mBufferSubDataCalls; }
   inline void ResetBufferSubDataCalls() { mBufferSubDataCalls.clear(); }
 
+  // Methods for the uniform block of the programs, made of the given uniform names and types
+  typedef std::vector< std::pair< std::string, GLenum > > UniformBlockMembers;
+  inline void SetUniformBlockMembers( const UniformBlockMembers& members ) { mUniformBlockMembers = members; }
+  inline const std::vector<unsigned char>& GetLastUniformBufferData() const { return mLastUniformBufferData; }
+
 private:
   GLuint     mCurrentProgram;
   GLuint     mCompileStatus;
   BufferDataCalls mBufferDataCalls;
   BufferSubDataCalls mBufferSubDataCalls;
+  UniformBlockMembers mUniformBlockMembers;
+  std::vector<unsigned char> mLastUniformBufferData;
   GLuint     mLinkStatus;
+  GLuint     mProgramCompletionStatus;
   GLint      mNumberOfActiveUniforms;
   GLint      mGetAttribLocationResult;
   GLenum     mGetErrorResult;
   GLubyte*   mGetStringResult;
+  std::map< GLenum, std::string > mGetStringResults;
   GLboolean  mIsBufferResult;
   GLboolean  mIsEnabledResult;
   GLboolean  mIsFramebufferResult;
@@ -2225,6 +2337,7 @@ private:
 
   ActiveTextureType mActiveTextures[ MIN_TEXTURE_UNIT_LIMIT ];
 
+  TraceCallStack mBufferTrace;
   TraceCallStack mCullFaceTrace;
   TraceCallStack mEnableDisableTrace;
   TraceCallStack mShaderTrace;
@@ -28,6 +28,8 @@ TestPlatformAbstraction::TestPlatformAbstraction()
   mClosestSize(),
   mLoadFileResult(),
   mSaveFileResult( false ),
+  mShaderBinaryFileThreadSafe( false ),
+  mShaderBinaryFileThread(),
   mSynchronouslyLoadedResource(),
   mTimerId(0),
   mCallbackFunction(nullptr)
@@ -46,6 +48,7 @@ ImageDimensions TestPlatformAbstraction::GetClosestImageSize( const std::string&
                                                               bool orientationCorrection )
 {
   ImageDimensions closestSize = ImageDimensions( mClosestSize );
+  std::lock_guard< std::mutex > lock( mTraceMutex );
   mTrace.PushCall("GetClosestImageSize", "");
   return closestSize;
 }
@@ -57,25 +60,30 @@ ImageDimensions TestPlatformAbstraction::GetClosestImageSize( Integration::Resou
                                                    bool orientationCorrection )
 {
   ImageDimensions closestSize = ImageDimensions( mClosestSize );
+  std::lock_guard< std::mutex > lock( mTraceMutex );
   mTrace.PushCall("GetClosestImageSize", "");
   return closestSize;
 }
 
 Integration::ResourcePointer TestPlatformAbstraction::LoadImageSynchronously( const Integration::BitmapResourceType& resourceType, const std::string& resourcePath )
 {
+  std::lock_guard< std::mutex > lock( mTraceMutex );
   mTrace.PushCall("LoadResourceSynchronously", "");
   return mSynchronouslyLoadedResource;
 }
 
 Integration::BitmapPtr TestPlatformAbstraction::DecodeBuffer( const Integration::BitmapResourceType& resourceType, uint8_t * buffer, size_t size )
 {
+  std::lock_guard< std::mutex > lock( mTraceMutex );
   mTrace.PushCall("DecodeBuffer", "");
   return mDecodedBitmap;
 }
 
 bool TestPlatformAbstraction::LoadShaderBinaryFile( const std::string& filename, Dali::Vector< unsigned char >& buffer ) const
 {
+  std::lock_guard< std::mutex > lock( mTraceMutex );
   mTrace.PushCall("LoadShaderBinaryFile", "");
+  mShaderBinaryFileThread = std::this_thread::get_id();
   if( mLoadFileResult.loadResult )
   {
     buffer = mLoadFileResult.buffer;
@@ -84,9 +92,26 @@ bool TestPlatformAbstraction::LoadShaderBinaryFile( const std::string& filename,
   return mLoadFileResult.loadResult;
 }
 
+bool TestPlatformAbstraction::SaveShaderBinaryFile( const std::string& filename, const unsigned char * buffer, unsigned int numBytes ) const
+{
+  std::lock_guard< std::mutex > lock( mTraceMutex );
+  mTrace.PushCall("SaveShaderBinaryFile", "");
+  mShaderBinaryFileThread = std::this_thread::get_id();
+  mSavedFile.Resize( numBytes );
+  memcpy( mSavedFile.Begin(), buffer, numBytes );
+
+  return true;
+}
+
+bool TestPlatformAbstraction::IsShaderBinaryFileThreadSafe() const
+{
+  return mShaderBinaryFileThreadSafe;
+}
+
 /** Call this every test */
 void TestPlatformAbstraction::Initialize()
 {
+  std::lock_guard< std::mutex > lock( mTraceMutex );
   mTrace.Reset();
   mTrace.Enable(true);
   mIsLoadingResult=false;
@@ -135,6 +160,17 @@ void TestPlatformAbstraction::SetSaveFileResult( bool result )
   mSaveFileResult = result;
 }
 
+void TestPlatformAbstraction::SetShaderBinaryFileThreadSafe( bool threadSafe )
+{
+  mShaderBinaryFileThreadSafe = threadSafe;
+}
+
+std::thread::id TestPlatformAbstraction::GetShaderBinaryFileThread() const
+{
+  std::lock_guard< std::mutex > lock( mTraceMutex );
+  return mShaderBinaryFileThread;
+}
+
 void TestPlatformAbstraction::SetSynchronouslyLoadedResource( Integration::ResourcePointer resource )
 {
   mSynchronouslyLoadedResource = resource;
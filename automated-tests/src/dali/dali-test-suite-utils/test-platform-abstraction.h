@@ -21,7 +21,9 @@
 // EXTERNAL INCLUDES
 #include <stdint.h>
 #include <cstring>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 // INTERNAL INCLUDES
@@ -87,7 +89,12 @@ public:
   /**
    * @copydoc PlatformAbstraction::SaveShaderBinaryFile()
    */
-  virtual bool SaveShaderBinaryFile( const std::string& filename, const unsigned char * buffer, unsigned int numBytes ) const { return true; }
+  virtual bool SaveShaderBinaryFile( const std::string& filename, const unsigned char * buffer, unsigned int numBytes ) const;
+
+  /**
+   * @copydoc PlatformAbstraction::IsShaderBinaryFileThreadSafe()
+   */
+  virtual bool IsShaderBinaryFileThreadSafe() const;
 
   /**
    * @copydoc PlatformAbstraction::StartTimer()
@@ -147,6 +154,24 @@ public: // TEST FUNCTIONS
    */
   void SetLoadFileResult( bool result, Dali::Vector< unsigned char >& buffer );
 
+  /**
+   * @brief Gets the buffer saved last by SaveShaderBinaryFile.
+   * @return The buffer
+   */
+  const Dali::Vector< unsigned char >& GetSavedFile() const { return mSavedFile; }
+
+  /**
+   * @brief Sets whether the shader binary files may be loaded and saved from other threads than the event thread.
+   * @param[in] threadSafe The value that IsShaderBinaryFileThreadSafe should return
+   */
+  void SetShaderBinaryFileThreadSafe( bool threadSafe );
+
+  /**
+   * @brief Gets the thread which last loaded or saved a shader binary file.
+   * @return The thread
+   */
+  std::thread::id GetShaderBinaryFileThread() const;
+
   /**
    * @brief Sets the SaveFile result
    * @param[in] result The value that SaveFile should return
@@ -190,11 +215,15 @@ private:
   };
 
   mutable TraceCallStack        mTrace;
+  mutable std::mutex            mTraceMutex;  ///< The shader binaries are loaded on another thread
   bool                          mIsLoadingResult;
   ImageDimensions               mClosestSize;
 
   LoadFileResult                mLoadFileResult;
   bool                          mSaveFileResult;
+  mutable Dali::Vector< unsigned char > mSavedFile;
+  bool                          mShaderBinaryFileThreadSafe;
+  mutable std::thread::id       mShaderBinaryFileThread;
 
   Integration::ResourcePointer  mSynchronouslyLoadedResource;
   Integration::BitmapPtr        mDecodedBitmap;
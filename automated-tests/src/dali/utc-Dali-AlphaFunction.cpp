@@ -250,3 +250,70 @@ int UtcDaliAlphaFunctionBezier(void)
   END_TEST;
 }
 
+
+namespace
+{
+
+/**
+ * Evaluates a coordinate of a cubic bezier curve assuming the first point is at 0.0 and the last point is at 1.0
+ */
+float EvaluateCubicBezier( float p0, float p1, float t )
+{
+  return 3.0f * ( 1.0f - t ) * ( 1.0f - t ) * t * p0 + 3.0f * ( 1.0f - t ) * t * t * p1 + t * t * t;
+}
+
+/**
+ * Finds the y coordinate of a bezier curve for an x coordinate, by bisecting the curve to full precision
+ */
+float EvaluateBezierAlphaFunction( const Vector4& controlPoints, float progress )
+{
+  float lowerBound( 0.0f );
+  float upperBound( 1.0f );
+  for( int i = 0; i < 40; ++i )
+  {
+    const float t = ( lowerBound + upperBound ) * 0.5f;
+    if( EvaluateCubicBezier( controlPoints.x, controlPoints.z, t ) < progress )
+    {
+      lowerBound = t;
+    }
+    else
+    {
+      upperBound = t;
+    }
+  }
+  return EvaluateCubicBezier( controlPoints.y, controlPoints.w, ( lowerBound + upperBound ) * 0.5f );
+}
+
+} // unnamed namespace
+
+int UtcDaliAlphaFunctionBezierPrecision(void)
+{
+  TestApplication application;
+
+  // The second curve is flat at both ends, where the curve parameter can't be refined with Newton-Raphson
+  const Vector4 curves[] = { Vector4( 0.42f, 0.0f, 0.58f, 1.0f ), Vector4( 0.0f, 0.6f, 1.0f, 0.4f ) };
+  for( const Vector4& controlPoints : curves )
+  {
+    Actor actor = Actor::New();
+    Property::Index index = actor.RegisterProperty( "testProperty", 0.0f );
+    Stage::GetCurrent().Add( actor );
+
+    Animation animation = Animation::New( 1.0f );
+    animation.AnimateTo( Property( actor, index ), 1.0f, AlphaFunction( Vector2( controlPoints.x, controlPoints.y ), Vector2( controlPoints.z, controlPoints.w ) ) );
+    animation.Play();
+
+    application.SendNotification();
+    application.Render( 0 );
+
+    for( int frame = 1; frame < 20; ++frame )
+    {
+      application.SendNotification();
+      application.Render( 50 );
+
+      const float progress = static_cast< float >( frame ) * 0.05f;
+      DALI_TEST_EQUALS( actor.GetCurrentProperty< float >( index ), EvaluateBezierAlphaFunction( controlPoints, progress ), 0.001f, TEST_LOCATION );
+    }
+  }
+
+  END_TEST;
+}
@@ -13528,3 +13528,172 @@ int UtcDaliAnimationCombineToAndByWithStop(void)
 
   END_TEST;
 }
+
+namespace
+{
+
+int gSampledAlphaFunctionCallCount = 0;
+
+float SampledAlphaFunction( float progress )
+{
+  ++gSampledAlphaFunctionCallCount;
+  return progress * progress;
+}
+
+} // unnamed namespace
+
+int UtcDaliAnimationSampleCustomAlphaFunctions(void)
+{
+  TestApplication application;
+
+  Actor actor = Actor::New();
+  Property::Index index = actor.RegisterProperty( "testProperty", 0.0f );
+  Stage::GetCurrent().Add( actor );
+
+  Animation animation = Animation::New( 1.0f );
+  DALI_TEST_EQUALS( DevelAnimation::GetSampleCustomAlphaFunctions( animation ), false, TEST_LOCATION );
+  DevelAnimation::SetSampleCustomAlphaFunctions( animation, true );
+  DALI_TEST_EQUALS( DevelAnimation::GetSampleCustomAlphaFunctions( animation ), true, TEST_LOCATION );
+
+  gSampledAlphaFunctionCallCount = 0;
+  animation.AnimateTo( Property( actor, index ), 1.0f, AlphaFunction( SampledAlphaFunction ) );
+
+  // The function is sampled when the animator is created
+  const int sampleCount = gSampledAlphaFunctionCallCount;
+  DALI_TEST_CHECK( sampleCount > 0 );
+
+  animation.Play();
+  application.SendNotification();
+  application.Render( 0 );
+
+  for( int frame = 1; frame < 10; ++frame )
+  {
+    application.SendNotification();
+    application.Render( 100 );
+
+    const float progress = static_cast< float >( frame ) * 0.1f;
+    DALI_TEST_EQUALS( actor.GetCurrentProperty< float >( index ), progress * progress, 0.001f, TEST_LOCATION );
+  }
+
+  // The function isn't called while the animation is running
+  DALI_TEST_EQUALS( gSampledAlphaFunctionCallCount, sampleCount, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliAnimationStaggeredAnimators(void)
+{
+  // Ensure many animators of the same kind, with different delays, all get their own values
+
+  TestApplication application;
+
+  const int actorCount = 40;
+  std::vector< Actor > actors;
+  std::vector< Property::Index > indices;
+  Animation animation = Animation::New( 1.0f );
+  for( int i = 0; i < actorCount; ++i )
+  {
+    Actor actor = Actor::New();
+    indices.push_back( actor.RegisterProperty( "testProperty", 0.0f ) );
+    Stage::GetCurrent().Add( actor );
+    actors.push_back( actor );
+
+    const float delay = static_cast< float >( i ) * 0.01f;
+    animation.AnimateTo( Property( actor, Actor::Property::POSITION ), Vector3( 100.0f, static_cast< float >( i ), 0.0f ), TimePeriod( delay, 0.5f ) );
+    animation.AnimateBy( Property( actor, Actor::Property::COLOR ), Vector4( 0.0f, -0.5f, -0.5f, 0.0f ), TimePeriod( delay, 0.5f ) );
+    animation.AnimateTo( Property( actor, indices.back() ), 10.0f, AlphaFunction::EASE_IN, TimePeriod( delay, 0.5f ) );
+  }
+  animation.Play();
+
+  application.SendNotification();
+  application.Render( 0 );
+  application.SendNotification();
+  application.Render( 300 );
+
+  for( int i = 0; i < actorCount; ++i )
+  {
+    const float progress = std::max( 0.0f, ( 0.3f - static_cast< float >( i ) * 0.01f ) / 0.5f );
+    const Vector3 expectedPosition( 100.0f * progress, static_cast< float >( i ) * progress, 0.0f );
+    DALI_TEST_EQUALS( actors[i].GetCurrentPosition(), expectedPosition, 0.01f, TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentColor(), Vector4( 1.0f, 1.0f - 0.5f * progress, 1.0f - 0.5f * progress, 1.0f ), 0.01f, TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentProperty< float >( indices[i] ), 10.0f * progress * progress * progress, 0.01f, TEST_LOCATION );
+  }
+
+  // Destroy half of the actors while the animation is running
+  for( int i = 0; i < actorCount; i += 2 )
+  {
+    Stage::GetCurrent().Remove( actors[i] );
+    actors[i].Reset();
+  }
+
+  application.SendNotification();
+  application.Render( 1000 );
+
+  for( int i = 1; i < actorCount; i += 2 )
+  {
+    DALI_TEST_EQUALS( actors[i].GetCurrentPosition(), Vector3( 100.0f, static_cast< float >( i ), 0.0f ), TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentColor(), Vector4( 1.0f, 0.5f, 0.5f, 1.0f ), TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentProperty< float >( indices[i] ), 10.0f, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliAnimationAnimateBetweenManyKeyFrames(void)
+{
+  // Ensure long tracks of uniformly and non-uniformly spaced key frames are found while playing forwards and after jumps
+
+  TestApplication application;
+
+  const int keyFrameCount = 201;
+  KeyFrames uniformKeyFrames = KeyFrames::New();
+  KeyFrames nonUniformKeyFrames = KeyFrames::New();
+  for( int i = 0; i < keyFrameCount; ++i )
+  {
+    const float progress = static_cast< float >( i ) / static_cast< float >( keyFrameCount - 1 );
+    uniformKeyFrames.Add( progress, progress * 100.0f );
+    nonUniformKeyFrames.Add( progress * progress, progress * progress * 100.0f );
+  }
+
+  const Dali::Animation::Interpolation interpolations[] = { Animation::Linear, Animation::Cubic };
+  for( Dali::Animation::Interpolation interpolation : interpolations )
+  {
+    Actor actor = Actor::New();
+    Property::Index uniformIndex = actor.RegisterProperty( "uniform", 0.0f );
+    Property::Index nonUniformIndex = actor.RegisterProperty( "nonUniform", 0.0f );
+    Stage::GetCurrent().Add( actor );
+
+    Animation animation = Animation::New( 1.0f );
+    animation.AnimateBetween( Property( actor, uniformIndex ), uniformKeyFrames, interpolation );
+    animation.AnimateBetween( Property( actor, nonUniformIndex ), nonUniformKeyFrames, interpolation );
+    animation.Play();
+
+    application.SendNotification();
+    application.Render( 0 );
+
+    // The key frames are on a straight line, so both interpolations give the progress
+    for( int frame = 1; frame < 10; ++frame )
+    {
+      application.SendNotification();
+      application.Render( 73 );
+
+      const float progress = static_cast< float >( frame ) * 0.073f;
+      DALI_TEST_EQUALS( actor.GetCurrentProperty< float >( uniformIndex ), progress * 100.0f, 0.01f, TEST_LOCATION );
+      DALI_TEST_EQUALS( actor.GetCurrentProperty< float >( nonUniformIndex ), progress * 100.0f, 0.01f, TEST_LOCATION );
+    }
+
+    // Jump backwards
+    animation.SetCurrentProgress( 0.25f );
+    application.SendNotification();
+    application.Render( 0 );
+    DALI_TEST_EQUALS( actor.GetCurrentProperty< float >( uniformIndex ), 25.0f, 0.01f, TEST_LOCATION );
+    DALI_TEST_EQUALS( actor.GetCurrentProperty< float >( nonUniformIndex ), 25.0f, 0.01f, TEST_LOCATION );
+
+    application.SendNotification();
+    application.Render( 1000 );
+    DALI_TEST_EQUALS( actor.GetCurrentProperty< float >( uniformIndex ), 100.0f, TEST_LOCATION );
+    DALI_TEST_EQUALS( actor.GetCurrentProperty< float >( nonUniformIndex ), 100.0f, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
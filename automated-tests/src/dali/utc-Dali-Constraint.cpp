@@ -19,6 +19,7 @@
 
 #include <stdlib.h>
 #include <dali/public-api/dali-core.h>
+#include <dali/devel-api/animation/constraint-devel.h>
 #include <dali-test-suite-utils.h>
 
 using namespace Dali;
@@ -1358,3 +1359,325 @@ int UtcDaliConstraintOnActorAddedAndRemoved(void)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
+
+int UtcDaliConstraintInputsFollowSourceEveryFrame(void)
+{
+  // Ensure the inputs of a constraint read the values of the current buffer in every frame
+
+  TestApplication application;
+
+  Actor source = Actor::New();
+  Actor target = Actor::New();
+  Stage::GetCurrent().Add( source );
+  Stage::GetCurrent().Add( target );
+
+  Constraint constraint = Constraint::New< Vector3 >( target, Actor::Property::POSITION, EqualToConstraint() );
+  constraint.AddSource( Source( source, Actor::Property::POSITION ) );
+  constraint.Apply();
+
+  for( int frame = 1; frame <= 5; ++frame )
+  {
+    const Vector3 position( static_cast< float >( frame ), static_cast< float >( frame * 2 ), 0.0f );
+    source.SetPosition( position );
+
+    application.SendNotification();
+    application.Render();
+
+    DALI_TEST_EQUALS( target.GetCurrentPosition(), position, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace UtcDaliConstraintEvaluation
+{
+/**
+ * A functor which copies its input and counts how many times it is called.
+ */
+struct CopyInputFunctor
+{
+  CopyInputFunctor( int& callCount ) : mCallCount( callCount ) { }
+
+  void operator()( float& current, const PropertyInputContainer& inputs )
+  {
+    current = inputs[0]->GetFloat();
+    ++mCallCount;
+  }
+
+  int& mCallCount;
+};
+} // namespace UtcDaliConstraintEvaluation
+
+int UtcDaliConstraintAppliedAfterItsInputs(void)
+{
+  // Ensure a constraint reads the constrained value of its input, even if the input is constrained later in the tree
+
+  TestApplication application;
+
+  Actor reader = Actor::New();
+  Actor source = Actor::New();
+  Stage::GetCurrent().Add( reader );
+  Stage::GetCurrent().Add( source );
+
+  Constraint readerConstraint = Constraint::New< Vector3 >( reader, Actor::Property::POSITION, EqualToConstraint() );
+  readerConstraint.AddSource( Source( source, Actor::Property::POSITION ) );
+  readerConstraint.Apply();
+
+  Constraint sourceConstraint = Constraint::New< Vector3 >( source, Actor::Property::POSITION, SetValueFunctor< Vector3 >( Vector3( 10.0f, 20.0f, 30.0f ) ) );
+  sourceConstraint.Apply();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( source.GetCurrentPosition(), Vector3( 10.0f, 20.0f, 30.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( reader.GetCurrentPosition(), Vector3( 10.0f, 20.0f, 30.0f ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliConstraintCyclicDependencies(void)
+{
+  // Ensure constraints which depend on each other are still applied
+
+  TestApplication application;
+
+  Actor first = Actor::New();
+  Actor second = Actor::New();
+  Stage::GetCurrent().Add( first );
+  Stage::GetCurrent().Add( second );
+
+  Constraint firstConstraint = Constraint::New< Vector3 >( first, Actor::Property::POSITION, EqualToConstraint() );
+  firstConstraint.AddSource( Source( second, Actor::Property::SIZE ) );
+  firstConstraint.Apply();
+
+  Constraint secondConstraint = Constraint::New< Vector3 >( second, Actor::Property::SIZE, EqualToConstraint() );
+  secondConstraint.AddSource( Source( first, Actor::Property::SCALE ) );
+  secondConstraint.Apply();
+
+  first.SetScale( 2.0f );
+
+  application.SendNotification();
+  application.Render();
+  application.Render();
+
+  DALI_TEST_EQUALS( second.GetCurrentSize(), Vector3( 2.0f, 2.0f, 2.0f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( first.GetCurrentPosition(), Vector3( 2.0f, 2.0f, 2.0f ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliConstraintSkippedWhenInputsUnchanged(void)
+{
+  // Ensure the constraint function is only called when its input changes, unless it is evaluated every frame
+
+  TestApplication application;
+
+  Actor source = Actor::New();
+  Actor target = Actor::New();
+  Property::Index sourceIndex = source.RegisterProperty( "input", 1.0f );
+  Property::Index targetIndex = target.RegisterProperty( "output", 0.0f );
+  Stage::GetCurrent().Add( source );
+  Stage::GetCurrent().Add( target );
+
+  // Moving another actor makes sure the scene is updated every frame
+  Actor other = Actor::New();
+  Stage::GetCurrent().Add( other );
+
+  int callCount = 0;
+  Constraint constraint = Constraint::New< float >( target, targetIndex, UtcDaliConstraintEvaluation::CopyInputFunctor( callCount ) );
+  constraint.AddSource( Source( source, sourceIndex ) );
+  DALI_TEST_EQUALS( DevelConstraint::GetEvaluateEveryFrame( constraint ), false, TEST_LOCATION );
+  constraint.Apply();
+
+  // Let the values settle in both buffers
+  for( int i = 0; i < 4; ++i )
+  {
+    application.SendNotification();
+    application.Render();
+  }
+  DALI_TEST_EQUALS( target.GetCurrentProperty< float >( targetIndex ), 1.0f, TEST_LOCATION );
+
+  const int settledCallCount = callCount;
+  DALI_TEST_CHECK( settledCallCount > 0 );
+
+  for( int i = 0; i < 4; ++i )
+  {
+    other.SetPosition( static_cast< float >( i ), 0.0f );
+    application.SendNotification();
+    application.Render();
+    DALI_TEST_EQUALS( target.GetCurrentProperty< float >( targetIndex ), 1.0f, TEST_LOCATION );
+  }
+  DALI_TEST_EQUALS( callCount, settledCallCount, TEST_LOCATION );
+
+  // Changing the input calls the function again
+  source.SetProperty( sourceIndex, 5.0f );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( callCount > settledCallCount );
+  DALI_TEST_EQUALS( target.GetCurrentProperty< float >( targetIndex ), 5.0f, TEST_LOCATION );
+
+  // A function evaluated every frame is always called
+  DevelConstraint::SetEvaluateEveryFrame( constraint, true );
+  DALI_TEST_EQUALS( DevelConstraint::GetEvaluateEveryFrame( constraint ), true, TEST_LOCATION );
+  application.SendNotification();
+  application.Render();
+
+  const int everyFrameCallCount = callCount;
+  for( int i = 0; i < 3; ++i )
+  {
+    other.SetPosition( static_cast< float >( i ), 0.0f );
+    application.SendNotification();
+    application.Render();
+  }
+  DALI_TEST_EQUALS( callCount, everyFrameCallCount + 3, TEST_LOCATION );
+  DALI_TEST_EQUALS( target.GetCurrentProperty< float >( targetIndex ), 5.0f, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliConstraintInputSetForOneFrame(void)
+{
+  // Ensure a constraint follows an input which is set for one frame, then goes back to its base value
+
+  TestApplication application;
+
+  Actor source = Actor::New();
+  Actor target = Actor::New();
+  Property::Index sourceIndex = source.RegisterProperty( "input", 1.0f );
+  Property::Index targetIndex = target.RegisterProperty( "output", 0.0f );
+  Stage::GetCurrent().Add( source );
+  Stage::GetCurrent().Add( target );
+
+  // Moving another actor makes sure the scene is updated every frame
+  Actor other = Actor::New();
+  Stage::GetCurrent().Add( other );
+
+  int callCount = 0;
+  Constraint constraint = Constraint::New< float >( target, targetIndex, UtcDaliConstraintEvaluation::CopyInputFunctor( callCount ) );
+  constraint.AddSource( Source( source, sourceIndex ) );
+  constraint.Apply();
+
+  for( int i = 0; i < 4; ++i )
+  {
+    other.SetPosition( static_cast< float >( i ), 0.0f );
+    application.SendNotification();
+    application.Render();
+  }
+  DALI_TEST_EQUALS( target.GetCurrentProperty< float >( targetIndex ), 1.0f, TEST_LOCATION );
+
+  // The input is set rather than baked, so it is only changed for one frame
+  Constraint sourceConstraint = Constraint::New< float >( source, sourceIndex, SetValueFunctor< float >( 7.0f ) );
+  sourceConstraint.SetRemoveAction( Constraint::Discard );
+  sourceConstraint.Apply();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( source.GetCurrentProperty< float >( sourceIndex ), 7.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( target.GetCurrentProperty< float >( targetIndex ), 7.0f, TEST_LOCATION );
+
+  sourceConstraint.Remove();
+  for( int i = 0; i < 4; ++i )
+  {
+    other.SetPosition( static_cast< float >( i ), 1.0f );
+    application.SendNotification();
+    application.Render();
+    DALI_TEST_EQUALS( source.GetCurrentProperty< float >( sourceIndex ), 1.0f, TEST_LOCATION );
+    DALI_TEST_EQUALS( target.GetCurrentProperty< float >( targetIndex ), 1.0f, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliConstraintNotAppliedBelowInvisibleActor(void)
+{
+  // Ensure the constraints of the actors below an invisible actor aren't applied, as when the actors were constrained while they were updated
+
+  TestApplication application;
+
+  Actor source = Actor::New();
+  Actor parent = Actor::New();
+  Actor child = Actor::New();
+  Property::Index sourceIndex = source.RegisterProperty( "input", 1.0f );
+  Property::Index parentIndex = parent.RegisterProperty( "output", 0.0f );
+  Property::Index childIndex = child.RegisterProperty( "output", 0.0f );
+  parent.Add( child );
+  Stage::GetCurrent().Add( source );
+  Stage::GetCurrent().Add( parent );
+  parent.SetVisible( false );
+
+  int childCallCount = 0;
+  Constraint childConstraint = Constraint::New< float >( child, childIndex, UtcDaliConstraintEvaluation::CopyInputFunctor( childCallCount ) );
+  childConstraint.AddSource( Source( source, sourceIndex ) );
+  childConstraint.Apply();
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( childCallCount, 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( child.GetCurrentProperty< float >( childIndex ), 0.0f, TEST_LOCATION );
+
+  // The invisible actor itself is still constrained, since its constraints might make it visible
+  int parentCallCount = 0;
+  Constraint parentConstraint = Constraint::New< float >( parent, parentIndex, UtcDaliConstraintEvaluation::CopyInputFunctor( parentCallCount ) );
+  parentConstraint.AddSource( Source( source, sourceIndex ) );
+  parentConstraint.Apply();
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( parentCallCount > 0 );
+  DALI_TEST_EQUALS( parent.GetCurrentProperty< float >( parentIndex ), 1.0f, TEST_LOCATION );
+
+  parentConstraint.Remove();
+  source.SetProperty( sourceIndex, 2.0f );
+  parent.SetVisible( true );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( childCallCount > 0 );
+  DALI_TEST_EQUALS( child.GetCurrentProperty< float >( childIndex ), 2.0f, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliConstraintAppliedByWorkerThreads(void)
+{
+  // Ensure independent chains of constraints get the same results when they are applied by the worker threads
+
+  TestApplication application;
+  application.GetCore().SetUpdateThreadCount( 2u );
+
+  std::vector< Actor > readers;
+  std::vector< Constraint > constraints;
+  for( int i = 0; i < 40; ++i )
+  {
+    Actor reader = Actor::New();
+    Actor source = Actor::New();
+    Stage::GetCurrent().Add( reader );
+    Stage::GetCurrent().Add( source );
+    readers.push_back( reader );
+
+    Constraint readerConstraint = Constraint::New< Vector3 >( reader, Actor::Property::POSITION, EqualToConstraint() );
+    readerConstraint.AddSource( Source( source, Actor::Property::POSITION ) );
+    readerConstraint.Apply();
+    constraints.push_back( readerConstraint );
+
+    const float value = static_cast< float >( i );
+    Constraint sourceConstraint = Constraint::New< Vector3 >( source, Actor::Property::POSITION, SetValueFunctor< Vector3 >( Vector3( value, value, value ) ) );
+    sourceConstraint.Apply();
+    constraints.push_back( sourceConstraint );
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  for( int i = 0; i < 40; ++i )
+  {
+    const float value = static_cast< float >( i );
+    DALI_TEST_EQUALS( readers[i].GetCurrentPosition(), Vector3( value, value, value ), TEST_LOCATION );
+  }
+
+  application.GetCore().SetUpdateThreadCount( 0u );
+
+  END_TEST;
+}
+
+///////////////////////////////////////////////////////////////////////////////
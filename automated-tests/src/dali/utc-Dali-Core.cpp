@@ -16,12 +16,14 @@
  */
 
 #include <iostream>
+#include <vector>
 #include <sstream>
 #include <cmath> // isfinite
 
 #include <stdlib.h>
 #include <dali/integration-api/core.h>
 #include <dali-test-suite-utils.h>
+#include <mesh-builder.h>
 
 using namespace Dali;
 
@@ -44,3 +46,230 @@ int UtcDaliCoreGetMaximumUpdateCount(void)
   END_TEST;
 }
 
+
+namespace
+{
+
+/**
+ * The results of updating the scene-graph of UpdateScene
+ */
+struct UpdateResults
+{
+  std::vector< Vector4 > worldColors;
+  std::vector< Matrix > worldMatrices;
+  std::vector< std::size_t > drawCounts;
+  std::vector< std::string > uniformTraces;
+};
+
+void AddUpdateResults( std::vector< Actor >& actors, TestApplication& application, UpdateResults& results )
+{
+  for( auto&& actor : actors )
+  {
+    results.worldColors.push_back( actor.GetCurrentWorldColor() );
+    results.worldMatrices.push_back( actor.GetCurrentWorldMatrix() );
+  }
+  results.drawCounts.push_back( application.GetGlAbstraction().GetDrawTrace().CountMethod( "DrawElements" ) );
+  results.uniformTraces.push_back( application.GetGlAbstraction().GetSetUniformTrace().GetTraceString() );
+}
+
+/**
+ * Updates a scene-graph whose nodes are spread over many subtrees of the worker threads, changing the nodes of
+ * different subtrees in every frame.
+ */
+void UpdateScene( uint32_t threadCount, UpdateResults& results )
+{
+  TestApplication application;
+  application.GetCore().SetUpdateThreadCount( threadCount );
+  application.GetGlAbstraction().EnableDrawCallTrace( true );
+  application.GetGlAbstraction().EnableSetUniformCallTrace( true );
+
+  Geometry geometry = CreateQuadGeometry();
+  Shader shader = Shader::New( "vertexSrc", "fragmentSrc" );
+  Renderer renderer = Renderer::New( geometry, shader );
+
+  Layer layer = Layer::New();
+  Stage::GetCurrent().Add( layer );
+
+  // The children are too big to be updated by a single task, so their children are spread over several tasks
+  std::vector< Actor > children;
+  std::vector< Actor > grandChildren;
+  for( int i = 0; i < 8; ++i )
+  {
+    Actor child = Actor::New();
+    child.SetOpacity( 0.5f );
+    child.SetPosition( Vector3( 10.0f * static_cast<float>( i ), 0.0f, 0.0f ) );
+    layer.Add( child );
+    children.push_back( child );
+
+    // The constraint depends on an ancestor only
+    Constraint constraint = Constraint::New< Vector3 >( child, Actor::Property::SCALE, EqualToConstraint() );
+    constraint.AddSource( ParentSource( Actor::Property::SCALE ) );
+    constraint.Apply();
+
+    for( int j = 0; j < 100; ++j )
+    {
+      Actor grandChild = Actor::New();
+      grandChild.SetSize( 10.0f, 10.0f );
+      grandChild.SetColor( Vector4( 1.0f, 0.5f, 1.0f, 1.0f ) );
+      grandChild.SetPosition( Vector3( 0.0f, static_cast<float>( j ), 0.0f ) );
+      if( j % 10 == 0 )
+      {
+        grandChild.AddRenderer( renderer );
+      }
+      else
+      {
+        grandChild.Add( Actor::New() );
+      }
+      child.Add( grandChild );
+      grandChildren.push_back( grandChild );
+    }
+  }
+  layer.SetScale( 2.0f );
+
+  application.SendNotification();
+  application.Render();
+  AddUpdateResults( grandChildren, application, results );
+
+  for( int frame = 0; frame < 4; ++frame )
+  {
+    // Change nodes in different subtrees of the worker threads, which report a deleted child and dirty flags
+    application.GetGlAbstraction().GetDrawTrace().Reset();
+    application.GetGlAbstraction().ResetSetUniformCallStack();
+    grandChildren[ frame * 10 ].SetPosition( Vector3( 5.0f, 5.0f * static_cast<float>( frame ), 0.0f ) );
+    grandChildren[ grandChildren.size() - 1u - frame ].SetColor( Vector4( 0.5f, 0.5f, 0.5f, 0.5f ) );
+    grandChildren[ 205 + frame ].GetChildAt( 0 ).Unparent();
+    if( frame == 3 )
+    {
+      grandChildren[ 400 ].SetVisible( false );
+      children[ frame ].SetOpacity( 1.0f );
+    }
+
+    application.SendNotification();
+    application.Render();
+    AddUpdateResults( grandChildren, application, results );
+  }
+}
+
+} // unnamed namespace
+
+int UtcDaliCoreSetUpdateThreadCount(void)
+{
+  tet_infoline("Testing Dali::Integration::Core::SetUpdateThreadCount, the subtrees updated by the worker threads get the same results as a serial update");
+
+  UpdateResults serialResults;
+  UpdateScene( 0u, serialResults );
+
+  UpdateResults parallelResults;
+  UpdateScene( 3u, parallelResults );
+
+  DALI_TEST_EQUALS( parallelResults.drawCounts.size(), serialResults.drawCounts.size(), TEST_LOCATION );
+  for( std::size_t i = 0u; i < serialResults.drawCounts.size(); ++i )
+  {
+    DALI_TEST_EQUALS( parallelResults.drawCounts[i], serialResults.drawCounts[i], TEST_LOCATION );
+    DALI_TEST_EQUALS( parallelResults.uniformTraces[i], serialResults.uniformTraces[i], TEST_LOCATION );
+  }
+
+  DALI_TEST_EQUALS( parallelResults.worldColors.size(), serialResults.worldColors.size(), TEST_LOCATION );
+  bool equal = true;
+  for( std::size_t i = 0u; i < serialResults.worldColors.size(); ++i )
+  {
+    equal = equal && ( parallelResults.worldColors[i] == serialResults.worldColors[i] ) &&
+                     ( parallelResults.worldMatrices[i] == serialResults.worldMatrices[i] );
+  }
+  DALI_TEST_CHECK( equal );
+
+  // The opacity and the scale are inherited through the subtrees
+  DALI_TEST_EQUALS( serialResults.worldColors[ 550 ], Vector4( 1.0f, 0.5f, 1.0f, 0.5f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( serialResults.worldMatrices[ 550 ].AsFloat()[0], 4.0f, TEST_LOCATION );
+
+  END_TEST;
+}
+
+namespace
+{
+
+const Integration::MemoryPoolStatistics* FindMemoryPool( const Dali::Vector< Integration::MemoryPoolStatistics >& statistics, const std::string& name )
+{
+  for( auto&& pool : statistics )
+  {
+    if( name == pool.name )
+    {
+      return &pool;
+    }
+  }
+  return NULL;
+}
+
+} // unnamed namespace
+
+int UtcDaliCoreTrimMemoryPools(void)
+{
+  TestApplication application;
+
+  tet_infoline( "Test that the memory of the scene-graph objects is released once they are destroyed" );
+
+  application.GetCore().TrimMemoryPools();
+
+  Dali::Vector< Integration::MemoryPoolStatistics > statistics;
+  application.GetCore().GetMemoryPoolStatistics( statistics );
+  DALI_TEST_EQUALS( statistics.Count(), 5u, TEST_LOCATION );
+  const Integration::MemoryPoolStatistics* nodes = FindMemoryPool( statistics, "Node" );
+  DALI_TEST_CHECK( nodes );
+  DALI_TEST_CHECK( FindMemoryPool( statistics, "Renderer" ) );
+  DALI_TEST_CHECK( nodes->liveObjects <= nodes->capacity );
+  const uint32_t liveNodes = nodes->liveObjects;
+  const uint32_t nodeBlocks = nodes->blockCount;
+
+  const uint32_t actorCount = 10000u;
+  std::vector< Actor > actors;
+  for( uint32_t i = 0u; i < actorCount; ++i )
+  {
+    Actor actor = Actor::New();
+    Stage::GetCurrent().Add( actor );
+    actors.push_back( actor );
+  }
+  application.SendNotification();
+  application.Render();
+
+  application.GetCore().GetMemoryPoolStatistics( statistics );
+  nodes = FindMemoryPool( statistics, "Node" );
+  DALI_TEST_EQUALS( nodes->liveObjects, liveNodes + actorCount, TEST_LOCATION );
+  DALI_TEST_CHECK( nodes->capacity >= nodes->liveObjects );
+  DALI_TEST_CHECK( nodes->blockCount > nodeBlocks );
+
+  // Nothing is released while the nodes are alive
+  DALI_TEST_EQUALS( application.GetCore().TrimMemoryPools(), 0u, TEST_LOCATION );
+
+  for( auto&& actor : actors )
+  {
+    Stage::GetCurrent().Remove( actor );
+  }
+  actors.clear();
+
+  // The nodes are discarded after the frames which may be rendering them
+  application.SendNotification();
+  application.Render();
+  application.Render();
+  application.Render();
+
+  application.GetCore().GetMemoryPoolStatistics( statistics );
+  nodes = FindMemoryPool( statistics, "Node" );
+  DALI_TEST_EQUALS( nodes->liveObjects, liveNodes, TEST_LOCATION );
+
+  DALI_TEST_CHECK( application.GetCore().TrimMemoryPools() > 0u );
+
+  application.GetCore().GetMemoryPoolStatistics( statistics );
+  nodes = FindMemoryPool( statistics, "Node" );
+  DALI_TEST_EQUALS( nodes->liveObjects, liveNodes, TEST_LOCATION );
+  DALI_TEST_CHECK( nodes->capacity < liveNodes + actorCount );
+
+  // The pool grows again as needed
+  Actor actor = Actor::New();
+  Stage::GetCurrent().Add( actor );
+  application.SendNotification();
+  application.Render();
+  application.GetCore().GetMemoryPoolStatistics( statistics );
+  DALI_TEST_EQUALS( FindMemoryPool( statistics, "Node" )->liveObjects, liveNodes + 1u, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -268,6 +268,63 @@ public:
   bool mBakeScaleCallSuccess{ false };
 };
 
+class FrameCallbackBatch : public FrameCallbackBasic
+{
+public:
+
+  FrameCallbackBatch( const std::vector< uint32_t >& actorIds )
+  : mActorIds( actorIds ),
+    mPositions( actorIds.size() ),
+    mSizes( actorIds.size() ),
+    mScales( actorIds.size() ),
+    mColors( actorIds.size() )
+  {
+  }
+
+  virtual void Update( Dali::UpdateProxy& updateProxy, float elapsedSeconds ) override
+  {
+    FrameCallbackBasic::Update( updateProxy, elapsedSeconds );
+
+    const uint32_t count = static_cast< uint32_t >( mActorIds.size() );
+    std::vector< Vector3 > positionsToSet;
+    std::vector< Vector3 > sizesToBake;
+    std::vector< Vector3 > scalesToSet;
+    std::vector< Vector4 > colorsToSet;
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      const float value = static_cast< float >( i + 1u );
+      positionsToSet.push_back( Vector3( value, value * 2.0f, value * 3.0f ) );
+      sizesToBake.push_back( Vector3( value * 10.0f, value * 20.0f, value * 30.0f ) );
+      scalesToSet.push_back( Vector3( value, value, value ) );
+      colorsToSet.push_back( Vector4( value * 0.1f, value * 0.2f, 0.0f, 1.0f ) );
+    }
+
+    mSetPositionsCount = updateProxy.SetPositions( mActorIds.data(), positionsToSet.data(), count );
+    mBakeSizesCount    = updateProxy.BakeSizes( mActorIds.data(), sizesToBake.data(), count );
+    mSetScalesCount    = updateProxy.SetScales( mActorIds.data(), scalesToSet.data(), count );
+    mSetColorsCount    = updateProxy.SetColors( mActorIds.data(), colorsToSet.data(), count );
+
+    mGetPositionsCount = updateProxy.GetPositions( mActorIds.data(), mPositions.data(), count );
+    mGetSizesCount     = updateProxy.GetSizes( mActorIds.data(), mSizes.data(), count );
+    mGetScalesCount    = updateProxy.GetScales( mActorIds.data(), mScales.data(), count );
+    mGetColorsCount    = updateProxy.GetColors( mActorIds.data(), mColors.data(), count );
+  }
+
+  const std::vector< uint32_t > mActorIds;
+  std::vector< Vector3 > mPositions;
+  std::vector< Vector3 > mSizes;
+  std::vector< Vector3 > mScales;
+  std::vector< Vector4 > mColors;
+  uint32_t mSetPositionsCount{ 0u };
+  uint32_t mBakeSizesCount{ 0u };
+  uint32_t mSetScalesCount{ 0u };
+  uint32_t mSetColorsCount{ 0u };
+  uint32_t mGetPositionsCount{ 0u };
+  uint32_t mGetSizesCount{ 0u };
+  uint32_t mGetScalesCount{ 0u };
+  uint32_t mGetColorsCount{ 0u };
+};
+
 } // anon namespace
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -449,6 +506,74 @@ int UtcDaliFrameCallbackBake(void)
 }
 
 
+int UtcDaliFrameCallbackBatch(void)
+{
+  // Test to see that the batch methods set and get the values of several actors, skipping invalid IDs
+
+  TestApplication application;
+  Stage stage = Stage::GetCurrent();
+
+  std::vector< uint32_t > actorIds;
+  std::vector< Actor > actors;
+  for( uint32_t i = 0u; i < 3u; ++i )
+  {
+    Actor actor = Actor::New();
+    actor.SetSize( 100.0f, 100.0f );
+    stage.Add( actor );
+    actors.push_back( actor );
+    actorIds.push_back( actor.GetId() );
+  }
+  actorIds.push_back( 10000u ); // Invalid ID
+
+  FrameCallbackBatch frameCallback( actorIds );
+  DevelStage::AddFrameCallback( stage, frameCallback, stage.GetRootLayer() );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( frameCallback.mCalled, true, TEST_LOCATION );
+  DALI_TEST_EQUALS( frameCallback.mSetPositionsCount, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frameCallback.mBakeSizesCount, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frameCallback.mSetScalesCount, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frameCallback.mSetColorsCount, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frameCallback.mGetPositionsCount, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frameCallback.mGetSizesCount, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frameCallback.mGetScalesCount, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( frameCallback.mGetColorsCount, 3u, TEST_LOCATION );
+
+  for( uint32_t i = 0u; i < 3u; ++i )
+  {
+    const float value = static_cast< float >( i + 1u );
+    DALI_TEST_EQUALS( frameCallback.mPositions[i], Vector3( value, value * 2.0f, value * 3.0f ), TEST_LOCATION );
+    DALI_TEST_EQUALS( frameCallback.mSizes[i], Vector3( value * 10.0f, value * 20.0f, value * 30.0f ), TEST_LOCATION );
+    DALI_TEST_EQUALS( frameCallback.mScales[i], Vector3( value, value, value ), TEST_LOCATION );
+    DALI_TEST_EQUALS( frameCallback.mColors[i], Vector4( value * 0.1f, value * 0.2f, 0.0f, 1.0f ), TEST_LOCATION );
+  }
+
+  // The entries for the invalid ID are left untouched
+  DALI_TEST_EQUALS( frameCallback.mPositions[3], Vector3::ZERO, TEST_LOCATION );
+  DALI_TEST_EQUALS( frameCallback.mColors[3], Vector4::ZERO, TEST_LOCATION );
+
+  // Only the baked sizes remain after removing the callback
+  DevelStage::RemoveFrameCallback( stage, frameCallback );
+
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+  application.Render();
+
+  for( uint32_t i = 0u; i < 3u; ++i )
+  {
+    const float value = static_cast< float >( i + 1u );
+    DALI_TEST_EQUALS( actors[i].GetCurrentProperty( Actor::Property::SIZE ).Get< Vector3 >(), Vector3( value * 10.0f, value * 20.0f, value * 30.0f ), TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentProperty( Actor::Property::POSITION ).Get< Vector3 >(), Vector3::ZERO, TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentProperty( Actor::Property::SCALE ).Get< Vector3 >(), Vector3::ONE, TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentProperty( Actor::Property::COLOR ).Get< Vector4 >(), Color::WHITE, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
 int UtcDaliFrameCallbackMultipleActors(void)
 {
   /**
@@ -666,6 +791,46 @@ int UtcDaliFrameCallbackInvalidActorId(void)
   END_TEST;
 }
 
+int UtcDaliFrameCallbackActorOutsideRoot(void)
+{
+  // Test to ensure that actors on the stage, but not in the tree of the frame-callback's root, can't be used.
+
+  TestApplication application;
+  Stage stage = Stage::GetCurrent();
+
+  Actor root = Actor::New();
+  stage.Add( root );
+
+  Actor sibling = Actor::New();
+  sibling.SetSize( 200, 300 );
+  stage.Add( sibling );
+
+  FrameCallbackActorIdCheck frameCallback( sibling.GetId() );
+  DevelStage::AddFrameCallback( stage, frameCallback, root );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( frameCallback.mCalled,                 true,  TEST_LOCATION );
+  DALI_TEST_EQUALS( frameCallback.mGetSizeCallSuccess,     false, TEST_LOCATION );
+  DALI_TEST_EQUALS( frameCallback.mGetPositionCallSuccess, false, TEST_LOCATION );
+  DALI_TEST_EQUALS( frameCallback.mSetColorCallSuccess,    false, TEST_LOCATION );
+
+  // Once it's moved into the tree of the root, it can be used
+  root.Add( sibling );
+  frameCallback.Reset();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( frameCallback.mCalled,                 true, TEST_LOCATION );
+  DALI_TEST_EQUALS( frameCallback.mGetSizeCallSuccess,     true, TEST_LOCATION );
+  DALI_TEST_EQUALS( frameCallback.mGetPositionCallSuccess, true, TEST_LOCATION );
+  DALI_TEST_EQUALS( frameCallback.mSetColorCallSuccess,    true, TEST_LOCATION );
+
+  END_TEST;
+}
+
 int UtcDaliFrameCallbackActorRemovedAndAdded(void)
 {
   // Test to ensure that we do not call methods on actors that have been removed on the stage
@@ -18,12 +18,16 @@
 // EXTERNAL INCLUDES
 #include <dali/devel-api/actors/actor-devel.h>
 #include <dali/devel-api/rendering/renderer-devel.h>
+#include <dali/devel-api/rendering/shader-devel.h>
 
 #include <dali/public-api/dali-core.h>
 #include <dali/devel-api/images/texture-set-image.h>
 #include <dali/integration-api/render-task-list-integ.h>
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <string>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali-test-suite-utils.h>
@@ -319,6 +323,292 @@ int UtcDaliRendererSetGetShader(void)
   END_TEST;
 }
 
+int UtcDaliRendererUniformMapSharedBetweenActors(void)
+{
+  TestApplication application;
+  tet_infoline( "Test a renderer shared between actors uses the uniforms of each actor" );
+
+  Shader shader = CreateShader();
+  Geometry geometry = CreateQuadGeometry();
+  Renderer renderer = Renderer::New( geometry, shader );
+  renderer.RegisterProperty( "uActorValue", 0.0f );
+
+  Actor actorA = Actor::New();
+  actorA.SetSize( 400, 400 );
+  actorA.RegisterProperty( "uActorValue", 1.0f );
+  actorA.AddRenderer( renderer );
+  Stage::GetCurrent().Add( actorA );
+
+  Actor actorB = Actor::New();
+  actorB.SetSize( 400, 400 );
+  actorB.RegisterProperty( "uActorValue", 2.0f );
+  actorB.AddRenderer( renderer );
+  Stage::GetCurrent().Add( actorB );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableSetUniformCallTrace( true );
+  TraceCallStack& uniformTrace = gl.GetSetUniformTrace();
+
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    uniformTrace.Reset();
+    application.SendNotification();
+    application.Render(0);
+
+    DALI_TEST_CHECK( uniformTrace.FindMethodAndParams( "uActorValue", "1" ) );
+    DALI_TEST_CHECK( uniformTrace.FindMethodAndParams( "uActorValue", "2" ) );
+    DALI_TEST_CHECK( !uniformTrace.FindMethodAndParams( "uActorValue", "0" ) );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRendererUniformMapSharedBetweenManyActors(void)
+{
+  TestApplication application;
+  tet_infoline( "Test a renderer shared between more actors than it keeps the uniforms of uses the uniforms of each actor" );
+
+  Shader shader = CreateShader();
+  Geometry geometry = CreateQuadGeometry();
+  Renderer renderer = Renderer::New( geometry, shader );
+  renderer.RegisterProperty( "uActorValue", 0.0f );
+
+  const int actorCount = 40;
+  std::vector< Actor > actors;
+  for( int i = 0; i < actorCount; ++i )
+  {
+    Actor actor = Actor::New();
+    actor.SetSize( 400, 400 );
+    actor.RegisterProperty( "uActorValue", static_cast<float>( i + 1 ) );
+    actor.AddRenderer( renderer );
+    Stage::GetCurrent().Add( actor );
+    actors.push_back( actor );
+  }
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableSetUniformCallTrace( true );
+  TraceCallStack& uniformTrace = gl.GetSetUniformTrace();
+
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    uniformTrace.Reset();
+    application.SendNotification();
+    application.Render(0);
+
+    for( int i = 0; i < actorCount; ++i )
+    {
+      std::stringstream value;
+      value << ( i + 1 );
+      DALI_TEST_CHECK( uniformTrace.FindMethodAndParams( "uActorValue", value.str() ) );
+    }
+    DALI_TEST_CHECK( !uniformTrace.FindMethodAndParams( "uActorValue", "0" ) );
+  }
+
+  // A changed value of one actor is set, and the others still use their own
+  actors[5].SetProperty( actors[5].GetPropertyIndex( "uActorValue" ), 100.0f );
+
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    uniformTrace.Reset();
+    application.SendNotification();
+    application.Render(0);
+
+    DALI_TEST_CHECK( uniformTrace.FindMethodAndParams( "uActorValue", "100" ) );
+    DALI_TEST_CHECK( !uniformTrace.FindMethodAndParams( "uActorValue", "6" ) );
+    DALI_TEST_CHECK( uniformTrace.FindMethodAndParams( "uActorValue", "5" ) );
+    DALI_TEST_CHECK( uniformTrace.FindMethodAndParams( "uActorValue", "7" ) );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRendererUnchangedUniformsNotSetAgain(void)
+{
+  TestApplication application;
+  tet_infoline( "Test the uniforms which haven't changed since the renderer set them aren't set again" );
+
+  Shader shader = CreateShader();
+  Geometry geometry = CreateQuadGeometry();
+  Renderer renderer = Renderer::New( geometry, shader );
+
+  Matrix matrix;
+  matrix.SetIdentityAndScale( Vector3( 2.0f, 2.0f, 2.0f ) );
+
+  Actor actor = Actor::New();
+  actor.SetSize( 400, 400 );
+  Property::Index matrixIndex = actor.RegisterProperty( "uCustomMatrix", matrix );
+  actor.AddRenderer( renderer );
+  Stage::GetCurrent().Add( actor );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableSetUniformCallTrace( true );
+  TraceCallStack& uniformTrace = gl.GetSetUniformTrace();
+
+  // The value is set while the property may differ between the frames
+  uniformTrace.Reset();
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_CHECK( uniformTrace.FindMethod( "uCustomMatrix" ) );
+
+  application.SendNotification();
+  application.Render(0);
+  application.SendNotification();
+  application.Render(0);
+
+  // The matrix uniforms aren't cached by the program, so the value would be set every frame
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    uniformTrace.Reset();
+    application.SendNotification();
+    application.Render(0);
+    DALI_TEST_CHECK( !uniformTrace.FindMethod( "uCustomMatrix" ) );
+  }
+
+  matrix.SetIdentityAndScale( Vector3( 3.0f, 3.0f, 3.0f ) );
+  actor.SetProperty( matrixIndex, matrix );
+
+  uniformTrace.Reset();
+  application.SendNotification();
+  application.Render(0);
+  DALI_TEST_CHECK( uniformTrace.FindMethod( "uCustomMatrix" ) );
+
+  Matrix actual;
+  DALI_TEST_CHECK( gl.GetUniformValue<Matrix>( "uCustomMatrix", actual ) );
+  DALI_TEST_EQUALS( actual, matrix, TEST_LOCATION );
+
+  // Another renderer of the same program changes the value, so each renderer sets its own every frame
+  Renderer otherRenderer = Renderer::New( geometry, shader );
+  Actor otherActor = Actor::New();
+  otherActor.SetSize( 400, 400 );
+  otherActor.RegisterProperty( "uCustomMatrix", Matrix::IDENTITY );
+  otherActor.AddRenderer( otherRenderer );
+  Stage::GetCurrent().Add( otherActor );
+  application.SendNotification();
+  application.Render(0);
+
+  for( int frame = 0; frame < 5; ++frame )
+  {
+    uniformTrace.Reset();
+    application.SendNotification();
+    application.Render(0);
+    DALI_TEST_EQUALS( uniformTrace.CountMethod( "uCustomMatrix" ), 2, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRendererUniformBlocks(void)
+{
+  TestApplication application;
+  tet_infoline( "Test the uniforms of a uniform block are written to a uniform buffer instead of being set" );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  TestGlAbstraction::UniformBlockMembers members;
+  members.push_back( std::make_pair( std::string( "uColor" ), GLenum( GL_FLOAT_VEC4 ) ) );
+  members.push_back( std::make_pair( std::string( "uMvpMatrix" ), GLenum( GL_FLOAT_MAT4 ) ) );
+  members.push_back( std::make_pair( std::string( "uCustom" ), GLenum( GL_FLOAT ) ) );
+  gl.SetUniformBlockMembers( members );
+
+  Shader shader = Shader::New( "#version 300 es\nVertexSource: this can be whatever", "#version 300 es\nFragmentSource: this can be whatever" );
+  Geometry geometry = CreateQuadGeometry();
+  Renderer renderer = Renderer::New( geometry, shader );
+
+  Actor actor = Actor::New();
+  actor.SetSize( 400, 400 );
+  actor.SetColor( Vector4( 1.0f, 0.5f, 0.25f, 1.0f ) );
+  actor.RegisterProperty( "uCustom", 0.75f );
+  actor.AddRenderer( renderer );
+  Stage::GetCurrent().Add( actor );
+
+  gl.EnableSetUniformCallTrace( true );
+  gl.EnableBufferCallTrace( true );
+  TraceCallStack& uniformTrace = gl.GetSetUniformTrace();
+  TraceCallStack& bufferTrace = gl.GetBufferTrace();
+
+  for( int frame = 0; frame < 2; ++frame )
+  {
+    uniformTrace.Reset();
+    bufferTrace.Reset();
+    application.SendNotification();
+    application.Render(0);
+
+    // The block is bound once for the draw, and its uniforms aren't set one by one
+    DALI_TEST_EQUALS( bufferTrace.CountMethod( "BindBufferRange" ), 1, TEST_LOCATION );
+    DALI_TEST_CHECK( !uniformTrace.FindMethod( "uColor" ) );
+    DALI_TEST_CHECK( !uniformTrace.FindMethod( "uCustom" ) );
+
+    const std::vector<unsigned char>& data = gl.GetLastUniformBufferData();
+    DALI_TEST_EQUALS( data.size(), 3u * 64u, TEST_LOCATION );
+
+    Vector4 color;
+    memcpy( color.AsFloat(), &data[0], sizeof( color ) );
+    DALI_TEST_EQUALS( color, Vector4( 1.0f, 0.5f, 0.25f, 1.0f ), TEST_LOCATION );
+
+    float custom = 0.0f;
+    memcpy( &custom, &data[128], sizeof( custom ) );
+    DALI_TEST_EQUALS( custom, 0.75f, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+namespace
+{
+
+void SetConstantColor( Vector4& current, const PropertyInputContainer& /* inputs */ )
+{
+  current = Color::BLUE;
+}
+
+} // unnamed namespace
+
+int UtcDaliRendererUniformSetWhileUpdatingNextFrame(void)
+{
+  TestApplication application;
+  tet_infoline( "Test a uniform changed by the update of the next frame is still set when that frame is rendered" );
+
+  Shader shader = CreateShader();
+  Geometry geometry = CreateQuadGeometry();
+  Renderer renderer = Renderer::New( geometry, shader );
+
+  Actor actor = Actor::New();
+  actor.SetSize( 400, 400 );
+  Property::Index colorIndex = actor.RegisterProperty( "uFadeColor", Color::RED );
+  actor.AddRenderer( renderer );
+  Stage::GetCurrent().Add( actor );
+
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    application.SendNotification();
+    application.Render(0);
+  }
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  Vector4 actual;
+  DALI_TEST_CHECK( gl.GetUniformValue<Vector4>( "uFadeColor", actual ) );
+  DALI_TEST_EQUALS( actual, Color::RED, TEST_LOCATION );
+
+  // The constraint sets the value in the buffer of the next frame, while the previous frame is yet to be rendered
+  application.SendNotification();
+  application.UpdateOnly(0);
+
+  Constraint constraint = Constraint::New<Vector4>( actor, colorIndex, SetConstantColor );
+  constraint.SetRemoveAction( Constraint::Discard );
+  constraint.Apply();
+  application.SendNotification();
+  application.UpdateOnly(0);
+
+  application.RenderOnly();
+  DALI_TEST_CHECK( gl.GetUniformValue<Vector4>( "uFadeColor", actual ) );
+  DALI_TEST_EQUALS( actual, Color::RED, TEST_LOCATION );
+
+  application.RenderOnly();
+  DALI_TEST_CHECK( gl.GetUniformValue<Vector4>( "uFadeColor", actual ) );
+  DALI_TEST_EQUALS( actual, Color::BLUE, TEST_LOCATION );
+
+  END_TEST;
+}
+
 int UtcDaliRendererSetGetDepthIndex(void)
 {
   TestApplication application;
@@ -1924,6 +2214,617 @@ int UtcDaliRendererRenderOrder2DLayerOverlay(void)
   END_TEST;
 }
 
+int UtcDaliRendererRenderOrder2DLayerManyRenderers(void)
+{
+  TestApplication application;
+  tet_infoline("Test the rendering order in a 2D layer is correct when there are many renderers");
+
+  Shader shader = Shader::New("VertexSource", "FragmentSource");
+  Geometry geometry = CreateQuadGeometry();
+  Actor root = Stage::GetCurrent().GetRootLayer();
+
+  // Give the renderers a shuffled depth index, so renderer i is rendered in position ( i * 37 ) % 100
+  const int rendererCount = 100;
+  Actor actor = CreateActor( root, 0, TEST_LOCATION );
+  std::vector< Renderer > renderers;
+  for( int i = 0; i < rendererCount; ++i )
+  {
+    renderers.push_back( CreateRenderer( actor, geometry, shader, ( i * 37 ) % rendererCount ) );
+  }
+
+  application.SendNotification();
+  application.Render(0);
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableTextureCallTrace(true);
+  application.SendNotification();
+  application.Render(0);
+
+  std::vector< int > textureBindIndex( rendererCount );
+  for( int i = 0; i < rendererCount; ++i )
+  {
+    std::stringstream params;
+    params << GL_TEXTURE_2D<<", "<<i+1;
+    textureBindIndex[ ( i * 37 ) % rendererCount ] = gl.GetTextureTrace().FindIndexFromMethodAndParams("BindTexture", params.str() );
+  }
+
+  //Check that the renderers have been rendered in the order of their depth index
+  for( int depthIndex = 1; depthIndex < rendererCount; ++depthIndex )
+  {
+    DALI_TEST_GREATER( textureBindIndex[depthIndex], textureBindIndex[depthIndex - 1], TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRendererRenderOrder3DLayerManyRenderers(void)
+{
+  TestApplication application;
+  tet_infoline("Test the rendering order of transparent renderers in a 3D layer is correct when there are many renderers");
+
+  Shader shader = Shader::New("VertexSource", "FragmentSource");
+  Geometry geometry = CreateQuadGeometry();
+  Actor root = Stage::GetCurrent().GetRootLayer();
+  Stage::GetCurrent().GetRootLayer().SetBehavior( Layer::LAYER_3D );
+
+  // Shuffle the Z positions, so renderer i is rendered in position ( i * 37 ) % 100 from the furthest
+  const int rendererCount = 100;
+  std::vector< Renderer > renderers;
+  for( int i = 0; i < rendererCount; ++i )
+  {
+    Actor actor = CreateActor( root, 0, TEST_LOCATION );
+    actor.SetPosition( 0.0f, 0.0f, static_cast<float>( ( i * 37 ) % rendererCount ) );
+    actor.SetOpacity( 0.5f );
+    renderers.push_back( CreateRenderer( actor, geometry, shader, 0 ) );
+  }
+
+  application.SendNotification();
+  application.Render(0);
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableTextureCallTrace(true);
+  application.SendNotification();
+  application.Render(0);
+
+  std::vector< int > textureBindIndex( rendererCount );
+  for( int i = 0; i < rendererCount; ++i )
+  {
+    std::stringstream params;
+    params << GL_TEXTURE_2D<<", "<<i+1;
+    textureBindIndex[ ( i * 37 ) % rendererCount ] = gl.GetTextureTrace().FindIndexFromMethodAndParams("BindTexture", params.str() );
+  }
+
+  //Check that the renderers have been rendered from the furthest to the closest
+  for( int position = 1; position < rendererCount; ++position )
+  {
+    DALI_TEST_GREATER( textureBindIndex[position], textureBindIndex[position - 1], TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRendererRenderOrderGroupsTextureSets(void)
+{
+  TestApplication application;
+  tet_infoline("Test the renderers of the same depth index are grouped by texture set, however many there are");
+
+  Shader shader = Shader::New("VertexSource", "FragmentSource");
+  Geometry geometry = CreateQuadGeometry();
+  Actor root = Stage::GetCurrent().GetRootLayer();
+
+  const int textureSetCount = 3;
+  std::vector< TextureSet > textureSets;
+  for( int i = 0; i < textureSetCount; ++i )
+  {
+    textureSets.push_back( CreateTextureSet( BufferImage::New( 64, 64, Pixel::RGB888 ) ) );
+  }
+
+  // Many other texture sets are created and destroyed, so the texture sets aren't allocated next to each other
+  for( int i = 0; i < 200; ++i )
+  {
+    TextureSet other = TextureSet::New();
+  }
+
+  const int rendererCount = 30;
+  Actor actor = CreateActor( root, 0, TEST_LOCATION );
+  std::vector< Renderer > renderers;
+  for( int i = 0; i < rendererCount; ++i )
+  {
+    Renderer renderer = Renderer::New( geometry, shader );
+    renderer.SetTextures( textureSets[ i % textureSetCount ] );
+    actor.AddRenderer( renderer );
+    renderers.push_back( renderer );
+  }
+
+  application.SendNotification();
+  application.Render(0);
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableTextureCallTrace(true);
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    gl.GetTextureTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+
+    //Check that the renderers using a texture are drawn one after the other, so the binds of the textures don't overlap
+    std::vector< std::pair< size_t, size_t > > bindRanges;
+    for( int i = 0; i < textureSetCount; ++i )
+    {
+      std::stringstream params;
+      params << GL_TEXTURE_2D << ", " << i + 1;
+      size_t index = 0u;
+      DALI_TEST_CHECK( gl.GetTextureTrace().FindMethodAndParamsFromStartIndex( "BindTexture", params.str(), index ) );
+      std::pair< size_t, size_t > range( index, index );
+      for( ++index; gl.GetTextureTrace().FindMethodAndParamsFromStartIndex( "BindTexture", params.str(), index ); ++index )
+      {
+        range.second = index;
+      }
+      bindRanges.push_back( range );
+    }
+    std::sort( bindRanges.begin(), bindRanges.end() );
+    for( int i = 1; i < textureSetCount; ++i )
+    {
+      DALI_TEST_GREATER( bindRanges[i].first, bindRanges[i - 1].second, TEST_LOCATION );
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRendererRenderOrder3DLayerNearlyEqualZ(void)
+{
+  TestApplication application;
+  tet_infoline("Test transparent renderers in a 3D layer whose Z values are within the epsilon of their comparison are ordered as if they were equal");
+
+  Shader shader = Shader::New("VertexSource", "FragmentSource");
+  Geometry geometry = CreateQuadGeometry();
+  Actor root = Stage::GetCurrent().GetRootLayer();
+  Stage::GetCurrent().GetRootLayer().SetBehavior( Layer::LAYER_3D );
+
+  // The actors are about 2500 units from the camera, where the epsilon of the comparison is a few units in the last place
+  const float z = -903.7f;
+  Actor actor0 = CreateActor( root, 0, TEST_LOCATION );
+  actor0.SetPosition( 0.0f, 0.0f, z );
+  actor0.SetOpacity( 0.5f );
+  CreateRenderer( actor0, geometry, shader, 0 );
+  Actor actor1 = CreateActor( root, 0, TEST_LOCATION );
+  actor1.SetPosition( 0.0f, 0.0f, z );
+  actor1.SetOpacity( 0.5f );
+  CreateRenderer( actor1, geometry, shader, 0 );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableTextureCallTrace(true);
+
+  auto isActor0DrawnFirst = [&]()
+  {
+    gl.GetTextureTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+
+    std::stringstream params0;
+    params0 << GL_TEXTURE_2D << ", " << 1;
+    std::stringstream params1;
+    params1 << GL_TEXTURE_2D << ", " << 2;
+    return gl.GetTextureTrace().FindIndexFromMethodAndParams( "BindTexture", params0.str() ) <
+           gl.GetTextureTrace().FindIndexFromMethodAndParams( "BindTexture", params1.str() );
+  };
+
+  application.SendNotification();
+  application.Render(0);
+  const bool isActor0DrawnFirstAtEqualZ = isActor0DrawnFirst();
+
+  actor1.SetPosition( 0.0f, 0.0f, z + 0.00025f );
+  DALI_TEST_EQUALS( isActor0DrawnFirst(), isActor0DrawnFirstAtEqualZ, TEST_LOCATION );
+
+  actor1.SetPosition( 0.0f, 0.0f, z - 0.00025f );
+  DALI_TEST_EQUALS( isActor0DrawnFirst(), isActor0DrawnFirstAtEqualZ, TEST_LOCATION );
+
+  // Further apart, the furthest renderer is drawn first
+  actor1.SetPosition( 0.0f, 0.0f, z + 1.0f );
+  DALI_TEST_EQUALS( isActor0DrawnFirst(), true, TEST_LOCATION );
+
+  actor1.SetPosition( 0.0f, 0.0f, z - 1.0f );
+  DALI_TEST_EQUALS( isActor0DrawnFirst(), false, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRendererRenderOrder2DLayerMovingRenderers(void)
+{
+  TestApplication application;
+  tet_infoline("Test the rendering order in a 2D layer is correct when a few renderers move and change depth index every frame");
+
+  Shader shader = Shader::New("VertexSource", "FragmentSource");
+  Geometry geometry = CreateQuadGeometry();
+  Actor root = Stage::GetCurrent().GetRootLayer();
+
+  // The depth index of the renderers is larger than the one of the actors
+  const int rendererCount = 20;
+  const int depthIndexStep = 100000;
+  std::vector< Actor > actors;
+  std::vector< Renderer > renderers;
+  std::vector< int > depthIndices;
+  for( int i = 0; i < rendererCount; ++i )
+  {
+    actors.push_back( CreateActor( root, 0, TEST_LOCATION ) );
+    depthIndices.push_back( ( ( i * 7 ) % rendererCount ) * depthIndexStep );
+    renderers.push_back( CreateRenderer( actors.back(), geometry, shader, depthIndices.back() ) );
+  }
+
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    application.SendNotification();
+    application.Render(0);
+  }
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableTextureCallTrace(true);
+  for( int frame = 0; frame < 6; ++frame )
+  {
+    // Move an actor and swap the depth index of two renderers
+    actors[ frame ].SetX( static_cast<float>( frame + 1 ) );
+    std::swap( depthIndices[ frame ], depthIndices[ frame + 5 ] );
+    renderers[ frame ].SetProperty( Renderer::Property::DEPTH_INDEX, depthIndices[ frame ] );
+    renderers[ frame + 5 ].SetProperty( Renderer::Property::DEPTH_INDEX, depthIndices[ frame + 5 ] );
+
+    gl.GetTextureTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+
+    std::vector< int > textureBindIndex( rendererCount );
+    for( int i = 0; i < rendererCount; ++i )
+    {
+      std::stringstream params;
+      params << GL_TEXTURE_2D<<", "<<i+1;
+      textureBindIndex[ depthIndices[ i ] / depthIndexStep ] = gl.GetTextureTrace().FindIndexFromMethodAndParams("BindTexture", params.str() );
+    }
+
+    //Check that the renderers have been rendered in the order of their depth index
+    for( int position = 1; position < rendererCount; ++position )
+    {
+      DALI_TEST_GREATER( textureBindIndex[position], textureBindIndex[position - 1], TEST_LOCATION );
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRendererCulledWhenMovedOutOfView(void)
+{
+  TestApplication application;
+  tet_infoline("Test a renderer is not drawn once its actor moves out of view while the other renderers are static");
+
+  Shader shader = Shader::New("VertexSource", "FragmentSource");
+  Geometry geometry = CreateQuadGeometry();
+  Actor root = Stage::GetCurrent().GetRootLayer();
+
+  std::vector< Actor > actors;
+  for( int i = 0; i < 3; ++i )
+  {
+    actors.push_back( CreateActor( root, 0, TEST_LOCATION ) );
+    CreateRenderer( actors.back(), geometry, shader, 0 );
+  }
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableDrawCallTrace(true);
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    gl.GetDrawTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+  }
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 3, TEST_LOCATION );
+
+  actors[1].SetX( 100000.0f );
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    gl.GetDrawTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+    DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 2, TEST_LOCATION );
+  }
+
+  actors[1].SetX( 0.0f );
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    gl.GetDrawTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+    DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 3, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRendererCulledWhenCameraChanged(void)
+{
+  TestApplication application;
+  tet_infoline("Test the renderers in view are drawn when only the camera changes while an actor is animated");
+
+  Shader shader = Shader::New("VertexSource", "FragmentSource");
+  Geometry geometry = CreateQuadGeometry();
+  Actor root = Stage::GetCurrent().GetRootLayer();
+
+  // A moving actor in the middle of the view, and static actors near its side
+  Actor moving = CreateActor( root, 0, TEST_LOCATION );
+  CreateRenderer( moving, geometry, shader, 0 );
+  for( int i = 0; i < 3; ++i )
+  {
+    Actor actor = CreateActor( root, 0, TEST_LOCATION );
+    actor.SetPosition( 200.0f, static_cast<float>( i ) * 100.0f );
+    CreateRenderer( actor, geometry, shader, 0 );
+  }
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableDrawCallTrace(true);
+  float y = 0.0f;
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    moving.SetY( y += 1.0f );
+    gl.GetDrawTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+  }
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 4, TEST_LOCATION );
+
+  // Narrowing the projection puts the static actors out of view
+  CameraActor camera = Stage::GetCurrent().GetRenderTaskList().GetTask( 0u ).GetCameraActor();
+  const float fieldOfView = camera.GetFieldOfView();
+  camera.SetFieldOfView( fieldOfView * 0.25f );
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    moving.SetY( y += 1.0f );
+    gl.GetDrawTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+    DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 1, TEST_LOCATION );
+  }
+
+  camera.SetFieldOfView( fieldOfView );
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    moving.SetY( y += 1.0f );
+    gl.GetDrawTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+    DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 4, TEST_LOCATION );
+  }
+
+  // Moving the camera away puts all the actors out of view
+  camera.SetX( camera.GetCurrentPosition().x + 100000.0f );
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    moving.SetY( y += 1.0f );
+    gl.GetDrawTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+    DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 0, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRendererCulledInLargeLayer(void)
+{
+  TestApplication application;
+  tet_infoline("Test only the renderers in view are drawn in a layer with many renderers, as they move and are added");
+
+  Shader shader = Shader::New("VertexSource", "FragmentSource");
+  Geometry geometry = CreateQuadGeometry();
+  Actor root = Stage::GetCurrent().GetRootLayer();
+
+  // Every other actor is out of view
+  std::vector< Actor > actors;
+  for( int i = 0; i < 200; ++i )
+  {
+    actors.push_back( CreateActor( root, 0, TEST_LOCATION ) );
+    actors.back().SetPosition( ( i % 2 ) ? 100000.0f : 0.0f, static_cast<float>( i ) );
+    CreateRenderer( actors.back(), geometry, shader, 0 );
+  }
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableDrawCallTrace(true);
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    gl.GetDrawTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+    DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 100, TEST_LOCATION );
+  }
+
+  // Moving actors in and out of view
+  actors[1].SetX( 0.0f );
+  actors[100].SetX( -100000.0f );
+  actors[151].SetX( 0.0f );
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    gl.GetDrawTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+    DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 101, TEST_LOCATION );
+  }
+
+  // Adding actors in and out of view
+  Actor inView = CreateActor( root, 0, TEST_LOCATION );
+  CreateRenderer( inView, geometry, shader, 0 );
+  Actor outOfView = CreateActor( root, 0, TEST_LOCATION );
+  outOfView.SetY( 100000.0f );
+  CreateRenderer( outOfView, geometry, shader, 0 );
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    gl.GetDrawTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+    DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 102, TEST_LOCATION );
+  }
+
+  // Removing actors until the layer is culled without the hierarchy, and adding them back
+  for( int i = 0; i < 150; ++i )
+  {
+    actors[i].Unparent();
+  }
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    gl.GetDrawTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+    DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 27, TEST_LOCATION );
+  }
+
+  for( int i = 0; i < 150; ++i )
+  {
+    root.Add( actors[i] );
+  }
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    gl.GetDrawTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+    DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 102, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliRendererDrawInstanced(void)
+{
+  TestApplication application;
+  tet_infoline("Test consecutive renderers sharing an instanced shader, geometry and textures are drawn by one instanced draw call");
+
+  Shader shader = Shader::New( "VertexSource", "FragmentSource", static_cast< Shader::Hint::Value >( DevelShader::Hint::DRAW_INSTANCED ) );
+  Geometry geometry = CreateQuadGeometry();
+  TextureSet textureSet = CreateTextureSet( BufferImage::New( 64, 64, Pixel::RGB888 ) );
+  Actor root = Stage::GetCurrent().GetRootLayer();
+
+  std::vector< Renderer > renderers;
+  for( int i = 0; i < 10; ++i )
+  {
+    Actor actor = CreateActor( root, 0, TEST_LOCATION );
+    actor.SetX( static_cast<float>( i ) );
+    actor.SetColor( Vector4( 0.1f * static_cast<float>( i ), 0.0f, 0.0f, 1.0f ) );
+    renderers.push_back( Renderer::New( geometry, shader ) );
+    renderers.back().SetTextures( textureSet );
+    actor.AddRenderer( renderers.back() );
+  }
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.EnableDrawCallTrace(true);
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    gl.GetDrawTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+  }
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElementsInstanced" ), 1, TEST_LOCATION );
+
+  TraceCallStack::NamedParams params;
+  params["instanceCount"] = "10";
+  DALI_TEST_CHECK( gl.GetDrawTrace().FindMethodAndParams( "DrawElementsInstanced", params ) );
+
+  // A renderer with its own uniforms splits the draw call
+  renderers[4].RegisterProperty( "uCustom", 1.0f );
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    gl.GetDrawTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+  }
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElementsInstanced" ), 3, TEST_LOCATION );
+
+  params["instanceCount"] = "4";
+  DALI_TEST_CHECK( gl.GetDrawTrace().FindMethodAndParams( "DrawElementsInstanced", params ) );
+  params["instanceCount"] = "1";
+  DALI_TEST_CHECK( gl.GetDrawTrace().FindMethodAndParams( "DrawElementsInstanced", params ) );
+  params["instanceCount"] = "5";
+  DALI_TEST_CHECK( gl.GetDrawTrace().FindMethodAndParams( "DrawElementsInstanced", params ) );
+
+  END_TEST;
+}
+
+int UtcDaliRendererDrawInstancedFallback(void)
+{
+  TestApplication application;
+  tet_infoline("Test instanced renderers are drawn one at a time when the context can't draw instances");
+
+  // An OpenGL ES 2.0 context without the instanced arrays extension
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.SetGetStringResult( GL_VERSION, "OpenGL ES 2.0" );
+  application.GetCore().ContextDestroyed();
+  application.GetCore().ContextCreated();
+
+  Shader shader = Shader::New( "VertexSource", "FragmentSource", static_cast< Shader::Hint::Value >( DevelShader::Hint::DRAW_INSTANCED ) );
+  Geometry geometry = CreateQuadGeometry();
+  TextureSet textureSet = CreateTextureSet( BufferImage::New( 64, 64, Pixel::RGB888 ) );
+  Actor root = Stage::GetCurrent().GetRootLayer();
+
+  for( int i = 0; i < 10; ++i )
+  {
+    Actor actor = CreateActor( root, 0, TEST_LOCATION );
+    actor.SetX( static_cast<float>( i ) );
+    actor.SetColor( Vector4( 0.0f, 0.0f, 0.1f * static_cast<float>( i ), 1.0f ) );
+    Renderer renderer = Renderer::New( geometry, shader );
+    renderer.SetTextures( textureSet );
+    actor.AddRenderer( renderer );
+  }
+
+  gl.EnableDrawCallTrace(true);
+  gl.EnableBufferCallTrace(true);
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    gl.GetDrawTrace().Reset();
+    gl.GetBufferTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+  }
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 10, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElementsInstanced" ), 0, TEST_LOCATION );
+
+  // The model matrix and color attributes of each item are set to constant values instead
+  DALI_TEST_EQUALS( gl.GetBufferTrace().CountMethod( "VertexAttrib4fv" ), 50, TEST_LOCATION );
+  DALI_TEST_CHECK( gl.GetBufferTrace().FindMethodAndParams( "VertexAttrib4fv", "0, 0, 0, 0.5, 1" ) );
+
+  END_TEST;
+}
+
+int UtcDaliRendererDrawInstancedExtension(void)
+{
+  TestApplication application;
+  tet_infoline("Test instanced renderers are drawn by one instanced draw call when an OpenGL ES 2.0 context has the instanced arrays extension");
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.SetGetStringResult( GL_VERSION, "OpenGL ES 2.0" );
+  gl.SetGetStringResult( GL_EXTENSIONS, "GL_OES_texture_npot GL_EXT_instanced_arrays" );
+  application.GetCore().ContextDestroyed();
+  application.GetCore().ContextCreated();
+
+  Shader shader = Shader::New( "VertexSource", "FragmentSource", static_cast< Shader::Hint::Value >( DevelShader::Hint::DRAW_INSTANCED ) );
+  Geometry geometry = CreateQuadGeometry();
+  Actor root = Stage::GetCurrent().GetRootLayer();
+
+  for( int i = 0; i < 10; ++i )
+  {
+    Actor actor = CreateActor( root, 0, TEST_LOCATION );
+    actor.SetX( static_cast<float>( i ) );
+    Renderer renderer = Renderer::New( geometry, shader );
+    actor.AddRenderer( renderer );
+  }
+
+  gl.EnableDrawCallTrace(true);
+  for( int frame = 0; frame < 3; ++frame )
+  {
+    gl.GetDrawTrace().Reset();
+    application.SendNotification();
+    application.Render(0);
+  }
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElements" ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( gl.GetDrawTrace().CountMethod( "DrawElementsInstanced" ), 1, TEST_LOCATION );
+
+  END_TEST;
+}
+
 int UtcDaliRendererSetIndexRange(void)
 {
   std::string
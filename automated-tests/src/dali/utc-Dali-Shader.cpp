@@ -19,6 +19,7 @@
 
 #include <stdlib.h>
 #include <dali/public-api/dali-core.h>
+#include <dali/devel-api/rendering/shader-devel.h>
 #include <dali-test-suite-utils.h>
 #include <mesh-builder.h>
 
@@ -46,6 +47,21 @@ static const char* FragmentSource =
 "made on purpose to look nothing like a normal fragment shader inside dali\n";
 
 
+struct ProgramReadyFunctor
+{
+  ProgramReadyFunctor( int& callCount )
+  : mCallCount( callCount )
+  {
+  }
+
+  void operator()( Shader shader )
+  {
+    ++mCallCount;
+  }
+
+  int& mCallCount;
+};
+
 void TestConstraintNoBlue( Vector4& current, const PropertyInputContainer& inputs )
 {
   current.b = 0.0f;
@@ -427,3 +443,100 @@ int UtcDaliShaderProgramProperty(void)
 
   END_TEST;
 }
+
+int UtcDaliShaderProgramReadySignal(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that the program ready signal is emitted once the program has been compiled");
+
+  Shader shader = Shader::New( VertexSource, FragmentSource );
+  Geometry geometry = CreateQuadGeometry();
+  Renderer renderer = Renderer::New( geometry, shader );
+
+  int callCount = 0;
+  DevelShader::ProgramReadySignal( shader ).Connect( &application, ProgramReadyFunctor( callCount ) );
+  DALI_TEST_CHECK( !DevelShader::IsProgramReady( shader ) );
+
+  Actor actor = Actor::New();
+  actor.AddRenderer( renderer );
+  actor.SetSize( 400, 400 );
+  Stage::GetCurrent().Add( actor );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  TraceCallStack& drawTrace = gl.GetDrawTrace();
+  drawTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 1, TEST_LOCATION );
+
+  // The program was compiled while rendering, so it is ready after the next update
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+  DALI_TEST_CHECK( DevelShader::IsProgramReady( shader ) );
+  DALI_TEST_EQUALS( callCount, 1, TEST_LOCATION );
+
+  // The signal is only emitted once
+  application.Render();
+  application.SendNotification();
+  DALI_TEST_EQUALS( callCount, 1, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliShaderParallelCompile(void)
+{
+  TestApplication application;
+
+  tet_infoline("Test that renderers aren't drawn until their program has been compiled in the background");
+
+  // Recreate the context with the parallel compile extension
+  static char extensions[] = "GL_KHR_parallel_shader_compile";
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  gl.SetGetStringResult( reinterpret_cast< GLubyte* >( extensions ) );
+  application.GetCore().ContextDestroyed();
+  application.GetCore().ContextCreated();
+
+  Shader shader = Shader::New( VertexSource, FragmentSource );
+  Geometry geometry = CreateQuadGeometry();
+  Renderer renderer = Renderer::New( geometry, shader );
+
+  int callCount = 0;
+  DevelShader::ProgramReadySignal( shader ).Connect( &application, ProgramReadyFunctor( callCount ) );
+
+  Actor actor = Actor::New();
+  actor.AddRenderer( renderer );
+  actor.SetSize( 400, 400 );
+  Stage::GetCurrent().Add( actor );
+
+  TraceCallStack& drawTrace = gl.GetDrawTrace();
+  drawTrace.Enable( true );
+
+  // Still compiling
+  gl.SetProgramCompletionStatus( GL_FALSE );
+  application.SendNotification();
+  DALI_TEST_CHECK( application.Render() );
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 0, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 0, TEST_LOCATION );
+  DALI_TEST_CHECK( !DevelShader::IsProgramReady( shader ) );
+  DALI_TEST_EQUALS( callCount, 0, TEST_LOCATION );
+
+  // Compiled, so the renderer is drawn
+  gl.SetProgramCompletionStatus( GL_TRUE );
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.CountMethod( "DrawElements" ), 1, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+  DALI_TEST_CHECK( DevelShader::IsProgramReady( shader ) );
+  DALI_TEST_EQUALS( callCount, 1, TEST_LOCATION );
+
+  END_TEST;
+}
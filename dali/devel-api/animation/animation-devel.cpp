@@ -40,6 +40,16 @@ Animation::AnimationSignalType& ProgressReachedSignal( Animation animation )
   return GetImplementation( animation ).ProgressReachedSignal();
 }
 
+void SetSampleCustomAlphaFunctions( Animation animation, bool sample )
+{
+  GetImplementation( animation ).SetSampleCustomAlphaFunctions( sample );
+}
+
+bool GetSampleCustomAlphaFunctions( Animation animation )
+{
+  return GetImplementation( animation ).GetSampleCustomAlphaFunctions();
+}
+
 } // namespace DevelAnimation
 
 } // namespace Dali
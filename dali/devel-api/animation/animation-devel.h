@@ -51,6 +51,26 @@ DALI_CORE_API float GetProgressNotification( Animation animation );
  */
 DALI_CORE_API Animation::AnimationSignalType& ProgressReachedSignal( Animation animation );
 
+/**
+ * @brief Sets whether custom alpha functions are sampled into a table when the animators are created.
+ *
+ * A sampled alpha function is approximated by interpolating between its samples, rather than being called
+ * for every animated property on every frame. Only animators created after this call are affected, and the
+ * alpha functions must not depend on anything except the progress.
+ *
+ * @param[in] animation the animation object to perform this operation on
+ * @param[in] sample true if custom alpha functions are sampled, false by default
+ */
+DALI_CORE_API void SetSampleCustomAlphaFunctions( Animation animation, bool sample );
+
+/**
+ * @brief Gets whether custom alpha functions are sampled into a table when the animators are created.
+ *
+ * @param[in] animation the animation object to perform this operation on
+ * @return true if custom alpha functions are sampled
+ */
+DALI_CORE_API bool GetSampleCustomAlphaFunctions( Animation animation );
+
 } // namespace DevelAnimation
 
 } // namespace Dali
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/animation/constraint-devel.h>
+#include <dali/internal/event/animation/constraint-base.h>
+
+namespace Dali
+{
+
+namespace DevelConstraint
+{
+
+void SetEvaluateEveryFrame( Constraint constraint, bool evaluateEveryFrame )
+{
+  GetImplementation( constraint ).SetEvaluateEveryFrame( evaluateEveryFrame );
+}
+
+bool GetEvaluateEveryFrame( Constraint constraint )
+{
+  return GetImplementation( constraint ).GetEvaluateEveryFrame();
+}
+
+} // namespace DevelConstraint
+
+} // namespace Dali
@@ -0,0 +1,54 @@
+#ifndef DALI_CONSTRAINT_DEVEL_H
+#define DALI_CONSTRAINT_DEVEL_H
+
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/animation/constraint.h>
+
+namespace Dali
+{
+
+namespace DevelConstraint
+{
+
+/**
+ * @brief Sets whether the constraint function is called in every frame.
+ *
+ * By default, the function is only called when the value of one of its inputs, or the current value
+ * of the constrained property, may have changed; otherwise the value it returned last time is reused.
+ * Functions which depend on anything else, e.g. the time or the state of the application, have to be called in every frame.
+ *
+ * @param[in] constraint The constraint object to perform this operation on
+ * @param[in] evaluateEveryFrame Whether the function is called in every frame
+ */
+DALI_CORE_API void SetEvaluateEveryFrame( Constraint constraint, bool evaluateEveryFrame );
+
+/**
+ * @brief Retrieves whether the constraint function is called in every frame.
+ *
+ * @param[in] constraint The constraint object to perform this operation on
+ * @return Whether the function is called in every frame
+ */
+DALI_CORE_API bool GetEvaluateEveryFrame( Constraint constraint );
+
+} // namespace DevelConstraint
+
+} // namespace Dali
+
+#endif // DALI_CONSTRAINT_DEVEL_H
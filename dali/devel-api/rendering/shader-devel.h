@@ -0,0 +1,82 @@
+#ifndef DALI_SHADER_DEVEL_H
+#define DALI_SHADER_DEVEL_H
+
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/rendering/shader.h>
+#include <dali/public-api/signals/dali-signal.h>
+
+namespace Dali
+{
+
+namespace DevelShader
+{
+
+namespace Hint
+{
+
+enum Value
+{
+  NONE                  = Dali::Shader::Hint::NONE,
+  OUTPUT_IS_TRANSPARENT = Dali::Shader::Hint::OUTPUT_IS_TRANSPARENT,
+  MODIFIES_GEOMETRY     = Dali::Shader::Hint::MODIFIES_GEOMETRY,
+
+  /**
+   * @brief The vertex shader reads the model matrix and the color of each instance from the
+   * "aInstanceModelMatrix" (mat4) and "aInstanceColor" (vec4) attributes, instead of the
+   * uModelMatrix and uColor uniforms.
+   * @details Consecutive render items using the shader, which share the geometry, textures,
+   * uniforms, size and render state, are drawn by a single instanced draw call.
+   * The uModelView, uMvpMatrix and uNormalMatrix uniforms are the ones of the first item of a draw call.
+   * Requires OpenGL ES 3.0.
+   */
+  DRAW_INSTANCED = 0x04
+};
+
+} // namespace Hint
+
+typedef Signal< void ( Shader ) > ProgramReadySignalType; ///< Program ready signal type
+
+/**
+ * @brief Queries whether the program of the shader has been compiled and linked, so renderers using it are drawn.
+ * @details Where the driver compiles programs in the background, renderers using a shader are not drawn
+ * until its program is ready, rather than stalling the render thread.
+ * @param[in] shader The shader
+ * @return True if the program is ready
+ */
+DALI_CORE_API bool IsProgramReady( Shader shader );
+
+/**
+ * @brief This signal is emitted once the program of the shader is ready, so renderers using it are drawn.
+ *
+ * A callback of the following type may be connected:
+ * @code
+ *   void YourCallbackName( Shader shader );
+ * @endcode
+ * @param[in] shader The shader
+ * @return The signal to connect to
+ * @note The program is compiled when a renderer using the shader is first drawn.
+ */
+DALI_CORE_API ProgramReadySignalType& ProgramReadySignal( Shader shader );
+
+} // namespace DevelShader
+
+} // namespace Dali
+
+#endif // DALI_SHADER_DEVEL_H
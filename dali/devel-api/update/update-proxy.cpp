@@ -89,6 +89,66 @@ bool UpdateProxy::BakeColor( uint32_t id, const Vector4& color )
   return mImpl.BakeColor( id, color );
 }
 
+uint32_t UpdateProxy::GetPositions( const uint32_t* ids, Vector3* positions, uint32_t count ) const
+{
+  return mImpl.GetPositions( ids, positions, count );
+}
+
+uint32_t UpdateProxy::SetPositions( const uint32_t* ids, const Vector3* positions, uint32_t count )
+{
+  return mImpl.SetPositions( ids, positions, count );
+}
+
+uint32_t UpdateProxy::BakePositions( const uint32_t* ids, const Vector3* positions, uint32_t count )
+{
+  return mImpl.BakePositions( ids, positions, count );
+}
+
+uint32_t UpdateProxy::GetSizes( const uint32_t* ids, Vector3* sizes, uint32_t count ) const
+{
+  return mImpl.GetSizes( ids, sizes, count );
+}
+
+uint32_t UpdateProxy::SetSizes( const uint32_t* ids, const Vector3* sizes, uint32_t count )
+{
+  return mImpl.SetSizes( ids, sizes, count );
+}
+
+uint32_t UpdateProxy::BakeSizes( const uint32_t* ids, const Vector3* sizes, uint32_t count )
+{
+  return mImpl.BakeSizes( ids, sizes, count );
+}
+
+uint32_t UpdateProxy::GetScales( const uint32_t* ids, Vector3* scales, uint32_t count ) const
+{
+  return mImpl.GetScales( ids, scales, count );
+}
+
+uint32_t UpdateProxy::SetScales( const uint32_t* ids, const Vector3* scales, uint32_t count )
+{
+  return mImpl.SetScales( ids, scales, count );
+}
+
+uint32_t UpdateProxy::BakeScales( const uint32_t* ids, const Vector3* scales, uint32_t count )
+{
+  return mImpl.BakeScales( ids, scales, count );
+}
+
+uint32_t UpdateProxy::GetColors( const uint32_t* ids, Vector4* colors, uint32_t count ) const
+{
+  return mImpl.GetColors( ids, colors, count );
+}
+
+uint32_t UpdateProxy::SetColors( const uint32_t* ids, const Vector4* colors, uint32_t count )
+{
+  return mImpl.SetColors( ids, colors, count );
+}
+
+uint32_t UpdateProxy::BakeColors( const uint32_t* ids, const Vector4* colors, uint32_t count )
+{
+  return mImpl.BakeColors( ids, colors, count );
+}
+
 UpdateProxy::UpdateProxy( Internal::UpdateProxy& impl )
 : mImpl( impl )
 {
@@ -160,6 +160,122 @@ public:
    */
   bool BakeColor( uint32_t id, const Vector4& color );
 
+  /**
+   * @brief Given several Actor IDs, this retrieves those Actors' local positions.
+   * @param[in]   ids        The Actor IDs
+   * @param[out]  positions  Set to the Actors' current positions, one for each Actor ID; entries for invalid IDs are left unchanged
+   * @param[in]   count      The number of Actor IDs
+   * @return The number of Actor IDs which were valid.
+   */
+  uint32_t GetPositions( const uint32_t* ids, Vector3* positions, uint32_t count ) const;
+
+  /**
+   * @brief Allows setting several Actors' local positions from the Frame callback function for the current frame only.
+   * @param[in]  ids        The Actor IDs
+   * @param[in]  positions  The positions to set, one for each Actor ID
+   * @param[in]  count      The number of Actor IDs
+   * @return The number of Actor IDs which were valid.
+   * @note This will get reset to the internally calculated or previously baked value in the next frame, so will have to be set again.
+   */
+  uint32_t SetPositions( const uint32_t* ids, const Vector3* positions, uint32_t count );
+
+  /**
+   * @brief Allows baking several Actors' local positions from the Frame callback function.
+   * @param[in]  ids        The Actor IDs
+   * @param[in]  positions  The positions to bake, one for each Actor ID
+   * @param[in]  count      The number of Actor IDs
+   * @return The number of Actor IDs which were valid.
+   * @note The values are saved so will cause undesired effects if these properties are being animated.
+   */
+  uint32_t BakePositions( const uint32_t* ids, const Vector3* positions, uint32_t count );
+
+  /**
+   * @brief Given several Actor IDs, this retrieves those Actors' sizes.
+   * @param[in]   ids    The Actor IDs
+   * @param[out]  sizes  Set to the Actors' current sizes, one for each Actor ID; entries for invalid IDs are left unchanged
+   * @param[in]   count  The number of Actor IDs
+   * @return The number of Actor IDs which were valid.
+   */
+  uint32_t GetSizes( const uint32_t* ids, Vector3* sizes, uint32_t count ) const;
+
+  /**
+   * @brief Allows setting several Actors' sizes from the Frame callback function for the current frame only.
+   * @param[in]  ids    The Actor IDs
+   * @param[in]  sizes  The sizes to set, one for each Actor ID
+   * @param[in]  count  The number of Actor IDs
+   * @return The number of Actor IDs which were valid.
+   * @note This will get reset to the internally calculated or previously baked value in the next frame, so will have to be set again.
+   */
+  uint32_t SetSizes( const uint32_t* ids, const Vector3* sizes, uint32_t count );
+
+  /**
+   * @brief Allows baking several Actors' sizes from the Frame callback function.
+   * @param[in]  ids    The Actor IDs
+   * @param[in]  sizes  The sizes to bake, one for each Actor ID
+   * @param[in]  count  The number of Actor IDs
+   * @return The number of Actor IDs which were valid.
+   * @note The values are saved so will cause undesired effects if these properties are being animated.
+   */
+  uint32_t BakeSizes( const uint32_t* ids, const Vector3* sizes, uint32_t count );
+
+  /**
+   * @brief Given several Actor IDs, this retrieves those Actors' local scales.
+   * @param[in]   ids     The Actor IDs
+   * @param[out]  scales  Set to the Actors' current scales, one for each Actor ID; entries for invalid IDs are left unchanged
+   * @param[in]   count   The number of Actor IDs
+   * @return The number of Actor IDs which were valid.
+   */
+  uint32_t GetScales( const uint32_t* ids, Vector3* scales, uint32_t count ) const;
+
+  /**
+   * @brief Allows setting several Actors' local scales from the Frame callback function for the current frame only.
+   * @param[in]  ids     The Actor IDs
+   * @param[in]  scales  The scales to set, one for each Actor ID
+   * @param[in]  count   The number of Actor IDs
+   * @return The number of Actor IDs which were valid.
+   * @note This will get reset to the internally calculated or previously baked value in the next frame, so will have to be set again.
+   */
+  uint32_t SetScales( const uint32_t* ids, const Vector3* scales, uint32_t count );
+
+  /**
+   * @brief Allows baking several Actors' local scales from the Frame callback function.
+   * @param[in]  ids     The Actor IDs
+   * @param[in]  scales  The scales to bake, one for each Actor ID
+   * @param[in]  count   The number of Actor IDs
+   * @return The number of Actor IDs which were valid.
+   * @note The values are saved so will cause undesired effects if these properties are being animated.
+   */
+  uint32_t BakeScales( const uint32_t* ids, const Vector3* scales, uint32_t count );
+
+  /**
+   * @brief Given several Actor IDs, this retrieves those Actors' local colors.
+   * @param[in]   ids     The Actor IDs
+   * @param[out]  colors  Set to the Actors' current colors, one for each Actor ID; entries for invalid IDs are left unchanged
+   * @param[in]   count   The number of Actor IDs
+   * @return The number of Actor IDs which were valid.
+   */
+  uint32_t GetColors( const uint32_t* ids, Vector4* colors, uint32_t count ) const;
+
+  /**
+   * @brief Allows setting several Actors' local colors from the Frame callback function for the current frame only.
+   * @param[in]  ids     The Actor IDs
+   * @param[in]  colors  The colors to set, one for each Actor ID
+   * @param[in]  count   The number of Actor IDs
+   * @return The number of Actor IDs which were valid.
+   * @note This will get reset to the internally calculated or previously baked value in the next frame, so will have to be set again.
+   */
+  uint32_t SetColors( const uint32_t* ids, const Vector4* colors, uint32_t count );
+
+  /**
+   * @brief Allows baking several Actors' local colors from the Frame callback function.
+   * @param[in]  ids     The Actor IDs
+   * @param[in]  colors  The colors to bake, one for each Actor ID
+   * @param[in]  count   The number of Actor IDs
+   * @return The number of Actor IDs which were valid.
+   * @note The values are saved so will cause undesired effects if these properties are being animated.
+   */
+  uint32_t BakeColors( const uint32_t* ids, const Vector4* colors, uint32_t count );
+
 public: // Not intended for application developers
 
   /// @cond internal
@@ -112,6 +112,21 @@ uint32_t Core::GetMaximumUpdateCount() const
   return mImpl->GetMaximumUpdateCount();
 }
 
+void Core::SetUpdateThreadCount( uint32_t threadCount )
+{
+  mImpl->SetUpdateThreadCount( threadCount );
+}
+
+uint32_t Core::TrimMemoryPools()
+{
+  return mImpl->TrimMemoryPools();
+}
+
+void Core::GetMemoryPoolStatistics( Dali::Vector< MemoryPoolStatistics >& statistics ) const
+{
+  mImpl->GetMemoryPoolStatistics( statistics );
+}
+
 void Core::Update( float elapsedSeconds, uint32_t lastVSyncTimeMilliseconds, uint32_t nextVSyncTimeMilliseconds, UpdateStatus& status, bool renderToFboEnabled, bool isRenderingToFbo )
 {
   mImpl->Update( elapsedSeconds, lastVSyncTimeMilliseconds, nextVSyncTimeMilliseconds, status, renderToFboEnabled, isRenderingToFbo );
@@ -23,6 +23,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/integration-api/context-notifier.h>
 #include <dali/integration-api/core-enumerations.h>
 
@@ -66,6 +67,18 @@ enum Reasons
 };
 }
 
+/**
+ * The usage of the memory of a pool of scene-graph objects.
+ */
+struct MemoryPoolStatistics
+{
+  const char* name;     ///< The type of the objects in the pool
+  uint32_t objectSize;  ///< The size of each object in bytes, including alignment
+  uint32_t capacity;    ///< The number of objects the blocks of memory can hold
+  uint32_t liveObjects; ///< The number of objects allocated
+  uint32_t blockCount;  ///< The number of blocks of memory
+};
+
 /**
  * The status of the Core::Update operation.
  */
@@ -322,6 +335,32 @@ public:
    */
   uint32_t GetMaximumUpdateCount() const;
 
+  /**
+   * Sets the number of worker threads that Core::Update() may use to parallelise its work.
+   * By default the update is performed entirely on the calling thread.
+   * The results of the update do not depend on the number of worker threads.
+   * With worker threads, the constraints of nodes which don't read each other's properties, directly or
+   * through other constrained nodes, may be applied concurrently; so the functions of node constraints
+   * may be called from the worker threads, and must not share state which isn't thread-safe.
+   * @param[in] threadCount The number of worker threads, or zero to update serially.
+   */
+  void SetUpdateThreadCount( uint32_t threadCount );
+
+  /**
+   * Releases the memory of the pools of scene-graph objects which is no longer used by any object.
+   * The pools keep their peak size otherwise, so this should be called when idle, or when memory is low.
+   * Multi-threading note: this method should be called from the main thread.
+   * @return The number of blocks of memory released
+   */
+  uint32_t TrimMemoryPools();
+
+  /**
+   * Retrieves the usage of the memory of the pools of scene-graph objects.
+   * Multi-threading note: this method should be called from the main thread.
+   * @param[out] statistics The statistics of each pool
+   */
+  void GetMemoryPoolStatistics( Dali::Vector< MemoryPoolStatistics >& statistics ) const;
+
   /**
    * Update the scene for the next frame. This method must be called before each frame is rendered.
    * Multi-threading notes: this method should be called from a dedicated update-thread.
@@ -864,4 +864,10 @@
 #define GL_SAMPLER_EXTERNAL_OES                                 0x8D66
 #endif
 
+/* GL_KHR_parallel_shader_compile */
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR                      0x91B0
+#define GL_COMPLETION_STATUS_KHR                                0x91B1
+#endif
+
 #endif // DALI_INTERNAL_GL_DEFINES_H
@@ -113,6 +113,7 @@ public:
 
   /**
    * Load a shader binary file into a buffer
+   * This is called from the event thread, unless IsShaderBinaryFileThreadSafe() returns true.
    * @param[in] filename The shader binary filename to load
    * @param[out] buffer  A buffer to receive the file.
    * @result             true if the file is loaded.
@@ -121,6 +122,7 @@ public:
 
   /**
    * Save a shader binary file to the resource file system.
+   * This is called from the event thread, unless IsShaderBinaryFileThreadSafe() returns true.
    * @param[in] filename The shader binary filename to save to.
    * @param[in] buffer  A buffer to write the file from.
    * @param[in] numbytes Size of the buffer.
@@ -128,6 +130,16 @@ public:
    */
   virtual bool SaveShaderBinaryFile( const std::string& filename, const uint8_t * buffer, uint32_t numBytes ) const = 0;
 
+  /**
+   * Checks whether LoadShaderBinaryFile() and SaveShaderBinaryFile() may be called from threads of their own
+   * while the event thread runs, so the shader binary file isn't read and written on the event thread.
+   * @result true if they are thread-safe, false by default.
+   */
+  virtual bool IsShaderBinaryFileThreadSafe() const
+  {
+    return false;
+  }
+
   /**
    * Sets a callback to occur in the future
    * @param[in] milliseconds number of milliseconds to wait until executing the callback
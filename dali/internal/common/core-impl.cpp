@@ -43,13 +43,19 @@
 #include <dali/internal/event/render-tasks/render-task-list-impl.h>
 #include <dali/internal/event/size-negotiation/relayout-controller-impl.h>
 
+#include <dali/internal/update/animation/scene-graph-animation.h>
 #include <dali/internal/update/common/discard-queue.h>
 #include <dali/internal/update/manager/update-manager.h>
 #include <dali/internal/update/manager/render-task-processor.h>
+#include <dali/internal/update/nodes/node.h>
+#include <dali/internal/update/render-tasks/scene-graph-render-task-list.h>
+#include <dali/internal/update/rendering/scene-graph-renderer.h>
+#include <dali/internal/update/rendering/scene-graph-texture-set.h>
 
 #include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/render/common/render-manager.h>
 #include <dali/internal/render/gl-resources/context.h>
+#include <dali/internal/render/shaders/program-cache.h>
 
 using Dali::Internal::SceneGraph::UpdateManager;
 using Dali::Internal::SceneGraph::RenderManager;
@@ -64,6 +70,23 @@ const uint32_t MAXIMUM_UPDATE_COUNT = 2u;
 #if defined(DEBUG_ENABLED)
 Debug::Filter* gCoreFilter = Debug::Filter::New(Debug::Concise, false, "LOG_CORE");
 #endif
+
+/**
+ * Adds the statistics of a memory pool to a list
+ * @param[in] name The type of the objects in the pool
+ * @param[in] poolStatistics The statistics of the pool
+ * @param[in,out] statistics The list of statistics
+ */
+void AddMemoryPoolStatistics( const char* name, const Dali::Internal::FixedSizeMemoryPool::Statistics& poolStatistics, Dali::Vector< Dali::Integration::MemoryPoolStatistics >& statistics )
+{
+  Dali::Integration::MemoryPoolStatistics item;
+  item.name = name;
+  item.objectSize = poolStatistics.fixedSize;
+  item.capacity = poolStatistics.capacity;
+  item.liveObjects = poolStatistics.liveObjects;
+  item.blockCount = poolStatistics.blockCount;
+  statistics.PushBack( item );
+}
 }
 
 namespace Dali
@@ -134,7 +157,7 @@ Core::Core( RenderController& renderController,
 
   mGestureEventProcessor = new GestureEventProcessor( *mUpdateManager, mRenderController );
 
-  mShaderFactory = new ShaderFactory();
+  mShaderFactory = new ShaderFactory( platform );
   mUpdateManager->SetShaderSaver( *mShaderFactory );
 
   GetImplementation(Dali::TypeRegistry::Get()).CallInitFunctions();
@@ -186,6 +209,9 @@ void Core::RecoverFromContextLoss()
 void Core::ContextCreated()
 {
   mRenderManager->ContextCreated();
+
+  // The shader binaries saved by another driver are discarded once the identity of this one is known
+  mShaderFactory->SetDriverIdentity( mRenderManager->GetProgramCache()->GetDriverIdentity() );
 }
 
 void Core::ContextDestroyed()
@@ -283,6 +309,9 @@ void Core::ProcessEvents()
 
   mNotificationManager->ProcessMessages();
 
+  // Write the shader binaries compiled since the last events were processed
+  mShaderFactory->SaveBinaryArchive();
+
   // Emit signal here to inform listeners that event processing has finished.
   for( auto scene : scenes )
   {
@@ -326,6 +355,35 @@ uint32_t Core::GetMaximumUpdateCount() const
   return MAXIMUM_UPDATE_COUNT;
 }
 
+void Core::SetUpdateThreadCount( uint32_t threadCount )
+{
+  SetUpdateThreadCountMessage( *mUpdateManager, threadCount );
+}
+
+uint32_t Core::TrimMemoryPools()
+{
+  // The pools are thread-safe, so they can be trimmed while the update thread is freeing objects
+  const uint32_t released = SceneGraph::Node::TrimMemoryPool() +
+                            SceneGraph::Renderer::TrimMemoryPool() +
+                            SceneGraph::TextureSet::TrimMemoryPool() +
+                            SceneGraph::Animation::TrimMemoryPool() +
+                            SceneGraph::RenderTaskList::TrimMemoryPool();
+
+  DALI_LOG_INFO( gCoreFilter, Debug::General, "Core::TrimMemoryPools() released %u blocks\n", released );
+
+  return released;
+}
+
+void Core::GetMemoryPoolStatistics( Dali::Vector< Integration::MemoryPoolStatistics >& statistics ) const
+{
+  statistics.Clear();
+  AddMemoryPoolStatistics( "Node", SceneGraph::Node::GetMemoryPoolStatistics(), statistics );
+  AddMemoryPoolStatistics( "Renderer", SceneGraph::Renderer::GetMemoryPoolStatistics(), statistics );
+  AddMemoryPoolStatistics( "TextureSet", SceneGraph::TextureSet::GetMemoryPoolStatistics(), statistics );
+  AddMemoryPoolStatistics( "Animation", SceneGraph::Animation::GetMemoryPoolStatistics(), statistics );
+  AddMemoryPoolStatistics( "RenderTaskList", SceneGraph::RenderTaskList::GetMemoryPoolStatistics(), statistics );
+}
+
 void Core::RegisterProcessor( Integration::Processor& processor )
 {
   mProcessors.PushBack(&processor);
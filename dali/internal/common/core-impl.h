@@ -22,6 +22,7 @@
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/integration-api/context-notifier.h>
+#include <dali/integration-api/core.h>
 #include <dali/integration-api/core-enumerations.h>
 #include <dali/internal/common/owner-pointer.h>
 #include <dali/devel-api/common/owner-container.h>
@@ -159,6 +160,21 @@ public:
    */
   uint32_t GetMaximumUpdateCount() const;
 
+  /**
+   * @copydoc Dali::Integration::Core::SetUpdateThreadCount()
+   */
+  void SetUpdateThreadCount( uint32_t threadCount );
+
+  /**
+   * @copydoc Dali::Integration::Core::TrimMemoryPools()
+   */
+  uint32_t TrimMemoryPools();
+
+  /**
+   * @copydoc Dali::Integration::Core::GetMemoryPoolStatistics()
+   */
+  void GetMemoryPoolStatistics( Dali::Vector< Integration::MemoryPoolStatistics >& statistics ) const;
+
   /**
    * @copydoc Dali::Integration::Core::RegisterProcessor
    */
@@ -18,6 +18,11 @@
 // CLASS HEADER
 #include <dali/internal/common/fixed-size-memory-pool.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 // INTERNAL HEADERS
 #include <dali/devel-api/threading/mutex.h>
 #include <dali/public-api/common/dali-common.h>
@@ -42,21 +47,19 @@ struct FixedSizeMemoryPool::Impl
   {
     void* blockMemory;      ///< The allocated memory from which allocations can be made
     Block* nextBlock;       ///< The next block in the linked list
-#ifdef DEBUG_ENABLED
-    SizeType mBlockSize; ///< Size of the block in bytes
-#endif
+    SizeType capacity;      ///< The number of allocations the block can hold
+
     /**
-     * @brief Construct a new block with given size
+     * @brief Construct a new block with given capacity
      *
-     * @param size The size of the memory block to allocate in bytes. Must be non-zero.
+     * @param capacity The number of allocations the block can hold. Must be non-zero.
+     * @param fixedSize The size of each allocation in bytes
      */
-    Block( SizeType size )
-    : nextBlock( NULL )
-#ifdef DEBUG_ENABLED
-      ,mBlockSize( size )
-#endif
+    Block( SizeType capacity, SizeType fixedSize )
+    : nextBlock( NULL ),
+      capacity( capacity )
     {
-      blockMemory = ::operator new( size );
+      blockMemory = ::operator new( capacity * fixedSize );
       DALI_ASSERT_ALWAYS( blockMemory && "Out of memory" );
     }
 
@@ -82,12 +85,15 @@ struct FixedSizeMemoryPool::Impl
   Impl( SizeType fixedSize, SizeType initialCapacity, SizeType maximumBlockCapacity )
   :  mMutex(),
      mFixedSize( fixedSize ),
-     mMemoryBlocks( initialCapacity * mFixedSize ),
+     mMemoryBlocks( initialCapacity, mFixedSize ),
      mMaximumBlockCapacity( maximumBlockCapacity ),
      mCurrentBlock( &mMemoryBlocks ),
      mCurrentBlockCapacity( initialCapacity ),
      mCurrentBlockSize( 0 ),
-     mDeletedObjects( NULL )
+     mDeletedObjects( NULL ),
+     mFreedObjects( NULL ),
+     mAllocationCount( 0 ),
+     mFreeCount( 0 )
   {
     // We need enough room to store the deleted list in the data
     DALI_ASSERT_DEBUG( mFixedSize >= sizeof( void* ) );
@@ -123,7 +129,7 @@ struct FixedSizeMemoryPool::Impl
     mCurrentBlockCapacity = size;
 
     // Allocate
-    Block* block = new Block( mCurrentBlockCapacity * mFixedSize );
+    Block* block = new Block( mCurrentBlockCapacity, mFixedSize );
     mCurrentBlock->nextBlock = block;       // Add to end of linked list
     mCurrentBlock = block;
 
@@ -142,7 +148,7 @@ struct FixedSizeMemoryPool::Impl
 
     while( block )
     {
-      const void* const endOfBlock = reinterpret_cast<char *>( block->blockMemory )+ block->mBlockSize;
+      const void* const endOfBlock = reinterpret_cast<char *>( block->blockMemory )+ block->capacity * mFixedSize;
 
       if( ( memory >= block->blockMemory ) && ( memory < (endOfBlock) ) )
       {
@@ -155,6 +161,143 @@ struct FixedSizeMemoryPool::Impl
   }
 #endif
 
+  /**
+   * @brief The number of allocations of a block which are not on the deleted objects list
+   */
+  struct BlockOccupancy
+  {
+    BlockOccupancy( const void* memory, SizeType size, SizeType allocated )
+    : begin( memory ),
+      end( static_cast< const uint8_t* >( memory ) + size ),
+      allocated( allocated )
+    {
+    }
+
+    bool operator<( const BlockOccupancy& rhs ) const
+    {
+      return begin < rhs.begin;
+    }
+
+    const void* begin;  ///< The start of the memory of the block, kept as the block may have been deleted
+    const void* end;    ///< The end of the memory of the block
+    SizeType allocated; ///< The number of allocations not on the deleted objects list
+  };
+
+  /**
+   * @brief Finds the block which contains an allocation
+   * @param[in] blocks The blocks sorted by address
+   * @param[in] memory The allocation
+   * @return The block, or NULL if the allocation is in the first block
+   */
+  BlockOccupancy* FindBlock( std::vector< BlockOccupancy >& blocks, const void* memory ) const
+  {
+    auto iter = std::upper_bound( blocks.begin(), blocks.end(), memory,
+                                  []( const void* lhs, const BlockOccupancy& rhs ) { return lhs < rhs.begin; } );
+    if( iter != blocks.begin() )
+    {
+      --iter;
+      if( memory < iter->end )
+      {
+        return &( *iter );
+      }
+    }
+    return NULL;
+  }
+
+  /**
+   * @brief Releases the blocks, other than the first, in which all the allocations are on the deleted objects list
+   * @return The number of blocks released
+   */
+  SizeType Trim()
+  {
+    // Take back the objects freed by other threads, so their blocks can be released too
+    void* freed = mFreedObjects.exchange( NULL, std::memory_order_acquire );
+    while( freed )
+    {
+      void* next = *( reinterpret_cast< void** >( freed ) );
+      *( reinterpret_cast< void** >( freed ) ) = mDeletedObjects;
+      mDeletedObjects = freed;
+      freed = next;
+    }
+
+    // Count the deleted objects of each block, finding their blocks by address
+    std::vector< BlockOccupancy > blocks;
+    for( Block* block = mMemoryBlocks.nextBlock; block; block = block->nextBlock )
+    {
+      const SizeType allocated = ( block == mCurrentBlock ) ? mCurrentBlockSize : block->capacity;
+      blocks.push_back( BlockOccupancy( block->blockMemory, block->capacity * mFixedSize, allocated ) );
+    }
+    if( blocks.empty() )
+    {
+      return 0;
+    }
+    std::sort( blocks.begin(), blocks.end() );
+
+    for( void* object = mDeletedObjects; object; object = *( reinterpret_cast< void** >( object ) ) )
+    {
+      BlockOccupancy* occupancy = FindBlock( blocks, object );
+      if( occupancy )
+      {
+        --occupancy->allocated;
+      }
+    }
+
+    SizeType released = 0;
+    for( auto&& occupancy : blocks )
+    {
+      released += ( occupancy.allocated == 0 ) ? 1 : 0;
+    }
+    if( released == 0 )
+    {
+      return 0;
+    }
+
+    // Remove the objects of the released blocks from the deleted objects list
+    void** link = &mDeletedObjects;
+    while( *link )
+    {
+      BlockOccupancy* occupancy = FindBlock( blocks, *link );
+      if( occupancy && occupancy->allocated == 0 )
+      {
+        *link = *( reinterpret_cast< void** >( *link ) );
+      }
+      else
+      {
+        link = reinterpret_cast< void** >( *link );
+      }
+    }
+
+    // Unlink and delete the released blocks
+    Block* previous = &mMemoryBlocks;
+    Block* block = mMemoryBlocks.nextBlock;
+    bool currentReleased = false;
+    while( block )
+    {
+      Block* nextBlock = block->nextBlock;
+      if( FindBlock( blocks, block->blockMemory )->allocated == 0 )
+      {
+        currentReleased |= ( block == mCurrentBlock );
+        previous->nextBlock = nextBlock;
+        delete block;
+      }
+      else
+      {
+        previous = block;
+      }
+      block = nextBlock;
+    }
+
+    if( currentReleased )
+    {
+      // The remaining blocks are full, so the next allocation adds a new block
+      mCurrentBlock = previous;
+      mCurrentBlockCapacity = previous->capacity;
+      mCurrentBlockSize = previous->capacity;
+    }
+
+    return released;
+  }
+
   Mutex mMutex;                       ///< Mutex for thread-safe allocation and deallocation
 
   SizeType mFixedSize;                ///< The size of each allocation in bytes
@@ -167,6 +310,10 @@ struct FixedSizeMemoryPool::Impl
   SizeType mCurrentBlockSize;         ///< The number of allocations allocated to the current block
 
   void* mDeletedObjects;              ///< Pointer to the head of the list of deleted objects. The addresses are stored in the allocated memory blocks.
+  std::atomic< void* > mFreedObjects; ///< Pointer to the head of the list of objects freed by FreeThreadSafe(), which is taken back by AllocateThreadSafe() as a whole
+
+  SizeType mAllocationCount;             ///< The number of allocations made, only changed by the allocating thread
+  std::atomic< SizeType > mFreeCount;    ///< The number of allocations freed, which may be changed by any thread
 };
 
 FixedSizeMemoryPool::FixedSizeMemoryPool( SizeType fixedSize, SizeType initialCapacity, SizeType maximumBlockCapacity )
@@ -184,6 +331,7 @@ void* FixedSizeMemoryPool::Allocate()
   // First, recycle deleted objects
   if( mImpl->mDeletedObjects )
   {
+    ++mImpl->mAllocationCount;
     void* recycled = mImpl->mDeletedObjects;
     mImpl->mDeletedObjects = *( reinterpret_cast< void** >( mImpl->mDeletedObjects ) );  // Pop head off front of deleted objects list
     return recycled;
@@ -199,6 +347,7 @@ void* FixedSizeMemoryPool::Allocate()
   uint8_t* objectAddress = static_cast< uint8_t* >( mImpl->mCurrentBlock->blockMemory );
   objectAddress += mImpl->mCurrentBlockSize * mImpl->mFixedSize;
   mImpl->mCurrentBlockSize++;
+  ++mImpl->mAllocationCount;
 
   return objectAddress;
 }
@@ -212,18 +361,72 @@ void FixedSizeMemoryPool::Free( void* memory )
   // Add memory to head of deleted objects list. Store next address in the same memory space as the old object.
   *( reinterpret_cast< void** >( memory ) ) = mImpl->mDeletedObjects;
   mImpl->mDeletedObjects = memory;
+  mImpl->mFreeCount.fetch_add( 1, std::memory_order_relaxed );
 }
 
 void* FixedSizeMemoryPool::AllocateThreadSafe()
 {
   Mutex::ScopedLock lock( mImpl->mMutex );
+
+  if( !mImpl->mDeletedObjects )
+  {
+    // Take back all the objects freed since the last batch. As the list is only ever taken as a whole,
+    // the heads pushed by FreeThreadSafe() can't be recycled underneath it
+    mImpl->mDeletedObjects = mImpl->mFreedObjects.exchange( NULL, std::memory_order_acquire );
+  }
+
   return Allocate();
 }
 
 void FixedSizeMemoryPool::FreeThreadSafe( void* memory )
+{
+#ifdef DEBUG_ENABLED
+  {
+    // The blocks may be being added to by an allocating thread
+    Mutex::ScopedLock lock( mImpl->mMutex );
+    mImpl->CheckMemoryIsInsidePool( memory );
+  }
+#endif
+
+  // Push the memory onto the head of the freed objects list, storing the next address in the same memory space as the old object
+  void* head = mImpl->mFreedObjects.load( std::memory_order_relaxed );
+  do
+  {
+    *( reinterpret_cast< void** >( memory ) ) = head;
+  }
+  while( !mImpl->mFreedObjects.compare_exchange_weak( head, memory, std::memory_order_release, std::memory_order_relaxed ) );
+
+  mImpl->mFreeCount.fetch_add( 1, std::memory_order_relaxed );
+}
+
+FixedSizeMemoryPool::SizeType FixedSizeMemoryPool::Trim()
+{
+  return mImpl->Trim();
+}
+
+FixedSizeMemoryPool::SizeType FixedSizeMemoryPool::TrimThreadSafe()
+{
+  Mutex::ScopedLock lock( mImpl->mMutex );
+  return mImpl->Trim();
+}
+
+FixedSizeMemoryPool::Statistics FixedSizeMemoryPool::GetStatistics() const
 {
   Mutex::ScopedLock lock( mImpl->mMutex );
-  Free( memory );
+
+  Statistics statistics;
+  statistics.fixedSize = mImpl->mFixedSize;
+  statistics.capacity = 0;
+  statistics.blockCount = 0;
+  for( const Impl::Block* block = &mImpl->mMemoryBlocks; block; block = block->nextBlock )
+  {
+    statistics.capacity += block->capacity;
+    ++statistics.blockCount;
+  }
+  // The counts wrap around together, so their difference is still the number of live objects
+  statistics.liveObjects = mImpl->mAllocationCount - mImpl->mFreeCount.load( std::memory_order_relaxed );
+
+  return statistics;
 }
 
 
@@ -55,6 +55,17 @@ public:
 
   typedef uint32_t SizeType;
 
+  /**
+   * @brief The usage of the memory of a pool
+   */
+  struct Statistics
+  {
+    SizeType fixedSize;   ///< The size of each allocation in bytes
+    SizeType capacity;    ///< The number of allocations the blocks of memory can hold
+    SizeType liveObjects; ///< The number of allocations which haven't been freed
+    SizeType blockCount;  ///< The number of blocks of memory
+  };
+
 public:
 
   /**
@@ -83,6 +94,9 @@ public:
   /**
    * @brief Thread-safe version of Allocate()
    *
+   * Memory freed by FreeThreadSafe() is taken back in a single batch when the recycled allocations run out.
+   * Only allocating threads contend with each other; they never wait for the threads freeing memory.
+   *
    * @return Return the newly allocated memory
    */
   void* AllocateThreadSafe();
@@ -97,10 +111,34 @@ public:
   /**
    * @brief Thread-safe version of Free()
    *
-   * @param memory The memory to be deleted. Must have been allocated by this memory pool
+   * Lock-free; the memory is pushed onto a list of freed allocations, which AllocateThreadSafe() takes back in batches.
+   *
+   * @param memory The memory to be deleted. Must have been allocated by this memory pool with AllocateThreadSafe()
    */
   void FreeThreadSafe( void* memory );
 
+  /**
+   * @brief Releases the blocks of memory in which all the allocations have been freed.
+   *
+   * The first block is kept, and new blocks start doubling in size from the last remaining block.
+   * @return The number of blocks released
+   */
+  SizeType Trim();
+
+  /**
+   * @brief Thread-safe version of Trim()
+   *
+   * @return The number of blocks released
+   */
+  SizeType TrimThreadSafe();
+
+  /**
+   * @brief Retrieves the usage of the memory of the pool. Thread-safe.
+   *
+   * @return The statistics of the pool
+   */
+  Statistics GetStatistics() const;
+
 private:
 
   // Undefined
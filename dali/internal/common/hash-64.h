@@ -0,0 +1,77 @@
+#ifndef DALI_INTERNAL_HASH_64_H
+#define DALI_INTERNAL_HASH_64_H
+
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * The initial value of a 64 bit hash, the offset basis of FNV-1a
+ */
+const uint64_t INITIAL_HASH_VALUE_64 = 14695981039346656037ull;
+
+/**
+ * @brief Continues a 64 bit FNV-1a hash over a block of memory.
+ * @param[in] data The memory to hash
+ * @param[in] size The size of the memory in bytes
+ * @param[in] hash The hash of the preceding data
+ * @return The hash
+ */
+inline uint64_t CalculateHash64( const void* data, std::size_t size, uint64_t hash = INITIAL_HASH_VALUE_64 )
+{
+  const uint8_t* bytes = static_cast< const uint8_t* >( data );
+  for( std::size_t i = 0; i < size; ++i )
+  {
+    hash = ( hash ^ bytes[i] ) * 1099511628211ull; // The FNV prime
+  }
+  return hash;
+}
+
+/**
+ * @brief Continues a 64 bit FNV-1a hash over a string.
+ * The terminator is hashed too, so consecutive strings can't be confused by moving characters between them.
+ * @param[in] string The null terminated string, or NULL which is hashed as an empty string
+ * @param[in] hash The hash of the preceding data
+ * @return The hash
+ */
+inline uint64_t CalculateHash64( const char* string, uint64_t hash = INITIAL_HASH_VALUE_64 )
+{
+  if( string )
+  {
+    while( *string )
+    {
+      hash = CalculateHash64( string++, 1u, hash );
+    }
+  }
+  const char terminator = '\0';
+  return CalculateHash64( &terminator, 1u, hash );
+}
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_HASH_64_H
@@ -70,6 +70,7 @@ public:
    * @brief Thread-safe version of Allocate()
    *
    * @return Return the allocated object
+   * @note Objects allocated by the thread-safe methods must be returned by the thread-safe methods, which don't block the allocating threads.
    */
   T* AllocateThreadSafe()
   {
@@ -147,6 +148,36 @@ public:
     mPool->FreeThreadSafe( object );
   }
 
+  /**
+   * @brief Release the blocks of memory in which all the objects have been returned to the memory pool
+   *
+   * @return The number of blocks released
+   */
+  FixedSizeMemoryPool::SizeType Trim()
+  {
+    return mPool->Trim();
+  }
+
+  /**
+   * @brief Thread-safe version of Trim()
+   *
+   * @return The number of blocks released
+   */
+  FixedSizeMemoryPool::SizeType TrimThreadSafe()
+  {
+    return mPool->TrimThreadSafe();
+  }
+
+  /**
+   * @brief Retrieve the usage of the memory of the memory pool
+   *
+   * @return The statistics of the memory pool
+   */
+  FixedSizeMemoryPool::Statistics GetStatistics() const
+  {
+    return mPool->GetStatistics();
+  }
+
   /**
    * @brief Reset the memory pool, unloading all block memory previously allocated
    */
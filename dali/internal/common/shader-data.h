@@ -52,7 +52,8 @@ public:
   : mShaderHash( -1 ),
     mVertexShader(vertexSource),
     mFragmentShader(fragmentSource),
-    mHints(hints)
+    mHints(hints),
+    mDriverIdentity( 0u )
   { }
 
 protected:
@@ -110,6 +111,24 @@ public: // API
   {
     return mHints;
   }
+  /**
+   * Set the identity of the GL driver which compiled the binary
+   * @param[in] driverIdentity A hash over the vendor, renderer, version and binary format of the driver
+   */
+  void SetDriverIdentity( uint64_t driverIdentity )
+  {
+    mDriverIdentity = driverIdentity;
+  }
+
+  /**
+   * Get the identity of the GL driver which compiled the binary
+   * @return A hash over the vendor, renderer, version and binary format of the driver, zero if unknown
+   */
+  uint64_t GetDriverIdentity() const
+  {
+    return mDriverIdentity;
+  }
+
   /**
    * Check whether there is a compiled binary available
    * @return true if this objects contains a compiled binary
@@ -168,6 +187,7 @@ private: // Data
   std::string               mFragmentShader; ///< source code for fragment program
   Dali::Shader::Hint::Value mHints;          ///< take a hint
   Dali::Vector<uint8_t>     mBuffer;         ///< buffer containing compiled binary bytecode
+  uint64_t                  mDriverIdentity; ///< identity of the driver which compiled the binary, zero if unknown
 
 };
 
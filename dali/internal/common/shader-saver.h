@@ -45,6 +45,14 @@ public:
    */
   virtual void SaveBinary( Internal::ShaderDataPtr shaderData ) = 0;
 
+  /**
+   * A function notifying that a program is ready to be drawn with, or passing the notification on.
+   * @param[in] shaderHash The hash of the sources of the program.
+   * @param[in] compiledInBackground True if the program has been compiled in the background since it was created,
+   *                                 so the renderers skipped meanwhile should be drawn.
+   */
+  virtual void ProgramReady( size_t shaderHash, bool compiledInBackground ) = 0;
+
 protected:
   /**
    * Destructor. Protected as no derived class should ever be deleted
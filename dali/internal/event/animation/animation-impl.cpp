@@ -174,7 +174,8 @@ Animation::Animation( EventThreadServices& eventThreadServices, AnimationPlaylis
   mState(Dali::Animation::STOPPED),
   mProgressReachedMarker( 0.0f ),
   mDelaySeconds( 0.0f ),
-  mAutoReverseEnabled( false )
+  mAutoReverseEnabled( false ),
+  mSampleCustomAlphaFunctions( false )
 {
 }
 
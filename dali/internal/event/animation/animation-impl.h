@@ -94,6 +94,22 @@ public:
    */
   float GetProgressNotification();
 
+  /**
+   * @copydoc Dali::DevelAnimation::SetSampleCustomAlphaFunctions()
+   */
+  void SetSampleCustomAlphaFunctions( bool sample )
+  {
+    mSampleCustomAlphaFunctions = sample;
+  }
+
+  /**
+   * @copydoc Dali::DevelAnimation::GetSampleCustomAlphaFunctions()
+   */
+  bool GetSampleCustomAlphaFunctions() const
+  {
+    return mSampleCustomAlphaFunctions;
+  }
+
   /**
    * @copydoc Dali::Animation::GetDuration()
    */
@@ -549,6 +565,7 @@ private:
   float mProgressReachedMarker;
   float mDelaySeconds;
   bool mAutoReverseEnabled;  ///< Flag to identify that the looping mode is auto reverse.
+  bool mSampleCustomAlphaFunctions; ///< Whether the custom alpha functions of new animators are sampled into a table.
 };
 
 } // namespace Internal
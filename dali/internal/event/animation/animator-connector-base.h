@@ -118,6 +118,12 @@ public:
 
     DALI_ASSERT_DEBUG( mAnimator != nullptr );
 
+    // The animator isn't in the update thread yet, so its custom alpha function can still be sampled here
+    if( mParent->GetSampleCustomAlphaFunctions() )
+    {
+      mAnimator->SetCustomAlphaFunctionSampled( true );
+    }
+
     // Add the new SceneGraph::Animator to its correspondent SceneGraph::Animation via message
     const SceneGraph::Animation* animation = mParent->GetSceneObject();
     DALI_ASSERT_DEBUG( nullptr != animation );
@@ -64,6 +64,7 @@ ConstraintBase::ConstraintBase( Object& object, Property::Index targetPropertyIn
   mRemoveAction( Dali::Constraint::DEFAULT_REMOVE_ACTION ),
   mTag( 0 ),
   mApplied( false ),
+  mEvaluateEveryFrame( false ),
   mSourceDestroyed( false )
 {
   ObserveObject( object );
@@ -77,6 +78,7 @@ ConstraintBase* ConstraintBase::Clone( Object& object )
   ConstraintBase* clone = DoClone( object );
   clone->SetRemoveAction( mRemoveAction );
   clone->SetTag( mTag );
+  clone->SetEvaluateEveryFrame( mEvaluateEveryFrame );
   return clone;
 }
 
@@ -172,6 +174,21 @@ ConstraintBase::RemoveAction ConstraintBase::GetRemoveAction() const
   return mRemoveAction;
 }
 
+void ConstraintBase::SetEvaluateEveryFrame( bool evaluateEveryFrame )
+{
+  mEvaluateEveryFrame = evaluateEveryFrame;
+
+  if ( mSceneGraphConstraint )
+  {
+    SceneGraph::SetEvaluateEveryFrameMessage( GetEventThreadServices(), *mSceneGraphConstraint, evaluateEveryFrame );
+  }
+}
+
+bool ConstraintBase::GetEvaluateEveryFrame() const
+{
+  return mEvaluateEveryFrame;
+}
+
 void ConstraintBase::SetTag( uint32_t tag )
 {
   mTag = tag;
@@ -125,6 +125,16 @@ public:
    */
   RemoveAction GetRemoveAction() const;
 
+  /**
+   * @copydoc Dali::DevelConstraint::SetEvaluateEveryFrame()
+   */
+  void SetEvaluateEveryFrame( bool evaluateEveryFrame );
+
+  /**
+   * @copydoc Dali::DevelConstraint::GetEvaluateEveryFrame()
+   */
+  bool GetEvaluateEveryFrame() const;
+
   /**
    * @copydoc Dali::Constraint::SetTag()
    */
@@ -226,6 +236,7 @@ protected:
   RemoveAction mRemoveAction;
   uint32_t mTag;
   bool mApplied:1; ///< Whether the constraint has been applied
+  bool mEvaluateEveryFrame:1; ///< Whether the constraint function is called even if its inputs didn't change
   bool mSourceDestroyed:1; ///< Is set to true if any of our input source objects are destroyed
 };
 
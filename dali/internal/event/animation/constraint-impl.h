@@ -153,6 +153,7 @@ private:
         resetter = SceneGraph::ConstraintResetter::New( targetObject, *targetProperty, *mSceneGraphConstraint );
       }
       OwnerPointer< SceneGraph::ConstraintBase > transferOwnership( const_cast< SceneGraph::ConstraintBase* >( mSceneGraphConstraint ) );
+      transferOwnership->SetEvaluateEveryFrame( mEvaluateEveryFrame );
       ApplyConstraintMessage( GetEventThreadServices(), targetObject, transferOwnership );
       if( resetter )
       {
@@ -384,6 +385,7 @@ private:
       if( mSceneGraphConstraint )
       {
         OwnerPointer< SceneGraph::ConstraintBase > transferOwnership( const_cast< SceneGraph::ConstraintBase* >( mSceneGraphConstraint ) );
+        transferOwnership->SetEvaluateEveryFrame( mEvaluateEveryFrame );
         ApplyConstraintMessage( GetEventThreadServices(), targetObject, transferOwnership );
         if( resetterRequired )
         {
@@ -18,6 +18,10 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+
 // INTERNAL INCLUDES
 #include <dali/internal/event/animation/progress-value.h>
 #include <dali/public-api/animation/animation.h>
@@ -65,7 +69,13 @@ public:
 
   KeyFrameChannel(KeyFrameChannelId channel_id, ProgressValues& values )
   : KeyFrameChannelBase(channel_id),
-    mValues(values)
+    mValues(values),
+    mPrevious(),
+    mNext(),
+    mPreparedCount( 0u ),
+    mCursor( 0u ),
+    mNeighboursInterval( NO_INTERVAL ),
+    mUniformStep( 0.0f )
   {
   }
 
@@ -78,11 +88,41 @@ public:
 
   V GetValue(float progress, Dali::Animation::Interpolation interpolation) const;
 
-  bool FindInterval(typename ProgressValues::iterator& start,
-                    typename ProgressValues::iterator& end,
-                    float progress) const;
+  /**
+   * Find the interval containing progress.
+   * The interval of the previous call is checked first, then its successor, so monotonic playback
+   * usually finds the interval straight away. Otherwise uniformly spaced key frames are indexed
+   * directly, and the others are binary searched.
+   * @param[in] progress The progress
+   * @param[out] interval The index of the key frame which starts the interval
+   * @return True if an interval contains progress
+   */
+  bool FindInterval(float progress, std::size_t& interval) const;
 
   ProgressValues& mValues;
+
+private:
+
+  /**
+   * Reset the cached search state, as the key frames have changed.
+   */
+  void Prepare() const;
+
+  /**
+   * Calculate the values before and after an interval, which cubic interpolation needs.
+   * @param[in] interval The index of the key frame which starts the interval
+   */
+  void CalculateNeighbours(std::size_t interval) const;
+
+  static const std::size_t NO_INTERVAL = static_cast<std::size_t>( -1 ); ///< Means that no interval is cached
+
+  // The cached search state; each animator has its own copy of the key frames, so it follows one playback
+  mutable V mPrevious;                      ///< The value before the interval in mNeighboursInterval
+  mutable V mNext;                          ///< The value after the interval in mNeighboursInterval
+  mutable std::size_t mPreparedCount;       ///< The number of key frames when the state was last reset
+  mutable std::size_t mCursor;              ///< The interval found by the last search
+  mutable std::size_t mNeighboursInterval;  ///< The interval of mPrevious and mNext, or NO_INTERVAL
+  mutable float mUniformStep;               ///< The progress between uniformly spaced key frames, or 0
 };
 
 template <class V>
@@ -101,41 +141,118 @@ bool KeyFrameChannel<V>::IsActive (float progress)
   return active;
 }
 
-/**
- * Use a linear search to find the interval containing progress
- */
 template <class V>
-bool KeyFrameChannel<V>::FindInterval(
-  typename ProgressValues::iterator& start,
-  typename ProgressValues::iterator& end,
-  float progress) const
+void KeyFrameChannel<V>::Prepare() const
 {
-  bool found = false;
-  typename std::vector<ProgressValue<V> >::iterator iter = mValues.begin();
-  typename std::vector<ProgressValue<V> >::iterator prevIter = iter;
+  const std::size_t count = mValues.size();
+  mPreparedCount = count;
+  mCursor = 0u;
+  mNeighboursInterval = NO_INTERVAL;
+  mUniformStep = 0.0f;
+
+  if( count >= 2u )
+  {
+    // Baked tracks are usually uniformly spaced, which lets the interval be indexed directly
+    const float first = mValues.front().GetProgress();
+    const float step = ( mValues.back().GetProgress() - first ) / static_cast<float>( count - 1u );
+    bool uniform = ( step > 0.0f );
+    for( std::size_t i = 1u; uniform && i < count - 1u; ++i )
+    {
+      uniform = ( std::abs( mValues[i].GetProgress() - ( first + static_cast<float>( i ) * step ) ) <= step * 0.001f );
+    }
+    if( uniform )
+    {
+      mUniformStep = step;
+    }
+  }
+}
+
+template <class V>
+bool KeyFrameChannel<V>::FindInterval(float progress, std::size_t& interval) const
+{
+  if( mValues.size() != mPreparedCount )
+  {
+    Prepare();
+  }
+
+  const std::size_t count = mValues.size();
+  if( count < 2u )
+  {
+    return false;
+  }
+  const std::size_t lastInterval = count - 2u;
+
+  // Try the interval of the last search, then the next one
+  std::size_t index = mCursor;
+  if( !( mValues[index].GetProgress() <= progress && mValues[index + 1u].GetProgress() > progress ) )
+  {
+    if( index < lastInterval && mValues[index + 1u].GetProgress() <= progress && mValues[index + 2u].GetProgress() > progress )
+    {
+      ++index;
+    }
+    else if( mUniformStep > 0.0f )
+    {
+      const float position = std::max( ( progress - mValues.front().GetProgress() ) / mUniformStep, 0.0f );
+      index = std::min( static_cast<std::size_t>( position ), lastInterval );
+
+      // Correct any rounding of the key frame times
+      while( index > 0u && mValues[index].GetProgress() > progress )
+      {
+        --index;
+      }
+      while( index < lastInterval && mValues[index + 1u].GetProgress() <= progress )
+      {
+        ++index;
+      }
+    }
+    else
+    {
+      // Find the first key frame after progress; the interval ends there
+      const typename ProgressValues::const_iterator end =
+        std::upper_bound( mValues.begin(), mValues.end(), progress,
+                          []( float value, const ProgressValue<V>& keyFrame ) { return value < keyFrame.GetProgress(); } );
+      const std::size_t endIndex = static_cast<std::size_t>( end - mValues.begin() );
+      index = ( endIndex > 0u ) ? std::min( endIndex - 1u, lastInterval ) : 0u;
+    }
+  }
 
-  while(iter != mValues.end() && iter->GetProgress() <= progress)
+  if( mValues[index].GetProgress() <= progress && mValues[index + 1u].GetProgress() > progress )
   {
-    prevIter = iter;
-    ++iter;
+    mCursor = index;
+    interval = index;
+    return true;
   }
 
-  if(iter == mValues.end())
+  return false;
+}
+
+template <class V>
+void KeyFrameChannel<V>::CalculateNeighbours(std::size_t interval) const
+{
+  const V& start = mValues[interval].GetValue();
+  const V& end = mValues[interval + 1u].GetValue();
+
+  if( interval > 0u )
+  {
+    mPrevious = mValues[interval - 1u].GetValue();
+  }
+  else
   {
-    --prevIter;
-    --iter;
+    //Project next value through start point
+    mPrevious = start + (start - end);
   }
 
-  if(prevIter->GetProgress() <= progress
-     &&
-     iter->GetProgress() > progress)
+  if( interval + 2u < mValues.size() )
   {
-    found = true;
-    start = prevIter;
-    end   = iter;
+    mNext = mValues[interval + 2u].GetValue();
+  }
+  else
+  {
+    //Project prev value through end point
+    mNext = end + (end - start);
   }
 
-  return found;
+  mNeighboursInterval = interval;
 }
 
 template <class V>
@@ -143,48 +260,32 @@ V KeyFrameChannel<V>::GetValue (float progress, Dali::Animation::Interpolation i
 {
   ProgressValue<V>&  firstPV =  mValues.front();
 
-  typename std::vector<ProgressValue<V> >::iterator start;
-  typename std::vector<ProgressValue<V> >::iterator end;
+  std::size_t interval = 0u;
 
   V interpolatedV = firstPV.GetValue();
   if(progress >= mValues.back().GetProgress() )
   {
     interpolatedV = mValues.back().GetValue(); // This should probably be last value...
   }
-  else if(FindInterval(start, end, progress))
+  else if(FindInterval(progress, interval))
   {
-    float frameProgress = (progress - start->GetProgress()) / (end->GetProgress() - start->GetProgress());
+    const ProgressValue<V>& start = mValues[interval];
+    const ProgressValue<V>& end = mValues[interval + 1u];
+    float frameProgress = (progress - start.GetProgress()) / (end.GetProgress() - start.GetProgress());
 
     if( interpolation == Dali::Animation::Linear )
     {
-      Interpolate(interpolatedV, start->GetValue(), end->GetValue(), frameProgress);
+      Interpolate(interpolatedV, start.GetValue(), end.GetValue(), frameProgress);
     }
     else
     {
-      //Calculate prev and next values
-      V prev;
-      if( start != mValues.begin() )
-      {
-        prev = (start-1)->GetValue();
-      }
-      else
-      {
-        //Project next value through start point
-        prev = start->GetValue() + (start->GetValue()-(start+1)->GetValue());
-      }
-
-      V next;
-      if( end != mValues.end()-1)
-      {
-        next = (end+1)->GetValue();
-      }
-      else
+      // The neighbours only change when playback moves to another interval
+      if( mNeighboursInterval != interval )
       {
-        //Project prev value through end point
-        next = end->GetValue() + (end->GetValue()-(end-1)->GetValue());
+        CalculateNeighbours( interval );
       }
 
-      CubicInterpolate(interpolatedV, prev, start->GetValue(), end->GetValue(), next, frameProgress);
+      CubicInterpolate(interpolatedV, mPrevious, start.GetValue(), end.GetValue(), mNext, frameProgress);
     }
   }
 
@@ -52,6 +52,9 @@ public:
   PropertyConstraint( ConstraintFunction* func )
   : mFunction( func ),
     mInputs(),
+    mInputIndices(),
+    mIndices(),
+    mInputVersions(),
     mInputsInitialized( false )
   {
   }
@@ -65,6 +68,9 @@ public:
                       const InputContainer& inputs )
   : mFunction( func ),
     mInputs( inputs ),
+    mInputIndices(),
+    mIndices(),
+    mInputVersions(),
     mInputsInitialized( false )
   {
   }
@@ -162,6 +168,31 @@ public:
     return false;
   }
 
+  /**
+   * Query whether the values of any of the inputs may have changed since the last query.
+   * The versions of the inputs identify their values in either buffer, so the values read in the
+   * previous frame, from the other buffer, are compared.
+   * The inputs which don't track the changes of their values are always treated as changed, as is a
+   * constraint without inputs, since its function can only depend on state outside of the scene-graph.
+   * @param[in] bufferIndex The current update buffer index.
+   * @return True if any of the inputs may have changed.
+   */
+  bool InputVersionsChanged( BufferIndex bufferIndex )
+  {
+    const uint32_t noOfInputs = static_cast<uint32_t>( mInputs.size() );
+    bool changed = ( noOfInputs == 0u ) || ( mInputVersions.size() != noOfInputs );
+    mInputVersions.resize( noOfInputs, 0u );
+
+    for( uint32_t index = 0u; index < noOfInputs; ++index )
+    {
+      const uint32_t version = mInputs[ index ].GetInput()->GetVersion( bufferIndex );
+      changed |= ( version == 0u ) || ( version != mInputVersions[ index ] );
+      mInputVersions[ index ] = version;
+    }
+
+    return changed;
+  }
+
   /**
    * Apply the constraint.
    * @param [in] bufferIndex The current update buffer index.
@@ -169,23 +200,35 @@ public:
    */
   void Apply( BufferIndex bufferIndex, PropertyType& current )
   {
-    InputIndexerContainer inputIndices;
-    PropertyInputContainer indices;
     const uint32_t noOfInputs = static_cast<uint32_t>( mInputs.size() );
+    if( mIndices.Count() != noOfInputs )
+    {
+      // The inputs have changed, so the indexers are rebuilt; they are reused in later frames
+      mInputIndices.clear();
+      mIndices.Clear();
+      mInputIndices.reserve( noOfInputs );
+      mIndices.Reserve( noOfInputs );
 
-    inputIndices.reserve( noOfInputs );
-    indices.Reserve( noOfInputs );
-
-    const auto&& endIter = mInputs.end();
-    uint32_t index = 0;
-    for ( auto&& iter = mInputs.begin(); iter != endIter; ++iter, ++index )
+      const auto&& endIter = mInputs.end();
+      for ( auto&& iter = mInputs.begin(); iter != endIter; ++iter )
+      {
+        DALI_ASSERT_DEBUG( nullptr != iter->GetInput() );
+        mInputIndices.push_back( PropertyInputIndexer< PropertyInputAccessor >( bufferIndex, &*iter ) );
+      }
+      for ( auto&& iter = mInputIndices.begin(); iter != mInputIndices.end(); ++iter )
+      {
+        mIndices.PushBack( &*iter );
+      }
+    }
+    else if( noOfInputs > 0u && mInputIndices[0].mBufferIndex != bufferIndex )
     {
-      DALI_ASSERT_DEBUG( nullptr != iter->GetInput() );
-      inputIndices.push_back( PropertyInputIndexer< PropertyInputAccessor >( bufferIndex, &*iter ) );
-      indices.PushBack( &inputIndices[ index ] );
+      for ( auto&& iter = mInputIndices.begin(); iter != mInputIndices.end(); ++iter )
+      {
+        iter->mBufferIndex = bufferIndex;
+      }
     }
 
-    CallbackBase::Execute< PropertyType&, const PropertyInputContainer& >( *mFunction, current, indices );
+    CallbackBase::Execute< PropertyType&, const PropertyInputContainer& >( *mFunction, current, mIndices );
   }
 
 private:
@@ -199,6 +242,9 @@ private:
 
   ConstraintFunction* mFunction;
   InputContainer mInputs;
+  InputIndexerContainer mInputIndices;    ///< Indexers of the inputs, reused by every call to Apply
+  PropertyInputContainer mIndices;        ///< Pointers to the indexers, as passed to the constraint function
+  std::vector< uint32_t > mInputVersions; ///< The versions of the input values when they were last queried
   bool mInputsInitialized;
 
 };
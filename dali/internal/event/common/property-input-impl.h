@@ -307,6 +307,18 @@ public:
     return false;
   }
 
+  /**
+   * Query the version of the property value in a buffer, which changes whenever the value may have changed.
+   * Lets the value be compared with the one read earlier, from either buffer, without reading it again;
+   * values with the same version are the same.
+   * @param[in] bufferIndex The buffer to query.
+   * @return The version of the value, or zero if the changes of the value are not tracked.
+   */
+  virtual uint32_t GetVersion( BufferIndex bufferIndex ) const
+  {
+    return 0u;
+  }
+
   /**
    * Print the property value using a stream.
    * @param[in] debugStream The output stream.
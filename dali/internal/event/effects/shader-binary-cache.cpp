@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/event/effects/shader-binary-cache.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <dali/integration-api/platform-abstraction.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const uint32_t ARCHIVE_MAGIC = 0x41425344;   ///< "DSBA" in little endian
+const uint32_t ARCHIVE_VERSION = 1u;         ///< Changed when the layout of the archive changes
+const std::size_t MAXIMUM_SIZE = 8u << 20u;  ///< The maximum size of the binaries in the archive
+
+/**
+ * The header of the archive
+ */
+struct ArchiveHeader
+{
+  uint32_t magic;          ///< ARCHIVE_MAGIC
+  uint32_t version;        ///< ARCHIVE_VERSION
+  uint64_t driverIdentity; ///< The identity of the driver which compiled the binaries inserted last
+  uint32_t useCount;       ///< The number of times binaries have been used
+  uint32_t entryCount;     ///< The number of binaries, whose index follows the header
+};
+
+/**
+ * The index of a binary in the archive
+ */
+struct ArchiveEntry
+{
+  uint64_t key;      ///< The key of the binary
+  uint32_t lastUsed; ///< When the binary was last used
+  uint32_t offset;   ///< The offset of the binary from the start of the archive
+  uint32_t size;     ///< The size of the binary
+  uint32_t padding;  ///< Keeps the entries aligned
+};
+
+} // unnamed namespace
+
+ShaderBinaryCache::Preloader::Preloader( ShaderBinaryCache& cache )
+: mCache( cache )
+{
+}
+
+ShaderBinaryCache::Preloader::~Preloader()
+{
+  Join();
+}
+
+void ShaderBinaryCache::Preloader::Run()
+{
+  mCache.Preload();
+}
+
+ShaderBinaryCache::Writer::Writer( ShaderBinaryCache& cache )
+: mCache( cache )
+{
+}
+
+ShaderBinaryCache::Writer::~Writer()
+{
+  Join();
+}
+
+void ShaderBinaryCache::Writer::Run()
+{
+  mCache.Write();
+}
+
+ShaderBinaryCache::ShaderBinaryCache( Integration::PlatformAbstraction& platformAbstraction, const std::string& filename )
+: mPlatformAbstraction( platformAbstraction ),
+  mFilename( filename ),
+  mEntries(),
+  mPreloader( *this ),
+  mWriter( *this ),
+  mArchive(),
+  mMutex(),
+  mSize( 0u ),
+  mDriverIdentity( 0u ),
+  mCurrentDriverIdentity( 0u ),
+  mUseCount( 0u ),
+  mWriting( false ),
+  mFileThreadSafe( platformAbstraction.IsShaderBinaryFileThreadSafe() ),
+  mPreloading( true ),
+  mModified( false )
+{
+  if( !mFileThreadSafe && !mPlatformAbstraction.LoadShaderBinaryFile( mFilename, mArchive ) )
+  {
+    mArchive.Clear();
+  }
+  mPreloader.Start();
+}
+
+ShaderBinaryCache::~ShaderBinaryCache()
+{
+  WaitForSave();
+  Save();
+  WaitForSave();
+}
+
+bool ShaderBinaryCache::Find( uint64_t key, Dali::Vector< uint8_t >& binary )
+{
+  WaitForPreload();
+
+  auto iter = mEntries.find( key );
+  if( iter == mEntries.end() )
+  {
+    return false;
+  }
+
+  iter->second.lastUsed = ++mUseCount;
+  binary = iter->second.binary;
+  return true;
+}
+
+void ShaderBinaryCache::Insert( uint64_t key, const Dali::Vector< uint8_t >& binary )
+{
+  WaitForPreload();
+
+  Entry& entry = mEntries[ key ];
+  mSize = mSize - entry.binary.Count() + binary.Count();
+  entry.binary = binary;
+  entry.lastUsed = ++mUseCount;
+  mModified = true;
+
+  Evict();
+}
+
+uint64_t ShaderBinaryCache::GetDriverIdentity()
+{
+  WaitForPreload();
+
+  return mDriverIdentity;
+}
+
+void ShaderBinaryCache::SetDriverIdentity( uint64_t driverIdentity )
+{
+  Mutex::ScopedLock lock( mMutex );
+  mCurrentDriverIdentity = driverIdentity;
+}
+
+void ShaderBinaryCache::Save()
+{
+  WaitForPreload();
+
+  if( mModified )
+  {
+    {
+      Mutex::ScopedLock lock( mMutex );
+      if( mWriting )
+      {
+        // Saved once the archive being written has been written
+        return;
+      }
+      mWriting = true;
+    }
+
+    // Release the thread of the previous write, which has finished
+    mWriter.Join();
+
+    WriteArchive( mArchive );
+    mModified = false;
+
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Saving %u binaries to file: %s\n", static_cast< uint32_t >( mEntries.size() ), mFilename.c_str() );
+    if( mFileThreadSafe )
+    {
+      mWriter.Start();
+    }
+    else
+    {
+      Write();
+    }
+  }
+}
+
+void ShaderBinaryCache::WaitForSave()
+{
+  mWriter.Join();
+}
+
+void ShaderBinaryCache::Preload()
+{
+  if( mFileThreadSafe && !mPlatformAbstraction.LoadShaderBinaryFile( mFilename, mArchive ) )
+  {
+    mArchive.Clear();
+  }
+
+  const bool valid = mArchive.Empty() || ReadArchive( mArchive );
+  mArchive.Release();
+  if( !valid )
+  {
+    // Start again with an empty archive rather than trust any of a damaged one
+    mEntries.clear();
+    mSize = 0u;
+    mDriverIdentity = 0u;
+    mUseCount = 0u;
+  }
+}
+
+void ShaderBinaryCache::WaitForPreload()
+{
+  if( mPreloading )
+  {
+    mPreloader.Join();
+    mPreloading = false;
+
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Preloaded %u binaries from file: %s\n", static_cast< uint32_t >( mEntries.size() ), mFilename.c_str() );
+  }
+
+  uint64_t currentDriverIdentity;
+  {
+    Mutex::ScopedLock lock( mMutex );
+    currentDriverIdentity = mCurrentDriverIdentity;
+  }
+
+  if( currentDriverIdentity != 0u && currentDriverIdentity != mDriverIdentity )
+  {
+    // None of the binaries can be used by the current driver, and they are removed from the file when it is next saved
+    if( !mEntries.empty() )
+    {
+      DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Discarding %u binaries of another driver from file: %s\n", static_cast< uint32_t >( mEntries.size() ), mFilename.c_str() );
+      mEntries.clear();
+      mSize = 0u;
+      mModified = true;
+    }
+    mDriverIdentity = currentDriverIdentity;
+  }
+}
+
+void ShaderBinaryCache::Write()
+{
+  const bool saved = mPlatformAbstraction.SaveShaderBinaryFile( mFilename, mArchive.Begin(), static_cast< uint32_t >( mArchive.Count() ) );
+  if( !saved )
+  {
+    DALI_LOG_ERROR( "Saving the shader binaries failed: %s\n", mFilename.c_str() );
+  }
+  mArchive.Release();
+
+  Mutex::ScopedLock lock( mMutex );
+  mWriting = false;
+}
+
+bool ShaderBinaryCache::ReadArchive( const Dali::Vector< uint8_t >& archive )
+{
+  const std::size_t archiveSize = archive.Count();
+  ArchiveHeader header;
+  if( archiveSize < sizeof( header ) )
+  {
+    return false;
+  }
+
+  memcpy( &header, archive.Begin(), sizeof( header ) );
+  if( header.magic != ARCHIVE_MAGIC || header.version != ARCHIVE_VERSION ||
+      header.entryCount > ( archiveSize - sizeof( header ) ) / sizeof( ArchiveEntry ) )
+  {
+    return false;
+  }
+
+  mDriverIdentity = header.driverIdentity;
+  mUseCount = header.useCount;
+  mEntries.reserve( header.entryCount );
+
+  const uint8_t* index = archive.Begin() + sizeof( header );
+  for( uint32_t i = 0u; i < header.entryCount; ++i )
+  {
+    ArchiveEntry archiveEntry;
+    memcpy( &archiveEntry, index + i * sizeof( ArchiveEntry ), sizeof( archiveEntry ) );
+    if( archiveEntry.offset > archiveSize || archiveEntry.size > archiveSize - archiveEntry.offset )
+    {
+      return false;
+    }
+
+    Entry& entry = mEntries[ archiveEntry.key ];
+    entry.binary.Resize( archiveEntry.size );
+    memcpy( entry.binary.Begin(), archive.Begin() + archiveEntry.offset, archiveEntry.size );
+    entry.lastUsed = archiveEntry.lastUsed;
+    mSize += archiveEntry.size;
+  }
+
+  return true;
+}
+
+void ShaderBinaryCache::WriteArchive( Dali::Vector< uint8_t >& archive ) const
+{
+  // The most recently used binaries are written first
+  std::vector< std::pair< uint64_t, const Entry* > > entries;
+  entries.reserve( mEntries.size() );
+  for( auto&& entry : mEntries )
+  {
+    entries.push_back( std::make_pair( entry.first, &entry.second ) );
+  }
+  std::sort( entries.begin(), entries.end(),
+             []( const std::pair< uint64_t, const Entry* >& lhs, const std::pair< uint64_t, const Entry* >& rhs ) { return lhs.second->lastUsed > rhs.second->lastUsed; } );
+
+  ArchiveHeader header;
+  header.magic = ARCHIVE_MAGIC;
+  header.version = ARCHIVE_VERSION;
+  header.driverIdentity = mDriverIdentity;
+  header.useCount = mUseCount;
+  header.entryCount = static_cast< uint32_t >( entries.size() );
+
+  const std::size_t indexSize = sizeof( header ) + entries.size() * sizeof( ArchiveEntry );
+  archive.Resize( indexSize + mSize );
+  memcpy( archive.Begin(), &header, sizeof( header ) );
+
+  std::size_t offset = indexSize;
+  for( uint32_t i = 0u; i < header.entryCount; ++i )
+  {
+    const Entry& entry = *entries[i].second;
+
+    ArchiveEntry archiveEntry;
+    archiveEntry.key = entries[i].first;
+    archiveEntry.lastUsed = entry.lastUsed;
+    archiveEntry.offset = static_cast< uint32_t >( offset );
+    archiveEntry.size = static_cast< uint32_t >( entry.binary.Count() );
+    archiveEntry.padding = 0u;
+    memcpy( archive.Begin() + sizeof( header ) + i * sizeof( ArchiveEntry ), &archiveEntry, sizeof( archiveEntry ) );
+
+    memcpy( archive.Begin() + offset, entry.binary.Begin(), entry.binary.Count() );
+    offset += entry.binary.Count();
+  }
+}
+
+void ShaderBinaryCache::Evict()
+{
+  while( mSize > MAXIMUM_SIZE && mEntries.size() > 1u )
+  {
+    auto leastRecentlyUsed = std::min_element( mEntries.begin(), mEntries.end(),
+                                               []( const std::pair< const uint64_t, Entry >& lhs, const std::pair< const uint64_t, Entry >& rhs ) { return lhs.second.lastUsed < rhs.second.lastUsed; } );
+    mSize -= leastRecentlyUsed->second.binary.Count();
+    mEntries.erase( leastRecentlyUsed );
+  }
+}
+
+} // namespace Internal
+
+} // namespace Dali
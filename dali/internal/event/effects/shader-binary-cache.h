@@ -0,0 +1,250 @@
+#ifndef DALI_INTERNAL_SHADER_BINARY_CACHE_H
+#define DALI_INTERNAL_SHADER_BINARY_CACHE_H
+
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <string>
+#include <unordered_map>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/devel-api/threading/mutex.h>
+#include <dali/devel-api/threading/thread.h>
+
+namespace Dali
+{
+
+namespace Integration
+{
+class PlatformAbstraction;
+}
+
+namespace Internal
+{
+
+/**
+ * @brief ShaderBinaryCache keeps the shader binaries in a single archive file.
+ *
+ * The archive starts with an index of the binaries, most recently used first, followed by the binaries.
+ * It is read in one go on construction and its binaries are extracted by a thread, so they are in memory
+ * by the time the first shaders are created. Once the archive grows beyond its maximum size the least
+ * recently used binaries are evicted.
+ *
+ * The binaries are identified by 64 bit keys, which should include the identity of the driver that
+ * compiled them, as a binary can't be used by another driver. Once the identity of the current driver
+ * is known, an archive written for another driver is discarded as a whole.
+ *
+ * The file is only read and written on the event thread, unless the platform abstraction reports that
+ * this can be done from other threads. In that case the file is also read by the thread extracting the
+ * binaries, and it is written by a thread started by Save(). The binaries inserted while it is being
+ * written are saved once it has finished.
+ */
+class ShaderBinaryCache
+{
+public:
+
+  /**
+   * Constructor, starts reading the archive
+   * @param[in] platformAbstraction The platform abstraction which loads and saves the archive
+   * @param[in] filename The filename of the archive
+   */
+  ShaderBinaryCache( Integration::PlatformAbstraction& platformAbstraction, const std::string& filename );
+
+  /**
+   * Non-virtual destructor, saves the archive if it has changed and waits for it to be written
+   */
+  ~ShaderBinaryCache();
+
+  /**
+   * @brief Finds a binary, waiting for the archive to be read first.
+   * @param[in] key The key of the binary
+   * @param[out] binary The binary, left unchanged if it isn't found
+   * @return true if the binary was found
+   */
+  bool Find( uint64_t key, Dali::Vector< uint8_t >& binary );
+
+  /**
+   * @brief Inserts a binary, replacing any binary with the same key.
+   * @param[in] key The key of the binary
+   * @param[in] binary The binary
+   */
+  void Insert( uint64_t key, const Dali::Vector< uint8_t >& binary );
+
+  /**
+   * @brief Gets the identity of the driver the binaries are for.
+   * @return The identity of the current driver once it is known, otherwise that of the driver
+   *         which compiled the binaries of the archive; zero if neither is known
+   */
+  uint64_t GetDriverIdentity();
+
+  /**
+   * @brief Sets the identity of the current driver, which compiles the binaries.
+   * May be called from any thread; the binaries of another driver are discarded on the event thread.
+   * @param[in] driverIdentity The identity of the driver
+   */
+  void SetDriverIdentity( uint64_t driverIdentity );
+
+  /**
+   * @brief Starts writing the archive if binaries have been inserted since it was loaded or saved.
+   *
+   * The order the binaries were used in is only saved along with inserted binaries,
+   * so the archive isn't written each time the application starts. While the archive
+   * is being written, saving is left to the next call.
+   */
+  void Save();
+
+  /**
+   * @brief Waits for the archive being written by Save() to be written.
+   */
+  void WaitForSave();
+
+private:
+
+  /**
+   * Extracts the binaries of the archive on its own thread
+   */
+  class Preloader : public Thread
+  {
+  public:
+
+    /**
+     * Constructor
+     * @param[in] cache The cache to read the archive of
+     */
+    Preloader( ShaderBinaryCache& cache );
+
+    /**
+     * Destructor
+     */
+    virtual ~Preloader();
+
+  protected:
+
+    /**
+     * @copydoc Thread::Run
+     */
+    virtual void Run();
+
+  private:
+
+    ShaderBinaryCache& mCache;
+  };
+
+  /**
+   * Writes the archive on its own thread
+   */
+  class Writer : public Thread
+  {
+  public:
+
+    /**
+     * Constructor
+     * @param[in] cache The cache to write the archive of
+     */
+    Writer( ShaderBinaryCache& cache );
+
+    /**
+     * Destructor
+     */
+    virtual ~Writer();
+
+  protected:
+
+    /**
+     * @copydoc Thread::Run
+     */
+    virtual void Run();
+
+  private:
+
+    ShaderBinaryCache& mCache;
+  };
+
+  /**
+   * A binary of the cache
+   */
+  struct Entry
+  {
+    Dali::Vector< uint8_t > binary; ///< The binary
+    uint32_t lastUsed;              ///< When the binary was last used
+  };
+
+  /**
+   * Extracts the binaries of the archive, called on the thread of the preloader
+   */
+  void Preload();
+
+  /**
+   * Waits for the preloader to finish reading the archive, and discards the archive if it was written for another driver
+   */
+  void WaitForPreload();
+
+  /**
+   * Writes the archive built by Save(), called on the thread of the writer
+   */
+  void Write();
+
+  /**
+   * Reads the entries from the archive
+   * @param[in] archive The archive
+   * @return true if the archive is valid
+   */
+  bool ReadArchive( const Dali::Vector< uint8_t >& archive );
+
+  /**
+   * Writes the entries to an archive
+   * @param[out] archive The archive
+   */
+  void WriteArchive( Dali::Vector< uint8_t >& archive ) const;
+
+  /**
+   * Evicts the least recently used binaries until the cache fits its maximum size
+   */
+  void Evict();
+
+  // Undefined
+  ShaderBinaryCache( const ShaderBinaryCache& );
+
+  // Undefined
+  ShaderBinaryCache& operator=( const ShaderBinaryCache& );
+
+private:
+
+  Integration::PlatformAbstraction& mPlatformAbstraction;
+  std::string mFilename;                          ///< The filename of the archive
+  std::unordered_map< uint64_t, Entry > mEntries; ///< The binaries by their keys
+  Preloader mPreloader;                           ///< Extracts the binaries of the archive on construction
+  Writer mWriter;                                 ///< Writes the archive built by Save(), if the file may be written from its thread
+  Dali::Vector< uint8_t > mArchive;               ///< The archive being read or written, only accessed by the preloader or the writer while they run
+  Dali::Mutex mMutex;                             ///< Guards mCurrentDriverIdentity and mWriting
+  std::size_t mSize;                              ///< The total size of the binaries
+  uint64_t mDriverIdentity;                       ///< The identity of the driver which compiled the binaries
+  uint64_t mCurrentDriverIdentity;                ///< The identity of the current driver, zero until it is known
+  uint32_t mUseCount;                             ///< The number of times binaries have been used, stamps the entries
+  bool mWriting;                                  ///< Whether the writer is writing the archive
+  const bool mFileThreadSafe;                     ///< Whether the file may be read and written by the preloader and the writer
+  bool mPreloading:1;                             ///< Whether the preloader may still be reading the archive
+  bool mModified:1;                               ///< Whether binaries have been inserted since the archive was read or saved
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SHADER_BINARY_CACHE_H
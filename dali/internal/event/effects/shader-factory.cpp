@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,19 +20,20 @@
 
 // EXTERNAL INCLUDES
 #include <sstream>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/dali-core-version.h>
 #include <dali/public-api/common/dali-common.h>
 #include <dali/devel-api/common/hash.h>
 #include <dali/integration-api/debug.h>
-#include <dali/integration-api/platform-abstraction.h>
-#include <dali/internal/event/common/thread-local-storage.h>
+#include <dali/internal/common/hash-64.h>
+#include <dali/internal/event/rendering/shader-impl.h>
 
 namespace
 {
 const char* VERSION_SEPARATOR = "-";
-const char* SHADER_SUFFIX = ".dali-bin";
+const char* SHADER_ARCHIVE_SUFFIX = "shaders.dali-bin";
 }
 
 namespace Dali
@@ -45,59 +46,78 @@ namespace
 {
 
 /**
- * @brief Generates a filename for a shader binary based on the hash value passed in.
- * @param[in] shaderHash A hash over shader sources.
- * @param[out] filename A string to overwrite with the filename.
+ * @brief Generates the filename of the archive of the shader binaries.
+ * The archive isn't shared between versions of DALi, as the binaries may depend on the sources of the shaders.
+ * @return The filename
  */
-void shaderBinaryFilename( size_t shaderHash, std::string& filename )
+std::string ShaderBinaryArchiveFilename()
 {
   std::stringstream binaryShaderFilenameBuilder( std::ios_base::out );
   binaryShaderFilenameBuilder << CORE_MAJOR_VERSION << VERSION_SEPARATOR << CORE_MINOR_VERSION << VERSION_SEPARATOR << CORE_MICRO_VERSION << VERSION_SEPARATOR
-                              << shaderHash
-                              << SHADER_SUFFIX;
-  filename = binaryShaderFilenameBuilder.str();
+                              << SHADER_ARCHIVE_SUFFIX;
+  return binaryShaderFilenameBuilder.str();
 }
 
+/**
+ * @brief Calculates the 64 bit hash over the sources of a shader
+ * @param[in] vertexSource The vertex shader source code
+ * @param[in] fragmentSource The fragment shader source code
+ * @return The hash
+ */
+uint64_t CalculateSourceHash( const char* vertexSource, const char* fragmentSource )
+{
+  return CalculateHash64( fragmentSource, CalculateHash64( vertexSource ) );
 }
 
-ShaderFactory::ShaderFactory()
+/**
+ * @brief Calculates the key of the binary of a shader in the archive
+ * @param[in] sourceHash The hash over the sources of the shader
+ * @param[in] driverIdentity The identity of the driver which compiled the binary
+ * @return The key
+ */
+uint64_t CalculateBinaryKey( uint64_t sourceHash, uint64_t driverIdentity )
+{
+  return CalculateHash64( &driverIdentity, sizeof( driverIdentity ), CalculateHash64( &sourceHash, sizeof( sourceHash ) ) );
+}
+
+}
+
+ShaderFactory::ShaderFactory( Integration::PlatformAbstraction& platformAbstraction )
+: mShaderBinaryCache(),
+  mBinaryArchive( platformAbstraction, ShaderBinaryArchiveFilename() )
 {
 }
 
 ShaderFactory::~ShaderFactory()
 {
-  // Let all the cached objects destroy themselves:
-  for( std::size_t i = 0, cacheSize = mShaderBinaryCache.Size(); i < cacheSize; ++i )
-  {
-    if( mShaderBinaryCache[i] )
-    {
-      mShaderBinaryCache[i]->Unreference();
-    }
-  }
 }
 
 ShaderDataPtr ShaderFactory::Load( const std::string& vertexSource, const std::string& fragmentSource, const Dali::Shader::Hint::Value hints, size_t& shaderHash )
 {
-  // Work out the filename for the binary that the glsl source will be compiled and linked to:
+  // The programs are identified by this hash:
   shaderHash = CalculateHash( vertexSource.c_str(), fragmentSource.c_str() );
-  std::string binaryShaderFilename;
-  shaderBinaryFilename( shaderHash, binaryShaderFilename );
+  const uint64_t sourceHash = CalculateSourceHash( vertexSource.c_str(), fragmentSource.c_str() );
 
   ShaderDataPtr shaderData;
 
   /// Check a cache of previously loaded shaders:
-  for( std::size_t i = 0, cacheSize = mShaderBinaryCache.Size(); i < cacheSize; ++i )
+  auto iter = mShaderBinaryCache.find( sourceHash );
+  if( iter != mShaderBinaryCache.end() )
   {
-    if( mShaderBinaryCache[i]->GetHashValue() == shaderHash )
+    // A binary loaded before the identity of the driver was known may be for another driver
+    if( iter->second->GetDriverIdentity() == mBinaryArchive.GetDriverIdentity() )
     {
-      shaderData = mShaderBinaryCache[i];
+      shaderData = iter->second;
 
-      DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Mem cache hit on path: \"%s\"\n", binaryShaderFilename.c_str() );
-      break;
+      DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Mem cache hit for hash: %u\n", shaderHash );
+    }
+    else
+    {
+      mShaderBinaryCache.erase( iter );
     }
   }
 
-  // If memory cache failed check the file system for a binary or return a source-only ShaderData:
+  // If memory cache failed check the archive for a binary or return a source-only ShaderData:
   if( shaderData.Get() == NULL )
   {
     // Allocate the structure that returns the loaded shader:
@@ -105,20 +125,20 @@ ShaderDataPtr ShaderFactory::Load( const std::string& vertexSource, const std::s
     shaderData->SetHashValue( shaderHash );
     shaderData->GetBuffer().Clear();
 
-    // Try to load the binary (this will fail if the shader source has never been compiled before):
-    ThreadLocalStorage& tls = ThreadLocalStorage::Get();
-    Integration::PlatformAbstraction& platformAbstraction = tls.GetPlatformAbstraction();
-    const bool loaded = platformAbstraction.LoadShaderBinaryFile( binaryShaderFilename, shaderData->GetBuffer() );
+    // Try to find the binary (this will fail if the shader source has never been compiled by the driver before):
+    const uint64_t driverIdentity = mBinaryArchive.GetDriverIdentity();
+    const bool loaded = mBinaryArchive.Find( CalculateBinaryKey( sourceHash, driverIdentity ), shaderData->GetBuffer() );
 
     if( loaded )
     {
-      MemoryCacheInsert( *shaderData );
+      shaderData->SetDriverIdentity( driverIdentity );
+      MemoryCacheInsert( sourceHash, *shaderData );
     }
 
-    DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, loaded ?
-        "loaded on path: \"%s\"\n" :
-        "failed to load on path: \"%s\"\n",
-        binaryShaderFilename.c_str());
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, loaded ?
+        "loaded from archive for hash: %u\n" :
+        "failed to load from archive for hash: %u\n",
+        shaderHash );
   }
 
   return shaderData;
@@ -126,31 +146,68 @@ ShaderDataPtr ShaderFactory::Load( const std::string& vertexSource, const std::s
 
 void ShaderFactory::SaveBinary( Internal::ShaderDataPtr shaderData )
 {
-  // Save the binary to the file system:
-  std::string binaryShaderFilename;
-  shaderBinaryFilename( shaderData->GetHashValue(), binaryShaderFilename );
-
-  ThreadLocalStorage& tls = ThreadLocalStorage::Get();
-  Integration::PlatformAbstraction& platformAbstraction = tls.GetPlatformAbstraction();
-  const bool saved = platformAbstraction.SaveShaderBinaryFile( binaryShaderFilename, &shaderData->GetBuffer()[0], static_cast<unsigned int>( shaderData->GetBufferSize() ) ); // don't expect buffer larger than unsigned int
+  // Save the binary to the archive, which is written after the other compiled binaries have been saved:
+  const uint64_t sourceHash = CalculateSourceHash( shaderData->GetVertexShader(), shaderData->GetFragmentShader() );
+  mBinaryArchive.SetDriverIdentity( shaderData->GetDriverIdentity() );
+  mBinaryArchive.Insert( CalculateBinaryKey( sourceHash, shaderData->GetDriverIdentity() ), shaderData->GetBuffer() );
 
   // Save the binary into to memory cache:
-  MemoryCacheInsert( *shaderData );
+  MemoryCacheInsert( sourceHash, *shaderData );
+}
+
+void ShaderFactory::SaveBinaryArchive()
+{
+  mBinaryArchive.Save();
+}
+
+void ShaderFactory::SetDriverIdentity( uint64_t driverIdentity )
+{
+  mBinaryArchive.SetDriverIdentity( driverIdentity );
+}
 
-  DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, saved ? "Saved to file: %s\n" : "Save to file failed: %s\n", binaryShaderFilename.c_str() );
-  if( saved ) {} // Avoid unused variable warning in release builds
+void ShaderFactory::ProgramReady( size_t shaderHash, bool compiledInBackground )
+{
+  // Notifying may add or remove shaders, so the shaders to notify are gathered first
+  std::vector< Shader* > shaders;
+  auto range = mShaders.equal_range( shaderHash );
+  for( auto iter = range.first; iter != range.second; ++iter )
+  {
+    shaders.push_back( iter->second );
+  }
+  mShaders.erase( range.first, range.second );
+
+  for( auto&& shader : shaders )
+  {
+    shader->ProgramReady();
+  }
+}
+
+void ShaderFactory::AddShader( size_t shaderHash, Shader& shader )
+{
+  mShaders.insert( std::make_pair( shaderHash, &shader ) );
+}
+
+void ShaderFactory::RemoveShader( size_t shaderHash, Shader& shader )
+{
+  auto range = mShaders.equal_range( shaderHash );
+  for( auto iter = range.first; iter != range.second; ++iter )
+  {
+    if( iter->second == &shader )
+    {
+      mShaders.erase( iter );
+      break;
+    }
+  }
 }
 
-void ShaderFactory::MemoryCacheInsert( ShaderData& shaderData )
+void ShaderFactory::MemoryCacheInsert( uint64_t sourceHash, ShaderData& shaderData )
 {
   DALI_ASSERT_DEBUG( shaderData.GetBufferSize() > 0 );
 
   // Save the binary into to memory cache:
   if( shaderData.GetBufferSize() > 0 )
   {
-    mShaderBinaryCache.Reserve( mShaderBinaryCache.Size() + 1 ); // Make sure the push won't throw after we inc the ref count.
-    shaderData.Reference();
-    mShaderBinaryCache.PushBack( &shaderData );
+    mShaderBinaryCache[ sourceHash ] = &shaderData;
     DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "CACHED BINARY FOR HASH: %u\n", shaderData.GetHashValue() );
   }
 }
@@ -18,11 +18,14 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <unordered_map>
+
 // INTERNAL INCLUDES
-#include <dali/public-api/common/dali-vector.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/common/shader-data.h>
 #include <dali/internal/common/shader-saver.h>
+#include <dali/internal/event/effects/shader-binary-cache.h>
 
 namespace Dali
 {
@@ -30,22 +33,25 @@ namespace Dali
 namespace Internal
 {
 
+class Shader;
 class ShaderData;
 typedef IntrusivePtr<ShaderData> ShaderDataPtr;
 
 /**
- * @brief ShaderFactory loads and saves shader binaries synchronously.
+ * @brief ShaderFactory loads and saves shader binaries through a ShaderBinaryCache.
  *
- * Binaries loaded or saved are also cached by the ShaderFactory.
+ * The archive of the binaries is read in the background on construction, and
+ * binaries loaded or saved are also cached in memory by the ShaderFactory.
  */
 class ShaderFactory : public ShaderSaver
 {
 public:
 
   /**
-   * Default constructor
+   * Constructor
+   * @param[in] platformAbstraction The platform abstraction which loads and saves the archive of the binaries
    */
-  ShaderFactory();
+  ShaderFactory( Integration::PlatformAbstraction& platformAbstraction );
 
   /**
    * Destructor
@@ -56,7 +62,7 @@ public:
    * @brief Looks for precompiled binary version of shader program in memory and file caches.
    *
    * Tries to load a binary version of a shader program identified by a hash over the two source
-   * files, checking an in-memory cache first.
+   * files and the driver, checking an in-memory cache first.
    * If the cache hits or the load succeeds, the buffer member of the returned ShaderData will
    * contain a precompiled shader binary program which can be uploaded directly to GLES.
    *
@@ -79,9 +85,45 @@ public:
    */
   virtual void SaveBinary( Internal::ShaderDataPtr shader );
 
+  /**
+   * @brief Saves the archive of the binaries if binaries have been saved since it was last written.
+   *
+   * Called after the messages of the binaries compiled by the render thread have been processed,
+   * so the binaries compiled together are written at once. The file is written in the background.
+   */
+  void SaveBinaryArchive();
+
+  /**
+   * @brief Sets the identity of the driver which compiles the shaders.
+   * Called on the render thread once the GL context has been created.
+   * @param[in] driverIdentity The identity of the driver
+   */
+  void SetDriverIdentity( uint64_t driverIdentity );
+
+  /**
+   * @brief Notifies the shaders using a program that it is ready to be drawn.
+   * @param[in] shaderHash The hash of the sources of the program.
+   * @param[in] compiledInBackground True if the program has been compiled in the background since it was created.
+   */
+  virtual void ProgramReady( size_t shaderHash, bool compiledInBackground );
+
+  /**
+   * @brief Registers a shader to be notified when the program of its sources is ready.
+   * @param[in] shaderHash The hash of the sources of the shader.
+   * @param[in] shader The shader to notify.
+   */
+  void AddShader( size_t shaderHash, Shader& shader );
+
+  /**
+   * @brief Unregisters a shader added with AddShader.
+   * @param[in] shaderHash The hash of the sources of the shader.
+   * @param[in] shader The shader to unregister.
+   */
+  void RemoveShader( size_t shaderHash, Shader& shader );
+
 private:
 
-  void MemoryCacheInsert( Internal::ShaderData& shaderData );
+  void MemoryCacheInsert( uint64_t sourceHash, Internal::ShaderData& shaderData );
 
   // Undefined
   ShaderFactory( const ShaderFactory& );
@@ -90,7 +132,9 @@ private:
   ShaderFactory& operator=( const ShaderFactory& rhs );
 
 private:
-  Dali::Vector< Internal::ShaderData* > mShaderBinaryCache; ///< Cache of pre-compiled shaders.
+  std::unordered_map< uint64_t, Internal::ShaderDataPtr > mShaderBinaryCache; ///< Cache of pre-compiled shaders by the hash of their sources.
+  ShaderBinaryCache mBinaryArchive;                                           ///< The binaries saved by previous runs
+  std::unordered_multimap< size_t, Shader* > mShaders;                        ///< The shaders waiting for their programs, by the hash of their sources
 
 }; // class ShaderFactory
 
@@ -101,6 +145,14 @@ inline MessageBase* ShaderCompiledMessage( ShaderSaver& factory, Internal::Shade
                                                             shaderData );
 }
 
+inline MessageBase* ProgramReadyMessage( ShaderSaver& factory, size_t shaderHash, bool compiledInBackground )
+{
+  return new MessageValue2< ShaderSaver, size_t, bool >( &factory,
+                                                         &ShaderSaver::ProgramReady,
+                                                         shaderHash,
+                                                         compiledInBackground );
+}
+
 } // namespace Internal
 
 } // namespace Dali
@@ -20,6 +20,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/object/type-registry.h>
+#include <dali/devel-api/rendering/shader-devel.h>
 #include <dali/devel-api/scripting/scripting.h>
 #include <dali/internal/event/common/property-helper.h> // DALI_PROPERTY_TABLE_BEGIN, DALI_PROPERTY, DALI_PROPERTY_TABLE_END
 #include <dali/internal/event/common/thread-local-storage.h>
@@ -44,7 +45,8 @@ DALI_PROPERTY_TABLE_END( DEFAULT_ACTOR_PROPERTY_START_INDEX, ShaderDefaultProper
 Dali::Scripting::StringEnum ShaderHintsTable[] =
   { { "NONE",                     Dali::Shader::Hint::NONE},
     { "OUTPUT_IS_TRANSPARENT",    Dali::Shader::Hint::OUTPUT_IS_TRANSPARENT},
-    { "MODIFIES_GEOMETRY",        Dali::Shader::Hint::MODIFIES_GEOMETRY}
+    { "MODIFIES_GEOMETRY",        Dali::Shader::Hint::MODIFIES_GEOMETRY},
+    { "DRAW_INSTANCED",           static_cast< Dali::Shader::Hint::Value >( DevelShader::Hint::DRAW_INSTANCED ) }
   };
 
 const uint32_t ShaderHintsTableSize = static_cast<uint32_t>( sizeof( ShaderHintsTable ) / sizeof( ShaderHintsTable[0] ) );
@@ -86,6 +88,11 @@ Property::Value HintString(const Dali::Shader::Hint::Value& hints)
     AppendString(s, "MODIFIES_GEOMETRY");
   }
 
+  if(hints & DevelShader::Hint::DRAW_INSTANCED)
+  {
+    AppendString(s, "DRAW_INSTANCED");
+  }
+
   return Property::Value(s);
 }
 
@@ -191,7 +198,9 @@ Property::Value Shader::GetDefaultPropertyCurrentValue( Property::Index index )
 
 Shader::Shader( const SceneGraph::Shader* sceneObject )
 : Object( sceneObject ),
-  mShaderData( nullptr )
+  mShaderData( nullptr ),
+  mProgramReadySignal(),
+  mProgramReady( false )
 {
 }
 
@@ -205,12 +214,39 @@ void Shader::SetShader( const std::string& vertexSource,
   size_t shaderHash;
   mShaderData = shaderFactory.Load( vertexSource, fragmentSource, hints, shaderHash );
 
+  // Be notified when the program is ready to be drawn
+  shaderFactory.AddShader( mShaderData->GetHashValue(), *this );
+
   // Add shader program to scene-object using a message to the UpdateManager
   EventThreadServices& eventThreadServices = GetEventThreadServices();
   SceneGraph::UpdateManager& updateManager = eventThreadServices.GetUpdateManager();
   SetShaderProgramMessage( updateManager, GetShaderSceneObject(), mShaderData, (hints & Dali::Shader::Hint::MODIFIES_GEOMETRY) != 0x0 );
 }
 
+bool Shader::IsProgramReady() const
+{
+  return mProgramReady;
+}
+
+DevelShader::ProgramReadySignalType& Shader::ProgramReadySignal()
+{
+  return mProgramReadySignal;
+}
+
+void Shader::ProgramReady()
+{
+  if( !mProgramReady )
+  {
+    mProgramReady = true;
+
+    if( !mProgramReadySignal.Empty() )
+    {
+      Dali::Shader handle( this );
+      mProgramReadySignal.Emit( handle );
+    }
+  }
+}
+
 Shader::~Shader()
 {
   if( EventThreadServices::IsCoreRunning() )
@@ -219,6 +255,11 @@ Shader::~Shader()
     SceneGraph::UpdateManager& updateManager = eventThreadServices.GetUpdateManager();
     RemoveShaderMessage( updateManager, &GetShaderSceneObject() );
 
+    if( mShaderData && !mProgramReady )
+    {
+      ThreadLocalStorage::Get().GetShaderFactory().RemoveShader( mShaderData->GetHashValue(), *this );
+    }
+
     eventThreadServices.UnregisterObject( this );
   }
 }
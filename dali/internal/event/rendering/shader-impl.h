@@ -22,6 +22,7 @@
 #include <dali/public-api/common/dali-common.h> // DALI_ASSERT_ALWAYS
 #include <dali/public-api/common/intrusive-ptr.h> // Dali::IntrusivePtr
 #include <dali/public-api/rendering/shader.h> // Dali::Shader
+#include <dali/devel-api/rendering/shader-devel.h> // Dali::DevelShader::ProgramReadySignalType
 #include <dali/internal/event/common/object-connector.h> // Dali::Internal::ObjectConnector
 #include <dali/internal/event/common/object-impl.h> // Dali::Internal::Object
 #include <dali/internal/common/shader-data.h> // ShaderPtr
@@ -59,6 +60,21 @@ public:
    */
   const SceneGraph::Shader& GetShaderSceneObject() const;
 
+  /**
+   * @copydoc Dali::DevelShader::IsProgramReady()
+   */
+  bool IsProgramReady() const;
+
+  /**
+   * @copydoc Dali::DevelShader::ProgramReadySignal()
+   */
+  DevelShader::ProgramReadySignalType& ProgramReadySignal();
+
+  /**
+   * Called by the ShaderFactory when the program of the shader is ready to be drawn.
+   */
+  void ProgramReady();
+
 public: // Default property extensions from Object
 
   /**
@@ -105,6 +121,8 @@ private: // unimplemented methods
 private:
 
   Internal::ShaderDataPtr mShaderData;
+  DevelShader::ProgramReadySignalType mProgramReadySignal;
+  bool mProgramReady;
 
 };
 
@@ -18,6 +18,9 @@
 // CLASS HEADER
 #include <dali/internal/render/common/render-algorithms.h>
 
+// EXTERNAL INCLUDES
+#include <cstring>
+
 // INTERNAL INCLUDES
 #include <dali/internal/render/common/render-debug.h>
 #include <dali/internal/render/common/render-list.h>
@@ -446,15 +449,80 @@ inline void RenderAlgorithms::ProcessRenderList( const RenderList& renderList,
         SetupDepthBuffer( item, context, autoDepthTestMode, firstDepthBufferUse );
       }
 
-      // Render the item.
-      item.mRenderer->Render( context, bufferIndex, *item.mNode, item.mModelMatrix, item.mModelViewMatrix,
-                              viewMatrix, projectionMatrix, item.mSize, !item.mIsOpaque, boundTextures );
+      if( item.mRenderer->IsInstanced() && context.IsInstancedDrawSupported() )
+      {
+        // Render the item together with the following items which only differ by their model matrix and color.
+        const uint32_t instanceCount = CollectInstances( renderList, index, context, bufferIndex );
+        item.mRenderer->Render( context, bufferIndex, *item.mNode, item.mModelMatrix, item.mModelViewMatrix,
+                                viewMatrix, projectionMatrix, item.mSize, !item.mIsOpaque, boundTextures,
+                                mInstanceBuffer.Get(), instanceCount, mUniformBuffer );
+        index += instanceCount - 1u;
+      }
+      else
+      {
+        // Render the item. Instanced renderers are drawn one at a time when the context can't draw instances.
+        item.mRenderer->Render( context, bufferIndex, *item.mNode, item.mModelMatrix, item.mModelViewMatrix,
+                                viewMatrix, projectionMatrix, item.mSize, !item.mIsOpaque, boundTextures,
+                                NULL, 0u, mUniformBuffer );
+      }
     }
   }
 }
 
+inline uint32_t RenderAlgorithms::CollectInstances( const RenderList& renderList,
+                                                    uint32_t firstIndex,
+                                                    Context& context,
+                                                    BufferIndex bufferIndex )
+{
+  const RenderItem& firstItem = renderList.GetItem( firstIndex );
+  const SceneGraph::Node& firstNode = *firstItem.mNode;
+  const uint32_t count = static_cast<uint32_t>( renderList.Count() );
+
+  mInstances.Clear();
+  for( uint32_t index = firstIndex; index < count; ++index )
+  {
+    const RenderItem& item = renderList.GetItem( index );
+    if( index != firstIndex )
+    {
+      // The clipping, depth and blending of the first item must apply to the instances as they aren't set up for them.
+      const SceneGraph::Node& node = *item.mNode;
+      if( !item.mRenderer ||
+          item.mIsOpaque != firstItem.mIsOpaque ||
+          item.mSize != firstItem.mSize ||
+          node.GetClippingMode() != ClippingMode::DISABLED ||
+          node.GetClippingId() != firstNode.GetClippingId() ||
+          node.GetClippingDepth() != firstNode.GetClippingDepth() ||
+          node.GetScissorDepth() != firstNode.GetScissorDepth() ||
+          !firstItem.mRenderer->CanDrawInstanceOf( bufferIndex, firstNode, *item.mRenderer, node ) )
+      {
+        break;
+      }
+
+      item.mRenderer->SetDrawnAsInstance();
+    }
+
+    const uint32_t instance = static_cast<uint32_t>( mInstances.Count() );
+    mInstances.Resize( instance + 1u );
+    memcpy( mInstances[ instance ].modelMatrix, item.mModelMatrix.AsFloat(), sizeof( mInstances[ instance ].modelMatrix ) );
+    mInstances[ instance ].color = item.mRenderer->GetRenderColor( bufferIndex, *item.mNode );
+  }
+
+  if( !mInstanceBuffer )
+  {
+    mInstanceBuffer = new GpuBuffer( context );
+  }
+
+  const uint32_t instanceCount = static_cast<uint32_t>( mInstances.Count() );
+  mInstanceBuffer->UpdateDataBuffer( context, static_cast<GLsizeiptr>( instanceCount * sizeof( Renderer::Instance ) ),
+                                     mInstances.Begin(), GpuBuffer::STREAM_DRAW, GpuBuffer::ARRAY_BUFFER );
+  return instanceCount;
+}
+
 RenderAlgorithms::RenderAlgorithms()
   : mViewportRectangle(),
+    mInstances(),
+    mInstanceBuffer(),
+    mUniformBuffer(),
     mHasLayerScissor( false )
 {
 }
@@ -499,6 +567,19 @@ void RenderAlgorithms::ProcessRenderInstruction( const RenderInstruction& instru
   }
 }
 
+void RenderAlgorithms::BeginFrame()
+{
+  mUniformBuffer.NextFrame();
+}
+
+void RenderAlgorithms::GlContextDestroyed()
+{
+  mUniformBuffer.GlContextDestroyed();
+  if( mInstanceBuffer )
+  {
+    mInstanceBuffer->GlContextDestroyed();
+  }
+}
 
 } // namespace Render
 
@@ -21,7 +21,11 @@
 // INTERNAL INCLUDES
 #include <dali/integration-api/core-enumerations.h>
 #include <dali/internal/common/buffer-index.h>
+#include <dali/internal/common/owner-pointer.h>
 #include <dali/internal/render/common/render-list.h>
+#include <dali/internal/render/gl-resources/gpu-buffer.h>
+#include <dali/internal/render/gl-resources/uniform-buffer.h>
+#include <dali/internal/render/renderers/render-renderer.h>
 
 namespace Dali
 {
@@ -67,6 +71,16 @@ class RenderAlgorithms
                                    Integration::StencilBufferAvailable stencilBufferAvailable,
                                    Vector<GLuint>& boundTextures );
 
+    /**
+     * Called at the start of each frame, before its render-instructions are processed.
+     */
+    void BeginFrame();
+
+    /**
+     * Called when the GL context has been destroyed.
+     */
+    void GlContextDestroyed();
+
   private:
 
     /**
@@ -126,6 +140,21 @@ class RenderAlgorithms
                                    Integration::StencilBufferAvailable stencilBufferAvailable,
                                    Vector<GLuint>& boundTextures );
 
+    /**
+     * @brief Collects the instances of an instanced draw call and uploads them to the instance buffer.
+     * The draw call is made of the RenderItem and the consecutive RenderItems which can be drawn as its instances.
+     * This is only used when the context supports instanced draws, see Context::IsInstancedDrawSupported().
+     * @param[in] renderList  The render-list being processed
+     * @param[in] firstIndex  The index of the RenderItem starting the draw call
+     * @param[in] context     The GL context
+     * @param[in] bufferIndex The current render buffer index (previous update buffer)
+     * @return The number of instances, i.e. RenderItems, of the draw call
+     */
+    inline uint32_t CollectInstances( const Dali::Internal::SceneGraph::RenderList& renderList,
+                                      uint32_t firstIndex,
+                                      Context& context,
+                                      BufferIndex bufferIndex );
+
     // Prevent copying:
     RenderAlgorithms( RenderAlgorithms& rhs );
     RenderAlgorithms& operator=( const RenderAlgorithms& rhs );
@@ -137,6 +166,9 @@ class RenderAlgorithms
 
     ScissorStackType                        mScissorStack;        ///< Contains the currently applied scissor hierarchy (so we can undo clips)
     Dali::ClippingBox                       mViewportRectangle;   ///< The viewport dimensions, used to translate AABBs to scissor coordinates
+    Dali::Vector< Renderer::Instance >      mInstances;           ///< The instances of the current instanced draw call
+    OwnerPointer< GpuBuffer >               mInstanceBuffer;      ///< The buffer the instances are uploaded to
+    UniformBuffer                           mUniformBuffer;       ///< The buffer the uniform blocks of the draw calls are uploaded to
     bool                                    mHasLayerScissor:1;   ///< Marks if the currently process render instruction has a layer-based clipping region
 };
 
@@ -216,6 +216,7 @@ void RenderManager::ContextDestroyed()
 {
   mImpl->context.GlContextDestroyed();
   mImpl->programController.GlContextDestroyed();
+  mImpl->renderAlgorithms.GlContextDestroyed();
 
   //Inform textures
   for( auto&& texture : mImpl->textureContainer )
@@ -464,6 +465,12 @@ void RenderManager::Render( Integration::RenderStatus& status, bool forceClear,
   // Process messages queued during previous update
   mImpl->renderQueue.ProcessMessages( mImpl->renderBufferIndex );
 
+  // The renderers of the programs still being compiled in the background are skipped, so keep updating until they are ready
+  if( mImpl->programController.FinishCompilingPrograms() )
+  {
+    status.SetNeedsUpdate( true );
+  }
+
   const uint32_t count = mImpl->instructions.Count( mImpl->renderBufferIndex );
   const bool haveInstructions = count > 0u;
 
@@ -536,6 +543,8 @@ void RenderManager::Render( Integration::RenderStatus& status, bool forceClear,
 
     if ( !uploadOnly )
     {
+      mImpl->renderAlgorithms.BeginFrame();
+
       for( uint32_t i = 0; i < count; ++i )
       {
         RenderInstruction& instruction = mImpl->instructions.At( mImpl->renderBufferIndex, i );
@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <algorithm>
+#include <cstdlib>
 #include <cstring>
 #include <type_traits>
 
@@ -58,6 +59,31 @@ errorStrings errors[] =
    { GL_OUT_OF_MEMORY,      "GL_OUT_OF_MEMORY" }
 };
 
+/**
+ * Query whether the context can draw instances, i.e. it is OpenGL ES 3.0 (or desktop 3.3) or has an instancing extension.
+ * @param[in] glAbstraction The GL abstraction of the current context
+ * @return True if glDrawElementsInstanced, glDrawArraysInstanced and glVertexAttribDivisor can be used
+ */
+bool QueryInstancedDrawSupport( Integration::GlAbstraction& glAbstraction )
+{
+  const char* version = reinterpret_cast< const char* >( glAbstraction.GetString( GL_VERSION ) );
+  if( version )
+  {
+    const char* const ES_PREFIX = "OpenGL ES ";
+    const bool embedded = ( strncmp( version, ES_PREFIX, strlen( ES_PREFIX ) ) == 0 );
+    char* minor = NULL;
+    const long majorVersion = strtol( embedded ? version + strlen( ES_PREFIX ) : version, &minor, 10 );
+    const long minorVersion = ( *minor == '.' ) ? strtol( minor + 1, NULL, 10 ) : 0;
+    if( ( majorVersion > 3 ) || ( majorVersion == 3 && ( embedded || minorVersion >= 3 ) ) )
+    {
+      return true;
+    }
+  }
+
+  const char* extensions = reinterpret_cast< const char* >( glAbstraction.GetString( GL_EXTENSIONS ) );
+  return extensions && ( strstr( extensions, "GL_EXT_instanced_arrays" ) || strstr( extensions, "GL_ANGLE_instanced_arrays" ) );
+}
+
 } // unnamed namespace
 
 #ifdef DEBUG_ENABLED
@@ -88,6 +114,7 @@ Context::Context( Integration::GlAbstraction& glAbstraction, OwnerContainer< Con
   mBoundArrayBufferId(0),
   mBoundElementArrayBufferId(0),
   mBoundTransformFeedbackBufferId(0),
+  mBoundUniformBufferId(0),
   mActiveTextureUnit( TEXTURE_UNIT_LAST ),
   mBlendColor(Color::TRANSPARENT),
   mBlendFuncSeparateSrcRGB(GL_ONE),
@@ -104,6 +131,7 @@ Context::Context( Integration::GlAbstraction& glAbstraction, OwnerContainer< Con
   mStencilOpDepthPass( GL_KEEP ),
   mDepthFunction( GL_LESS ),
   mMaxTextureSize(0),
+  mInstancedDrawSupported(false),
   mClearColor(Color::WHITE),    // initial color, never used until it's been set by the user
   mCullFaceMode( FaceCullingMode::NONE ),
   mViewPort( 0, 0, 0, 0 ),
@@ -227,6 +255,7 @@ void Context::InitializeGlState()
   mBoundArrayBufferId = 0;
   mBoundElementArrayBufferId = 0;
   mBoundTransformFeedbackBufferId = 0;
+  mBoundUniformBufferId = 0;
   mActiveTextureUnit = TEXTURE_UNIT_IMAGE;
 
   mUsingDefaultBlendColor = true; //Default blend color is (0,0,0,0)
@@ -245,6 +274,10 @@ void Context::InitializeGlState()
   // get maximum texture size
   mGlAbstraction.GetIntegerv(GL_MAX_TEXTURE_SIZE, &mMaxTextureSize);
 
+  // find out if instances can be batched into a single draw call
+  mInstancedDrawSupported = QueryInstancedDrawSupport( mGlAbstraction );
+  LOG_GL( "Instanced draw supported: %d\n", mInstancedDrawSupported );
+
   // reset viewport, this will be set to something useful when rendering
   mViewPort.x = mViewPort.y = mViewPort.width = mViewPort.height = 0;
 
@@ -141,6 +141,7 @@ public:
     mBoundArrayBufferId = 0;
     mBoundElementArrayBufferId = 0;
     mBoundTransformFeedbackBufferId = 0;
+    mBoundUniformBufferId = 0;
   }
 
   void ResetTextureCache()
@@ -271,6 +272,33 @@ public:
     }
   }
 
+  /**
+   * Wrapper for OpenGL ES 3.0 glBindBuffer(GL_UNIFORM_BUFFER, ...)
+   */
+  void BindUniformBuffer(GLuint buffer)
+  {
+    // Avoid unecessary calls to BindBuffer
+    if (mBoundUniformBufferId != buffer)
+    {
+      mBoundUniformBufferId = buffer;
+
+      LOG_GL("BindBuffer GL_UNIFORM_BUFFER %d\n", buffer);
+      CHECK_GL( mGlAbstraction, mGlAbstraction.BindBuffer(GL_UNIFORM_BUFFER, buffer) );
+    }
+  }
+
+  /**
+   * Wrapper for OpenGL ES 3.0 glBindBufferRange(GL_UNIFORM_BUFFER, ...)
+   */
+  void BindUniformBufferRange(GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+  {
+    // The range binding also binds the buffer to the generic binding point
+    mBoundUniformBufferId = buffer;
+
+    LOG_GL("BindBufferRange GL_UNIFORM_BUFFER %d %d %d %d\n", index, buffer, offset, size);
+    CHECK_GL( mGlAbstraction, mGlAbstraction.BindBufferRange(GL_UNIFORM_BUFFER, index, buffer, offset, size) );
+  }
+
   /**
    * Wrapper for OpenGL ES 2.0 glBindFramebuffer()
    */
@@ -876,6 +904,11 @@ public:
         result = mBoundTransformFeedbackBufferId;
         break;
       }
+      case GL_UNIFORM_BUFFER:
+      {
+        result = mBoundUniformBufferId;
+        break;
+      }
       default:
       {
         DALI_ASSERT_DEBUG(0 && "target buffer type not supported");
@@ -903,6 +936,15 @@ public:
     CHECK_GL( mGlAbstraction, mGlAbstraction.VertexAttribDivisor( index, divisor ) );
   }
 
+  /**
+   * Wrapper for OpenGL ES 2.0 glVertexAttrib4fv()
+   */
+  void VertexAttrib4fv( GLuint index, const GLfloat* values )
+  {
+    LOG_GL("VertexAttrib4fv(%d, %x)\n", index, values );
+    CHECK_GL( mGlAbstraction, mGlAbstraction.VertexAttrib4fv( index, values ) );
+  }
+
   /**
    * Wrapper for OpenGL ES 2.0 glVertexAttribPointer()
    */
@@ -1719,6 +1761,16 @@ public:
     return mMaxTextureSize;
   }
 
+  /**
+   * Query whether instanced drawing (glDrawElementsInstanced & glVertexAttribDivisor) is available.
+   * This value is cached when the context is created.
+   * @return True if the context is OpenGL ES 3.0 or above, or has an instanced arrays extension
+   */
+  bool IsInstancedDrawSupported() const
+  {
+    return mInstancedDrawSupported;
+  }
+
   /**
    * Get the current viewport.
    * @return Viewport rectangle.
@@ -1786,6 +1838,7 @@ private: // Data
   GLuint mBoundArrayBufferId;        ///< The ID passed to glBindBuffer(GL_ARRAY_BUFFER)
   GLuint mBoundElementArrayBufferId; ///< The ID passed to glBindBuffer(GL_ELEMENT_ARRAY_BUFFER)
   GLuint mBoundTransformFeedbackBufferId; ///< The ID passed to glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER)
+  GLuint mBoundUniformBufferId;      ///< The ID passed to glBindBuffer(GL_UNIFORM_BUFFER)
 
   // glBindTexture() state
   TextureUnit mActiveTextureUnit;
@@ -1815,6 +1868,7 @@ private: // Data
   GLenum mDepthFunction;  ///The depth function
 
   GLint mMaxTextureSize;      ///< return value from GetIntegerv(GL_MAX_TEXTURE_SIZE)
+  bool mInstancedDrawSupported; ///< Whether instances can be drawn with a single call
   Vector4 mClearColor;        ///< clear color
 
   // Face culling mode
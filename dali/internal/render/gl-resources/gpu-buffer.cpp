@@ -113,6 +113,11 @@ void GpuBuffer::UpdateDataBuffer(Context& context, GLsizeiptr size, const GLvoid
     glTargetEnum = GL_TRANSFORM_FEEDBACK_BUFFER;
     context.BindTransformFeedbackBuffer( mBufferId );
   }
+  else if(UNIFORM_BUFFER == target)
+  {
+    glTargetEnum = GL_UNIFORM_BUFFER;
+    context.BindUniformBuffer( mBufferId );
+  }
 
   // if the buffer has already been created, just update the data providing it fits
   if (mBufferCreated )
@@ -150,6 +155,38 @@ void GpuBuffer::UpdateDataBuffer(Context& context, GLsizeiptr size, const GLvoid
   {
     context.BindTransformFeedbackBuffer( 0 );
   }
+  else if(UNIFORM_BUFFER == target)
+  {
+    context.BindUniformBuffer( 0 );
+  }
+}
+
+void GpuBuffer::UpdateDataBufferRange(Context& context, GLintptr offset, GLsizeiptr size, const GLvoid *data, Target target)
+{
+  DALI_ASSERT_DEBUG( mBufferCreated && offset + size <= mCapacity );
+
+  GLenum glTargetEnum = GL_ARRAY_BUFFER;
+  if(ARRAY_BUFFER == target)
+  {
+    context.BindArrayBuffer( mBufferId );
+  }
+  else if(ELEMENT_ARRAY_BUFFER == target)
+  {
+    glTargetEnum = GL_ELEMENT_ARRAY_BUFFER;
+    context.BindElementArrayBuffer( mBufferId );
+  }
+  else if(TRANSFORM_FEEDBACK_BUFFER == target)
+  {
+    glTargetEnum = GL_TRANSFORM_FEEDBACK_BUFFER;
+    context.BindTransformFeedbackBuffer( mBufferId );
+  }
+  else if(UNIFORM_BUFFER == target)
+  {
+    glTargetEnum = GL_UNIFORM_BUFFER;
+    context.BindUniformBuffer( mBufferId );
+  }
+
+  context.BufferSubData( glTargetEnum, offset, size, data );
 }
 
 void GpuBuffer::Bind(Context& context, Target target) const
@@ -168,6 +205,17 @@ void GpuBuffer::Bind(Context& context, Target target) const
   {
     context.BindTransformFeedbackBuffer(mBufferId);
   }
+  else if (target == UNIFORM_BUFFER)
+  {
+    context.BindUniformBuffer(mBufferId);
+  }
+}
+
+void GpuBuffer::BindRange(Context& context, GLuint index, GLintptr offset, GLsizeiptr size) const
+{
+  DALI_ASSERT_DEBUG(offset + size <= mCapacity);
+
+  context.BindUniformBufferRange(index, mBufferId, offset, size);
 }
 
 bool GpuBuffer::BufferIsValid() const
@@ -48,7 +48,8 @@ public:
   {
     ARRAY_BUFFER,             ///< GL_ARRAY_BUFFER
     ELEMENT_ARRAY_BUFFER,     ///< GL_ELEMENT_ARRAY_BUFFER
-    TRANSFORM_FEEDBACK_BUFFER ///< GL_TRANSFORM_FEEDBACK_BUFFER
+    TRANSFORM_FEEDBACK_BUFFER,///< GL_TRANSFORM_FEEDBACK_BUFFER
+    UNIFORM_BUFFER            ///< GL_UNIFORM_BUFFER
   };
 
   /**
@@ -85,6 +86,17 @@ public:
    */
   void UpdateDataBuffer(Context& context, GLsizeiptr size, const GLvoid *data, Usage usage, Target target);
 
+  /**
+   * Updates a range of the data of the buffer object, leaving the rest of the data as it is.
+   * @param context The context to bind the the buffer
+   * @param offset The offset in bytes of the range
+   * @param size The size in bytes of the range
+   * @param data pointer to the data to load
+   * @param target The target buffer to update
+   * @pre The range is within the capacity of the buffer
+   */
+  void UpdateDataBufferRange(Context& context, GLintptr offset, GLsizeiptr size, const GLvoid *data, Target target);
+
   /**
    * Bind the buffer object to the target
    * Will assert if the buffer size is zero
@@ -93,6 +105,15 @@ public:
    */
   void Bind(Context& context, Target target) const;
 
+  /**
+   * Bind a range of the buffer object to an indexed uniform buffer binding point
+   * @param context The context to bind the the buffer
+   * @param index The binding point
+   * @param offset The offset in bytes of the range
+   * @param size The size in bytes of the range
+   */
+  void BindRange(Context& context, GLuint index, GLintptr offset, GLsizeiptr size) const;
+
   /**
    * @return true if the GPU buffer is valid, i.e. its created and not empty
    */
@@ -107,6 +128,15 @@ public:
     return mSize;
   }
 
+  /**
+   * Get the capacity of the buffer
+   * @return capacity
+   */
+  GLsizeiptr GetBufferCapacity() const
+  {
+    return mCapacity;
+  }
+
   /**
    * Needs to be called when GL context is destroyed
    */
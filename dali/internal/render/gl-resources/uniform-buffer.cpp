@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/render/gl-resources/uniform-buffer.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const GLint DEFAULT_OFFSET_ALIGNMENT = 256;      ///< The largest alignment allowed by OpenGL ES 3.0, used if the query fails
+const GLsizeiptr MINIMUM_BUFFER_CAPACITY = 4096; ///< The initial capacity of the buffers in bytes
+
+} // unnamed namespace
+
+UniformBuffer::UniformBuffer()
+: mBuffers(),
+  mBlock(),
+  mCurrentBuffer( 0u ),
+  mOffset( 0 ),
+  mOffsetAlignment( 0 )
+{
+}
+
+UniformBuffer::~UniformBuffer()
+{
+}
+
+void UniformBuffer::NextFrame()
+{
+  mCurrentBuffer = ( mCurrentBuffer + 1u ) % RING_SIZE;
+  mOffset = 0;
+}
+
+uint8_t* UniformBuffer::WriteBlock( GLsizeiptr size )
+{
+  mBlock.Clear();
+  mBlock.Resize( static_cast< Dali::VectorBase::SizeType >( size ), 0u );
+  return mBlock.Begin();
+}
+
+void UniformBuffer::BindBlock( Context& context, GLuint binding )
+{
+  if( mOffsetAlignment == 0 )
+  {
+    GLint alignment = 0;
+    context.GetIntegerv( GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment );
+    mOffsetAlignment = ( alignment > 0 ) ? alignment : DEFAULT_OFFSET_ALIGNMENT;
+  }
+
+  if( !mBuffers[ mCurrentBuffer ] )
+  {
+    mBuffers[ mCurrentBuffer ] = new GpuBuffer( context );
+  }
+  GpuBuffer& buffer = *mBuffers[ mCurrentBuffer ];
+
+  const GLsizeiptr size = static_cast< GLsizeiptr >( mBlock.Count() );
+  const GLintptr offset = ( ( mOffset + mOffsetAlignment - 1 ) / mOffsetAlignment ) * mOffsetAlignment;
+  if( offset + size > buffer.GetBufferCapacity() )
+  {
+    // The new storage doesn't affect the draw calls already made, which keep reading from the old one
+    const GLsizeiptr capacity = std::max( std::max( buffer.GetBufferCapacity() * 2, offset + size ), MINIMUM_BUFFER_CAPACITY );
+    buffer.UpdateDataBuffer( context, capacity, NULL, GpuBuffer::DYNAMIC_DRAW, GpuBuffer::UNIFORM_BUFFER );
+  }
+
+  buffer.UpdateDataBufferRange( context, offset, size, mBlock.Begin(), GpuBuffer::UNIFORM_BUFFER );
+  buffer.BindRange( context, binding, offset, size );
+  mOffset = offset + size;
+}
+
+void UniformBuffer::GlContextDestroyed()
+{
+  for( uint32_t i = 0u; i < RING_SIZE; ++i )
+  {
+    if( mBuffers[i] )
+    {
+      mBuffers[i]->GlContextDestroyed();
+    }
+  }
+  mOffset = 0;
+  mOffsetAlignment = 0;
+}
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,102 @@
+#ifndef DALI_INTERNAL_UNIFORM_BUFFER_H
+#define DALI_INTERNAL_UNIFORM_BUFFER_H
+
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/internal/common/owner-pointer.h>
+#include <dali/internal/render/gl-resources/gpu-buffer.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * Streams the uniform blocks of the draw calls to a ring of uniform buffers.
+ *
+ * Each block is written to CPU memory first, then uploaded after the previous blocks of
+ * the frame, and its range of the buffer is bound for the draw call.
+ * Each frame writes to the next buffer of the ring, so the blocks aren't written
+ * over while the GPU may still be reading those of the previous frames.
+ */
+class UniformBuffer
+{
+public:
+
+  /**
+   * Constructor
+   */
+  UniformBuffer();
+
+  /**
+   * Non-virtual destructor
+   */
+  ~UniformBuffer();
+
+  /**
+   * Moves on to the next buffer of the ring, whose blocks are written from its start.
+   * Called at the start of each frame.
+   */
+  void NextFrame();
+
+  /**
+   * Gets the memory the next block is written to before it is uploaded
+   * @param[in] size The size of the block in bytes
+   * @return The memory of the block, cleared to zero
+   */
+  uint8_t* WriteBlock( GLsizeiptr size );
+
+  /**
+   * Uploads the block written last and binds its range of the buffer to a binding point
+   * @param[in] context The GL context
+   * @param[in] binding The uniform buffer binding point of the block
+   */
+  void BindBlock( Context& context, GLuint binding );
+
+  /**
+   * Called when the GL context has been destroyed.
+   */
+  void GlContextDestroyed();
+
+private:
+
+  // Undefined
+  UniformBuffer( const UniformBuffer& );
+
+  // Undefined
+  UniformBuffer& operator=( const UniformBuffer& );
+
+private:
+
+  static const uint32_t RING_SIZE = 3u; ///< The number of buffers, one per frame being rendered
+
+  OwnerPointer< GpuBuffer > mBuffers[ RING_SIZE ]; ///< The buffers of the ring
+  Dali::Vector< uint8_t > mBlock;                  ///< The block being written
+  uint32_t mCurrentBuffer;                         ///< The buffer of the current frame
+  GLintptr mOffset;                                ///< The end of the blocks written to the current buffer
+  GLint mOffsetAlignment;                          ///< The alignment of the blocks in the buffer, zero until queried
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_UNIFORM_BUFFER_H
@@ -152,7 +152,8 @@ void Geometry::Draw(
     BufferIndex bufferIndex,
     Vector<GLint>& attributeLocation,
     uint32_t elementBufferOffset,
-    uint32_t elementBufferCount )
+    uint32_t elementBufferCount,
+    uint32_t instanceCount )
 {
   //Bind buffers to attribute locations
   uint32_t base = 0u;
@@ -228,7 +229,14 @@ void Geometry::Draw(
     //Indexed draw call
     mIndexBuffer->Bind( context, GpuBuffer::ELEMENT_ARRAY_BUFFER );
     // numIndices truncated, no value loss happening in practice
-    context.DrawElements( geometryGLType, static_cast<GLsizei>( numIndices ), GL_UNSIGNED_SHORT, reinterpret_cast<void*>( firstIndexOffset ) );
+    if( instanceCount > 0u )
+    {
+      context.DrawElementsInstanced( geometryGLType, static_cast<GLsizei>( numIndices ), GL_UNSIGNED_SHORT, reinterpret_cast<void*>( firstIndexOffset ), static_cast<GLsizei>( instanceCount ) );
+    }
+    else
+    {
+      context.DrawElements( geometryGLType, static_cast<GLsizei>( numIndices ), GL_UNSIGNED_SHORT, reinterpret_cast<void*>( firstIndexOffset ) );
+    }
   }
   else
   {
@@ -240,7 +248,14 @@ void Geometry::Draw(
       numVertices = static_cast<GLsizei>( mVertexBuffers[0]->GetElementCount() );
     }
 
-    context.DrawArrays( geometryGLType, 0, numVertices );
+    if( instanceCount > 0u )
+    {
+      context.DrawArraysInstanced( geometryGLType, 0, numVertices, static_cast<GLsizei>( instanceCount ) );
+    }
+    else
+    {
+      context.DrawArrays( geometryGLType, 0, numVertices );
+    }
   }
 
   //Disable attributes
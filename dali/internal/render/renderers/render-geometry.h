@@ -128,12 +128,14 @@ public:
    * @param[in] attributeLocation The location for the attributes in the shader
    * @param[in] elementBufferOffset The index of first element to draw if index buffer bound
    * @param[in] elementBufferCount Number of elements to draw if index buffer bound, uses whole buffer when 0
+   * @param[in] instanceCount Number of instances to draw with an instanced draw call, or 0 for a non-instanced draw call
    */
   void Draw(Context& context,
             BufferIndex bufferIndex,
             Vector<GLint>& attributeLocation,
             uint32_t elementBufferOffset,
-            uint32_t elementBufferCount );
+            uint32_t elementBufferCount,
+            uint32_t instanceCount );
 
 private:
 
@@ -18,9 +18,17 @@
 // CLASS HEADER
 #include <dali/internal/render/renderers/render-renderer.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
 // INTERNAL INCLUDES
+#include <dali/devel-api/rendering/shader-devel.h>
 #include <dali/internal/common/image-sampler.h>
 #include <dali/internal/render/gl-resources/context.h>
+#include <dali/internal/render/gl-resources/gpu-buffer.h>
+#include <dali/internal/render/gl-resources/uniform-buffer.h>
 #include <dali/internal/render/renderers/render-sampler.h>
 #include <dali/internal/render/shaders/scene-graph-shader.h>
 #include <dali/internal/render/shaders/program.h>
@@ -35,6 +43,170 @@ namespace Internal
 namespace
 {
 
+/**
+ * The number of vec4 attribute locations taken by a mat4 attribute
+ */
+const GLint MATRIX_ATTRIBUTE_COLUMNS = 4;
+
+/**
+ * The maximum number of nodes whose uniform index maps are kept by a renderer
+ */
+const uint32_t MAXIMUM_NODE_UNIFORM_INDEX_MAPS = 32u;
+
+/**
+ * Checks whether two uniform maps map the uniforms to the same properties
+ * @param[in] lhs The first uniform map
+ * @param[in] rhs The second uniform map
+ * @return True if the uniform maps have the same properties
+ */
+inline bool HasSameProperties( const SceneGraph::CollectedUniformMap& lhs, const SceneGraph::CollectedUniformMap& rhs )
+{
+  if( lhs.Count() != rhs.Count() )
+  {
+    return false;
+  }
+
+  for( SceneGraph::CollectedUniformMap::SizeType i = 0; i < lhs.Count(); ++i )
+  {
+    if( lhs[i]->propertyPtr != rhs[i]->propertyPtr || lhs[i]->uniformName != rhs[i]->uniformName )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Writes a value to a uniform of a uniform block
+ * @param[in] block The memory of the uniform block
+ * @param[in] member The uniform
+ * @param[in] values The components of the value, matrices in column major order
+ * @param[in] count The number of components
+ */
+void WriteUniformBlockMember( uint8_t* block, const Program::UniformBlockMember& member, const float* values, uint32_t count )
+{
+  uint8_t* destination = block + member.offset;
+  uint32_t components = 0u;
+  switch( member.type )
+  {
+    case GL_FLOAT_MAT3:
+    case GL_FLOAT_MAT4:
+    {
+      // The columns of the matrix are padded to the matrix stride
+      const uint32_t columns = ( member.type == GL_FLOAT_MAT4 ) ? 4u : 3u;
+      if( count == columns * columns )
+      {
+        for( uint32_t column = 0u; column < columns; ++column )
+        {
+          memcpy( destination + column * member.matrixStride, values + column * columns, columns * sizeof( float ) );
+        }
+      }
+      break;
+    }
+    case GL_INT:
+    case GL_BOOL:
+    {
+      const int32_t value = static_cast< int32_t >( values[0] );
+      memcpy( destination, &value, sizeof( value ) );
+      break;
+    }
+    case GL_FLOAT:
+    {
+      components = 1u;
+      break;
+    }
+    case GL_FLOAT_VEC2:
+    {
+      components = 2u;
+      break;
+    }
+    case GL_FLOAT_VEC3:
+    {
+      components = 3u;
+      break;
+    }
+    case GL_FLOAT_VEC4:
+    {
+      components = 4u;
+      break;
+    }
+    default:
+    {
+      // Other uniform types are ignored
+      break;
+    }
+  }
+
+  memcpy( destination, values, std::min( components, count ) * sizeof( float ) );
+}
+
+/**
+ * Writes the value of a property to a uniform of a uniform block
+ * @param[in] block The memory of the uniform block
+ * @param[in] member The uniform
+ * @param[in] property The property
+ * @param[in] bufferIndex The index of the previous update buffer.
+ */
+void WriteUniformBlockProperty( uint8_t* block, const Program::UniformBlockMember& member, const PropertyInputImpl& property, BufferIndex bufferIndex )
+{
+  switch( property.GetType() )
+  {
+    case Property::INTEGER:
+    {
+      const int32_t value = property.GetInteger( bufferIndex );
+      if( member.type == GL_INT || member.type == GL_BOOL )
+      {
+        memcpy( block + member.offset, &value, sizeof( value ) );
+      }
+      else
+      {
+        const float floatValue = static_cast< float >( value );
+        WriteUniformBlockMember( block, member, &floatValue, 1u );
+      }
+      break;
+    }
+    case Property::FLOAT:
+    {
+      WriteUniformBlockMember( block, member, &property.GetFloat( bufferIndex ), 1u );
+      break;
+    }
+    case Property::VECTOR2:
+    {
+      WriteUniformBlockMember( block, member, property.GetVector2( bufferIndex ).AsFloat(), 2u );
+      break;
+    }
+    case Property::VECTOR3:
+    {
+      WriteUniformBlockMember( block, member, property.GetVector3( bufferIndex ).AsFloat(), 3u );
+      break;
+    }
+    case Property::VECTOR4:
+    {
+      WriteUniformBlockMember( block, member, property.GetVector4( bufferIndex ).AsFloat(), 4u );
+      break;
+    }
+    case Property::ROTATION:
+    {
+      WriteUniformBlockMember( block, member, property.GetQuaternion( bufferIndex ).mVector.AsFloat(), 4u );
+      break;
+    }
+    case Property::MATRIX:
+    {
+      WriteUniformBlockMember( block, member, property.GetMatrix( bufferIndex ).AsFloat(), 16u );
+      break;
+    }
+    case Property::MATRIX3:
+    {
+      WriteUniformBlockMember( block, member, property.GetMatrix3( bufferIndex ).AsFloat(), 9u );
+      break;
+    }
+    default:
+    {
+      // Other property types are ignored
+      break;
+    }
+  }
+}
 
 /**
  * Helper to set view and projection matrices once per program
@@ -134,7 +306,10 @@ Renderer::Renderer( SceneGraph::RenderDataProvider* dataProvider,
 : mRenderDataProvider( dataProvider ),
   mContext( NULL),
   mGeometry( geometry ),
-  mUniformIndexMap(),
+  mNodeUniformIndexMaps(),
+  mPreviousUniformIndexMap(),
+  mUniformMapIndices(),
+  mUniformIndexMapUseCount( 0u ),
   mAttributesLocation(),
   mStencilParameters( stencilParameters ),
   mBlendingOptions(),
@@ -208,67 +383,177 @@ void Renderer::GlCleanup()
 {
 }
 
-void Renderer::SetUniforms( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, const Vector3& size, Program& program )
+Renderer::NodeUniformIndexMap& Renderer::GetUniformIndexMap( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, Program& program )
 {
   // Check if the map has changed
   DALI_ASSERT_DEBUG( mRenderDataProvider && "No Uniform map data provider available" );
 
   const SceneGraph::UniformMapDataProvider& uniformMapDataProvider = mRenderDataProvider->GetUniformMap();
+  const SceneGraph::CollectedUniformMap& uniformMap = uniformMapDataProvider.GetUniformMap( bufferIndex );
+  const SceneGraph::CollectedUniformMap& uniformMapNode = node.GetUniformMap( bufferIndex );
 
-  if( uniformMapDataProvider.GetUniformMapChanged( bufferIndex ) ||
-      node.GetUniformMapChanged(bufferIndex) ||
-      mUniformIndexMap.Count() == 0 ||
-      mShaderChanged )
+  if( mShaderChanged )
   {
-    // Reset shader pointer
+    // The uniforms are registered to the new program
+    mNodeUniformIndexMaps.Clear();
     mShaderChanged = false;
+  }
+  else if( uniformMapDataProvider.GetUniformMapChanged( bufferIndex ) )
+  {
+    // The maps of all the nodes are merged again when they are next used, keeping the versions of the unchanged uniforms
+    for( auto&& iter : mNodeUniformIndexMaps )
+    {
+      iter->sources.Clear();
+    }
+  }
 
-    const SceneGraph::CollectedUniformMap& uniformMap = uniformMapDataProvider.GetUniformMap( bufferIndex );
-    const SceneGraph::CollectedUniformMap& uniformMapNode = node.GetUniformMap( bufferIndex );
+  NodeUniformIndexMap* nodeMap = NULL;
+  NodeUniformIndexMap* leastRecentlyUsed = NULL;
+  for( auto&& iter : mNodeUniformIndexMaps )
+  {
+    if( iter->node == &node && iter->program == &program )
+    {
+      nodeMap = iter;
+      break;
+    }
+    if( !leastRecentlyUsed || iter->lastUsed < leastRecentlyUsed->lastUsed )
+    {
+      leastRecentlyUsed = iter;
+    }
+  }
 
-    uint32_t maxMaps = static_cast<uint32_t>( uniformMap.Count() + uniformMapNode.Count() ); // 4,294,967,295 maps should be enough
-    mUniformIndexMap.Clear(); // Clear contents, but keep memory if we don't change size
-    mUniformIndexMap.Resize( maxMaps );
+  bool rebuild = false;
+  bool keepVersions = false;
+  if( nodeMap )
+  {
+    // The node may have been destroyed and another one created at its address, so the map is also checked
+    // against the properties it was merged from
+    rebuild = node.GetUniformMapChanged( bufferIndex ) || nodeMap->sources.Empty();
+    if( !rebuild )
+    {
+      const uint32_t rendererCount = static_cast<uint32_t>( uniformMap.Count() );
+      rebuild = ( nodeMap->sources.Count() != uniformMap.Count() + uniformMapNode.Count() );
+      for( uint32_t i = 0u; !rebuild && i < nodeMap->sources.Count(); ++i )
+      {
+        const PropertyInputImpl* source = ( i < rendererCount ) ? uniformMap[i]->propertyPtr : uniformMapNode[i - rendererCount]->propertyPtr;
+        rebuild = ( nodeMap->sources[i] != source );
+      }
+    }
+    keepVersions = true;
+  }
+  else
+  {
+    if( mNodeUniformIndexMaps.Count() < MAXIMUM_NODE_UNIFORM_INDEX_MAPS )
+    {
+      nodeMap = new NodeUniformIndexMap();
+      mNodeUniformIndexMaps.PushBack( nodeMap );
+    }
+    else
+    {
+      nodeMap = leastRecentlyUsed;
+    }
+    nodeMap->node = &node;
+    nodeMap->program = &program;
+    rebuild = true;
+  }
+
+  if( rebuild )
+  {
+    BuildUniformIndexMap( uniformMap, uniformMapNode, program, keepVersions, *nodeMap );
+  }
+
+  nodeMap->lastUsed = ++mUniformIndexMapUseCount;
+  return *nodeMap;
+}
+
+void Renderer::BuildUniformIndexMap( const SceneGraph::CollectedUniformMap& uniformMap,
+                                     const SceneGraph::CollectedUniformMap& uniformMapNode,
+                                     Program& program,
+                                     bool keepVersions,
+                                     NodeUniformIndexMap& nodeMap )
+{
+  // The versions of the values set in the program are only kept if the map is rebuilt for the same node and program
+  UniformIndexMappings& uniformIndexMap = nodeMap.uniformIndexMap;
+  mPreviousUniformIndexMap.Swap( uniformIndexMap );
+  nodeMap.uniformBlockProperties.Clear();
+
+  uint32_t maxMaps = static_cast<uint32_t>( uniformMap.Count() + uniformMapNode.Count() ); // 4,294,967,295 maps should be enough
+  uniformIndexMap.Clear(); // Clear contents, but keep memory if we don't change size
+  uniformIndexMap.Resize( maxMaps );
+
+  nodeMap.sources.Clear();
+  nodeMap.sources.Reserve( maxMaps );
 
-    uint32_t mapIndex = 0;
-    for(; mapIndex < uniformMap.Count() ; ++mapIndex )
+  uint32_t mapIndex = 0;
+  uint32_t uniformCount = 0;
+  for(; mapIndex < uniformMap.Count() ; ++mapIndex )
+  {
+    uniformIndexMap[mapIndex].propertyValue = uniformMap[mapIndex]->propertyPtr;
+    uniformIndexMap[mapIndex].uniformIndex = program.RegisterUniform( uniformMap[mapIndex]->uniformName, uniformMap[mapIndex]->uniformNameHash );
+    uniformCount = std::max( uniformCount, uniformIndexMap[mapIndex].uniformIndex + 1u );
+    nodeMap.sources.PushBack( uniformMap[mapIndex]->propertyPtr );
+  }
+
+  if( uniformMapNode.Count() > 0u )
+  {
+    // The node uniforms replace the renderer uniforms with the same name, which are found by their index in the program
+    mUniformMapIndices.Clear();
+    mUniformMapIndices.Resize( uniformCount, maxMaps );
+    for( uint32_t i = mapIndex; i > 0u; --i )
     {
-      mUniformIndexMap[mapIndex].propertyValue = uniformMap[mapIndex]->propertyPtr;
-      mUniformIndexMap[mapIndex].uniformIndex = program.RegisterUniform( uniformMap[mapIndex]->uniformName );
+      mUniformMapIndices[ uniformIndexMap[i - 1u].uniformIndex ] = i - 1u;
     }
 
     for( uint32_t nodeMapIndex = 0; nodeMapIndex < uniformMapNode.Count() ; ++nodeMapIndex )
     {
-      uint32_t uniformIndex = program.RegisterUniform( uniformMapNode[nodeMapIndex]->uniformName );
-      bool found(false);
-      for( uint32_t i = 0; i<uniformMap.Count(); ++i )
+      uint32_t uniformIndex = program.RegisterUniform( uniformMapNode[nodeMapIndex]->uniformName, uniformMapNode[nodeMapIndex]->uniformNameHash );
+      if( uniformIndex < uniformCount && mUniformMapIndices[ uniformIndex ] < maxMaps )
       {
-        if( mUniformIndexMap[i].uniformIndex == uniformIndex )
-        {
-          mUniformIndexMap[i].propertyValue = uniformMapNode[nodeMapIndex]->propertyPtr;
-          found = true;
-          break;
-        }
+        uniformIndexMap[ mUniformMapIndices[ uniformIndex ] ].propertyValue = uniformMapNode[nodeMapIndex]->propertyPtr;
       }
-
-      if( !found )
+      else
       {
-        mUniformIndexMap[mapIndex].propertyValue = uniformMapNode[nodeMapIndex]->propertyPtr;
-        mUniformIndexMap[mapIndex].uniformIndex = uniformIndex;
+        uniformIndexMap[mapIndex].propertyValue = uniformMapNode[nodeMapIndex]->propertyPtr;
+        uniformIndexMap[mapIndex].uniformIndex = uniformIndex;
         ++mapIndex;
       }
+      nodeMap.sources.PushBack( uniformMapNode[nodeMapIndex]->propertyPtr );
     }
+  }
 
-    mUniformIndexMap.Resize( mapIndex );
+  uniformIndexMap.Resize( mapIndex );
+
+  for( uint32_t i = 0u; i < mapIndex; ++i )
+  {
+    UniformIndexMap& map = uniformIndexMap[i];
+    map.propertyVersion = 0u;
+    if( keepVersions && i < mPreviousUniformIndexMap.Count() &&
+        mPreviousUniformIndexMap[i].propertyValue == map.propertyValue &&
+        mPreviousUniformIndexMap[i].uniformIndex == map.uniformIndex )
+    {
+      map.propertyVersion = mPreviousUniformIndexMap[i].propertyVersion;
+    }
   }
+}
 
-  // Set uniforms in local map
-  for( UniformIndexMappings::Iterator iter = mUniformIndexMap.Begin(),
-         end = mUniformIndexMap.End() ;
+void Renderer::SetUniforms( BufferIndex bufferIndex, NodeUniformIndexMap& nodeMap, const Vector3& size, Program& program )
+{
+  // The values sent for this node are still set in the program, unless another node or renderer has set its own since
+  const bool uniformsSet = ( program.GetUniformMapOwner() == &nodeMap );
+  program.SetUniformMapOwner( &nodeMap );
+
+  // Set uniforms in local map, skipping the properties whose values haven't changed since they were set
+  for( UniformIndexMappings::Iterator iter = nodeMap.uniformIndexMap.Begin(),
+         end = nodeMap.uniformIndexMap.End() ;
        iter != end ;
        ++iter )
   {
-    SetUniformFromProperty( bufferIndex, program, *iter );
+    const uint32_t propertyVersion = iter->propertyValue->GetVersion( bufferIndex );
+    if( !uniformsSet || propertyVersion == 0u || propertyVersion != iter->propertyVersion )
+    {
+      SetUniformFromProperty( bufferIndex, program, *iter );
+      iter->propertyVersion = propertyVersion;
+    }
   }
 
   GLint sizeLoc = program.GetUniformLocation( Program::UNIFORM_SIZE );
@@ -347,6 +632,116 @@ void Renderer::SetUniformFromProperty( BufferIndex bufferIndex, Program& program
   }
 }
 
+void Renderer::WriteUniformBlocks( Context& context,
+                                   BufferIndex bufferIndex,
+                                   const SceneGraph::NodeDataProvider& node,
+                                   NodeUniformIndexMap& nodeMap,
+                                   const Matrix& modelMatrix,
+                                   const Matrix& modelViewMatrix,
+                                   const Matrix& viewMatrix,
+                                   const Matrix& projectionMatrix,
+                                   const Vector3& size,
+                                   Program& program,
+                                   UniformBuffer& uniformBuffer )
+{
+  const std::vector< Program::UniformBlock >& blocks = program.GetUniformBlocks();
+
+  Dali::Vector< const PropertyInputImpl* >& uniformBlockProperties = nodeMap.uniformBlockProperties;
+  if( uniformBlockProperties.Count() != program.GetUniformBlockMemberCount() )
+  {
+    // Find the mapped property of each uniform in the blocks, the last mapping of a uniform is the one set
+    uniformBlockProperties.Clear();
+    for( auto&& block : blocks )
+    {
+      for( auto&& member : block.members )
+      {
+        const PropertyInputImpl* property = NULL;
+        for( auto&& map : nodeMap.uniformIndexMap )
+        {
+          if( map.uniformIndex == member.uniformIndex )
+          {
+            property = map.propertyValue;
+          }
+        }
+        uniformBlockProperties.PushBack( property );
+      }
+    }
+  }
+
+  uint32_t propertyIndex = 0u;
+  for( auto&& block : blocks )
+  {
+    uint8_t* data = uniformBuffer.WriteBlock( block.size );
+    for( auto&& member : block.members )
+    {
+      const PropertyInputImpl* property = uniformBlockProperties[ propertyIndex++ ];
+      if( property )
+      {
+        WriteUniformBlockProperty( data, member, *property, bufferIndex );
+        continue;
+      }
+
+      switch( member.uniformIndex )
+      {
+        case Program::UNIFORM_MVP_MATRIX:
+        {
+          Matrix modelViewProjectionMatrix( false );
+          Matrix::Multiply( modelViewProjectionMatrix, modelViewMatrix, projectionMatrix );
+          WriteUniformBlockMember( data, member, modelViewProjectionMatrix.AsFloat(), 16u );
+          break;
+        }
+        case Program::UNIFORM_MODELVIEW_MATRIX:
+        {
+          WriteUniformBlockMember( data, member, modelViewMatrix.AsFloat(), 16u );
+          break;
+        }
+        case Program::UNIFORM_PROJECTION_MATRIX:
+        {
+          WriteUniformBlockMember( data, member, projectionMatrix.AsFloat(), 16u );
+          break;
+        }
+        case Program::UNIFORM_MODEL_MATRIX:
+        {
+          WriteUniformBlockMember( data, member, modelMatrix.AsFloat(), 16u );
+          break;
+        }
+        case Program::UNIFORM_VIEW_MATRIX:
+        {
+          WriteUniformBlockMember( data, member, viewMatrix.AsFloat(), 16u );
+          break;
+        }
+        case Program::UNIFORM_NORMAL_MATRIX:
+        {
+          Matrix3 normalMatrix;
+          normalMatrix = modelViewMatrix;
+          normalMatrix.Invert();
+          normalMatrix.Transpose();
+          WriteUniformBlockMember( data, member, normalMatrix.AsFloat(), 9u );
+          break;
+        }
+        case Program::UNIFORM_COLOR:
+        {
+          const Vector4 color = GetRenderColor( bufferIndex, node );
+          WriteUniformBlockMember( data, member, color.AsFloat(), 4u );
+          break;
+        }
+        case Program::UNIFORM_SIZE:
+        {
+          WriteUniformBlockMember( data, member, size.AsFloat(), 3u );
+          break;
+        }
+        default:
+        {
+          // Unmapped uniforms are left as zero
+          break;
+        }
+      }
+    }
+
+    uniformBuffer.BindBlock( context, block.binding );
+  }
+}
+
 bool Renderer::BindTextures( Context& context, Program& program, Vector<GLuint>& boundTextures )
 {
   uint32_t textureUnit = 0;
@@ -526,7 +921,10 @@ void Renderer::Render( Context& context,
                        const Matrix& projectionMatrix,
                        const Vector3& size,
                        bool blend,
-                       Vector<GLuint>& boundTextures )
+                       Vector<GLuint>& boundTextures,
+                       const GpuBuffer* instanceBuffer,
+                       uint32_t instanceCount,
+                       UniformBuffer& uniformBuffer )
 {
   // Get the program to use:
   Program* program = mRenderDataProvider->GetShader().GetProgram();
@@ -536,6 +934,12 @@ void Renderer::Render( Context& context,
     return;
   }
 
+  if( !program->IsReady() )
+  {
+    // The driver is still compiling the program in the background, so the renderer is drawn once it has completed
+    return;
+  }
+
   //Set cull face  mode
   context.CullFace( mFaceCullingMode );
 
@@ -556,19 +960,17 @@ void Renderer::Render( Context& context,
     GLint loc = program->GetUniformLocation( Program::UNIFORM_COLOR );
     if( Program::UNIFORM_UNKNOWN != loc )
     {
-      const Vector4& color = node.GetRenderColor( bufferIndex );
-      if( mPremultipledAlphaEnabled )
-      {
-        float alpha = color.a * mRenderDataProvider->GetOpacity( bufferIndex );
-        program->SetUniform4f( loc, color.r * alpha, color.g * alpha, color.b * alpha, alpha );
-      }
-      else
-      {
-        program->SetUniform4f( loc, color.r, color.g, color.b, color.a * mRenderDataProvider->GetOpacity( bufferIndex ) );
-      }
+      const Vector4 color = GetRenderColor( bufferIndex, node );
+      program->SetUniform4f( loc, color.r, color.g, color.b, color.a );
     }
 
-    SetUniforms( bufferIndex, node, size, *program );
+    NodeUniformIndexMap& nodeMap = GetUniformIndexMap( bufferIndex, node, *program );
+    SetUniforms( bufferIndex, nodeMap, size, *program );
+
+    if( !program->GetUniformBlocks().empty() )
+    {
+      WriteUniformBlocks( context, bufferIndex, node, nodeMap, modelMatrix, modelViewMatrix, viewMatrix, projectionMatrix, size, *program, uniformBuffer );
+    }
 
     if( mUpdateAttributesLocation || mGeometry->AttributesChanged() )
     {
@@ -576,11 +978,156 @@ void Renderer::Render( Context& context,
       mUpdateAttributesLocation = false;
     }
 
+    if( instanceBuffer )
+    {
+      EnableInstanceAttributes( context, *program, *instanceBuffer );
+    }
+    else if( IsInstanced() )
+    {
+      // Instanced draws aren't supported by the context, so the item is drawn on its own
+      SetInstanceAttributeValues( context, *program, modelMatrix, GetRenderColor( bufferIndex, node ) );
+    }
+
     mGeometry->Draw( context,
                      bufferIndex,
                      mAttributesLocation,
                      mIndexedDrawFirstElement,
-                     mIndexedDrawElementsCount );
+                     mIndexedDrawElementsCount,
+                     instanceBuffer ? instanceCount : 0u );
+
+    if( instanceBuffer )
+    {
+      DisableInstanceAttributes( context, *program );
+    }
+  }
+}
+
+bool Renderer::IsInstanced() const
+{
+  return mRenderDataProvider->GetShader().HintEnabled( static_cast< Dali::Shader::Hint::Value >( DevelShader::Hint::DRAW_INSTANCED ) );
+}
+
+bool Renderer::CanDrawInstanceOf( BufferIndex bufferIndex,
+                                  const SceneGraph::NodeDataProvider& node,
+                                  const Renderer& renderer,
+                                  const SceneGraph::NodeDataProvider& rendererNode ) const
+{
+  SceneGraph::RenderDataProvider& dataProvider = *mRenderDataProvider;
+  SceneGraph::RenderDataProvider& otherDataProvider = *renderer.mRenderDataProvider;
+  const SceneGraph::UniformMapDataProvider& uniformMapDataProvider = otherDataProvider.GetUniformMap();
+  const StencilParameters& stencil = renderer.mStencilParameters;
+  const Vector4* blendColor = mBlendingOptions.GetBlendColor();
+  const Vector4* otherBlendColor = renderer.mBlendingOptions.GetBlendColor();
+
+  return ( &dataProvider.GetShader() == &otherDataProvider.GetShader() ) &&
+         ( mGeometry == renderer.mGeometry ) &&
+         ( dataProvider.GetTextures() == otherDataProvider.GetTextures() ) &&
+         ( dataProvider.GetSamplers() == otherDataProvider.GetSamplers() ) &&
+         ( mIndexedDrawFirstElement == renderer.mIndexedDrawFirstElement ) &&
+         ( mIndexedDrawElementsCount == renderer.mIndexedDrawElementsCount ) &&
+         ( mFaceCullingMode == renderer.mFaceCullingMode ) &&
+         ( mDepthFunction == renderer.mDepthFunction ) &&
+         ( mDepthWriteMode == renderer.mDepthWriteMode ) &&
+         ( mDepthTestMode == renderer.mDepthTestMode ) &&
+         ( mPremultipledAlphaEnabled == renderer.mPremultipledAlphaEnabled ) &&
+         ( mBlendingOptions.GetBitmask() == renderer.mBlendingOptions.GetBitmask() ) &&
+         ( blendColor == otherBlendColor || ( blendColor && otherBlendColor && *blendColor == *otherBlendColor ) ) &&
+         ( mStencilParameters.renderMode == stencil.renderMode ) &&
+         ( mStencilParameters.stencilFunction == stencil.stencilFunction ) &&
+         ( mStencilParameters.stencilFunctionMask == stencil.stencilFunctionMask ) &&
+         ( mStencilParameters.stencilFunctionReference == stencil.stencilFunctionReference ) &&
+         ( mStencilParameters.stencilMask == stencil.stencilMask ) &&
+         ( mStencilParameters.stencilOperationOnFail == stencil.stencilOperationOnFail ) &&
+         ( mStencilParameters.stencilOperationOnZFail == stencil.stencilOperationOnZFail ) &&
+         ( mStencilParameters.stencilOperationOnZPass == stencil.stencilOperationOnZPass ) &&
+         HasSameProperties( dataProvider.GetUniformMap().GetUniformMap( bufferIndex ), uniformMapDataProvider.GetUniformMap( bufferIndex ) ) &&
+         HasSameProperties( node.GetUniformMap( bufferIndex ), rendererNode.GetUniformMap( bufferIndex ) );
+}
+
+void Renderer::SetDrawnAsInstance()
+{
+  // The uniform and attribute caches aren't updated while the renderer is drawn as an instance
+  mShaderChanged = true;
+  mUpdateAttributesLocation = true;
+}
+
+Vector4 Renderer::GetRenderColor( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node ) const
+{
+  const Vector4& color = node.GetRenderColor( bufferIndex );
+  if( mPremultipledAlphaEnabled )
+  {
+    float alpha = color.a * mRenderDataProvider->GetOpacity( bufferIndex );
+    return Vector4( color.r * alpha, color.g * alpha, color.b * alpha, alpha );
+  }
+
+  return Vector4( color.r, color.g, color.b, color.a * mRenderDataProvider->GetOpacity( bufferIndex ) );
+}
+
+void Renderer::EnableInstanceAttributes( Context& context, Program& program, const GpuBuffer& instanceBuffer )
+{
+  instanceBuffer.Bind( context, GpuBuffer::ARRAY_BUFFER );
+
+  const GLsizei stride = static_cast< GLsizei >( sizeof( Instance ) );
+  const GLint matrixLocation = program.GetAttribLocation( Program::ATTRIB_INSTANCE_MODEL_MATRIX );
+  if( Program::ATTRIB_UNKNOWN != matrixLocation )
+  {
+    for( GLint column = 0; column < MATRIX_ATTRIBUTE_COLUMNS; ++column )
+    {
+      const GLuint location = static_cast< GLuint >( matrixLocation + column );
+      context.EnableVertexAttributeArray( location );
+      context.VertexAttribPointer( location, 4, GL_FLOAT, GL_FALSE, stride,
+                                   reinterpret_cast< void* >( offsetof( Instance, modelMatrix ) + column * 4 * sizeof( float ) ) );
+      context.VertexAttribDivisor( location, 1 );
+    }
+  }
+
+  const GLint colorLocation = program.GetAttribLocation( Program::ATTRIB_INSTANCE_COLOR );
+  if( Program::ATTRIB_UNKNOWN != colorLocation )
+  {
+    const GLuint location = static_cast< GLuint >( colorLocation );
+    context.EnableVertexAttributeArray( location );
+    context.VertexAttribPointer( location, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast< void* >( offsetof( Instance, color ) ) );
+    context.VertexAttribDivisor( location, 1 );
+  }
+}
+
+void Renderer::SetInstanceAttributeValues( Context& context, Program& program, const Matrix& modelMatrix, const Vector4& color )
+{
+  const GLint matrixLocation = program.GetAttribLocation( Program::ATTRIB_INSTANCE_MODEL_MATRIX );
+  if( Program::ATTRIB_UNKNOWN != matrixLocation )
+  {
+    for( GLint column = 0; column < MATRIX_ATTRIBUTE_COLUMNS; ++column )
+    {
+      context.VertexAttrib4fv( static_cast< GLuint >( matrixLocation + column ), modelMatrix.AsFloat() + column * 4 );
+    }
+  }
+
+  const GLint colorLocation = program.GetAttribLocation( Program::ATTRIB_INSTANCE_COLOR );
+  if( Program::ATTRIB_UNKNOWN != colorLocation )
+  {
+    context.VertexAttrib4fv( static_cast< GLuint >( colorLocation ), color.AsFloat() );
+  }
+}
+
+void Renderer::DisableInstanceAttributes( Context& context, Program& program )
+{
+  const GLint matrixLocation = program.GetAttribLocation( Program::ATTRIB_INSTANCE_MODEL_MATRIX );
+  if( Program::ATTRIB_UNKNOWN != matrixLocation )
+  {
+    for( GLint column = 0; column < MATRIX_ATTRIBUTE_COLUMNS; ++column )
+    {
+      const GLuint location = static_cast< GLuint >( matrixLocation + column );
+      context.VertexAttribDivisor( location, 0 );
+      context.DisableVertexAttributeArray( location );
+    }
+  }
+
+  const GLint colorLocation = program.GetAttribLocation( Program::ATTRIB_INSTANCE_COLOR );
+  if( Program::ATTRIB_UNKNOWN != colorLocation )
+  {
+    const GLuint location = static_cast< GLuint >( colorLocation );
+    context.VertexAttribDivisor( location, 0 );
+    context.DisableVertexAttributeArray( location );
   }
 }
 
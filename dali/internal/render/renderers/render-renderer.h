@@ -21,6 +21,7 @@
 // INTERNAL INCLUDES
 #include <dali/public-api/math/matrix.h>
 #include <dali/public-api/math/vector4.h>
+#include <dali/devel-api/common/owner-container.h>
 #include <dali/public-api/rendering/texture-set.h>
 #include <dali/internal/common/blending-options.h>
 #include <dali/internal/common/message.h>
@@ -38,8 +39,10 @@ namespace Dali
 namespace Internal
 {
 class Context;
+class GpuBuffer;
 class Texture;
 class Program;
+class UniformBuffer;
 
 namespace SceneGraph
 {
@@ -89,6 +92,15 @@ public:
     StencilOperation::Type stencilOperationOnZPass:4; ///< The stencil operation for depth test pass
   };
 
+  /**
+   * @brief Struct holding the data of an instance of an instanced draw call.
+   */
+  struct Instance
+  {
+    float modelMatrix[16]; ///< The model matrix of the node
+    Vector4 color;         ///< The color of the node, as set to the uColor uniform
+  };
+
   /**
    * @copydoc Dali::Internal::GlResourceOwner::GlContextDestroyed()
    */
@@ -351,6 +363,9 @@ public:
    * @param[in] size Size of the render item
    * @param[in] blend If true, blending is enabled
    * @param[in] boundTextures The textures bound for rendering
+   * @param[in] instanceBuffer The buffer holding an Instance for each instance to draw, or NULL to draw the node only
+   * @param[in] instanceCount The number of instances in the buffer
+   * @param[in] uniformBuffer The buffer the uniform blocks of the program are written to
    */
   void Render( Context& context,
                BufferIndex bufferIndex,
@@ -361,7 +376,46 @@ public:
                const Matrix& projectionMatrix,
                const Vector3& size,
                bool blend,
-               Vector<GLuint>& boundTextures );
+               Vector<GLuint>& boundTextures,
+               const GpuBuffer* instanceBuffer,
+               uint32_t instanceCount,
+               UniformBuffer& uniformBuffer );
+
+  /**
+   * Checks whether the shader of the renderer reads the model matrix and color of each instance from attributes.
+   * The renderer is drawn by instanced draw calls if the context supports them, otherwise the attributes are
+   * set to constant values and each item is drawn on its own.
+   * @return True if the shader expects the per-instance attributes
+   */
+  bool IsInstanced() const;
+
+  /**
+   * Checks whether another renderer can be drawn by the same instanced draw call as this renderer.
+   * This is the case if the renderers only differ by the model matrix and color of their nodes.
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] node The node using this renderer
+   * @param[in] renderer The other renderer
+   * @param[in] rendererNode The node using the other renderer
+   * @return True if the other renderer can be drawn as an instance of this renderer
+   */
+  bool CanDrawInstanceOf( BufferIndex bufferIndex,
+                          const SceneGraph::NodeDataProvider& node,
+                          const Renderer& renderer,
+                          const SceneGraph::NodeDataProvider& rendererNode ) const;
+
+  /**
+   * Called when the renderer is drawn as an instance of another renderer,
+   * so its caches are refreshed when it is drawn by itself again.
+   */
+  void SetDrawnAsInstance();
+
+  /**
+   * Gets the color to render a node with, including the opacity of the renderer.
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] node The node using this renderer
+   * @return The color, as set to the uColor uniform
+   */
+  Vector4 GetRenderColor( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node ) const;
 
   /**
    * Write the renderer's sort attributes to the passed in reference
@@ -381,6 +435,7 @@ public:
 private:
 
   struct UniformIndexMap;
+  struct NodeUniformIndexMap;
 
   // Undefined
   Renderer( const Renderer& );
@@ -396,13 +451,36 @@ private:
   void SetBlending( Context& context, bool blend );
 
   /**
-   * Set the uniforms from properties according to the uniform map
+   * Get the uniform index map of a node, merging it again if the uniform maps have changed since it was last used
    * @param[in] bufferIndex The index of the previous update buffer.
    * @param[in] node The node using the renderer
+   * @param[in] program The shader program the uniforms are registered to
+   * @return The uniform index map of the node
+   */
+  NodeUniformIndexMap& GetUniformIndexMap( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, Program& program );
+
+  /**
+   * Merge the uniform maps of the renderer and a node into a uniform index map
+   * @param[in] uniformMap The uniform map of the renderer
+   * @param[in] uniformMapNode The uniform map of the node
+   * @param[in] program The shader program the uniforms are registered to
+   * @param[in] keepVersions Whether the versions of the values set in the program are kept for the unchanged uniforms
+   * @param[in,out] nodeMap The uniform index map to merge into
+   */
+  void BuildUniformIndexMap( const SceneGraph::CollectedUniformMap& uniformMap,
+                             const SceneGraph::CollectedUniformMap& uniformMapNode,
+                             Program& program,
+                             bool keepVersions,
+                             NodeUniformIndexMap& nodeMap );
+
+  /**
+   * Set the uniforms from properties according to the uniform map
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] nodeMap The uniform index map of the node using the renderer
    * @param[in] size The size of the renderer
    * @param[in] program The shader program on which to set the uniforms.
    */
-  void SetUniforms( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, const Vector3& size, Program& program );
+  void SetUniforms( BufferIndex bufferIndex, NodeUniformIndexMap& nodeMap, const Vector3& size, Program& program );
 
   /**
    * Set the program uniform in the map from the mapped property
@@ -412,6 +490,33 @@ private:
    */
   void SetUniformFromProperty( BufferIndex bufferIndex, Program& program, UniformIndexMap& map );
 
+  /**
+   * Write the standard and mapped uniforms of the uniform blocks of the program to the uniform buffer,
+   * and bind the range of each block
+   * @param[in] context The GL context
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] node The node using the renderer
+   * @param[in] nodeMap The uniform index map of the node
+   * @param[in] modelMatrix The model matrix.
+   * @param[in] modelViewMatrix The model-view matrix.
+   * @param[in] viewMatrix The view matrix.
+   * @param[in] projectionMatrix The projection matrix.
+   * @param[in] size The size of the renderer
+   * @param[in] program The shader program
+   * @param[in] uniformBuffer The buffer the uniform blocks are written to
+   */
+  void WriteUniformBlocks( Context& context,
+                           BufferIndex bufferIndex,
+                           const SceneGraph::NodeDataProvider& node,
+                           NodeUniformIndexMap& nodeMap,
+                           const Matrix& modelMatrix,
+                           const Matrix& modelViewMatrix,
+                           const Matrix& viewMatrix,
+                           const Matrix& projectionMatrix,
+                           const Vector3& size,
+                           Program& program,
+                           UniformBuffer& uniformBuffer );
+
   /**
    * Bind the textures and setup the samplers
    * @param[in] context The GL context
@@ -421,6 +526,30 @@ private:
    */
   bool BindTextures( Context& context, Program& program, Vector<GLuint>& boundTextures );
 
+  /**
+   * Binds the per-instance attributes of the program to an instance buffer
+   * @param[in] context The GL context
+   * @param[in] program The shader program
+   * @param[in] instanceBuffer The buffer holding an Instance for each instance to draw
+   */
+  void EnableInstanceAttributes( Context& context, Program& program, const GpuBuffer& instanceBuffer );
+
+  /**
+   * Sets the per-instance attributes of the program to constant values, when the item is not drawn as an instance
+   * @param[in] context The GL context
+   * @param[in] program The shader program
+   * @param[in] modelMatrix The model matrix of the node
+   * @param[in] color The color of the node, as set to the uColor uniform
+   */
+  void SetInstanceAttributeValues( Context& context, Program& program, const Matrix& modelMatrix, const Vector4& color );
+
+  /**
+   * Unbinds the per-instance attributes of the program
+   * @param[in] context The GL context
+   * @param[in] program The shader program
+   */
+  void DisableInstanceAttributes( Context& context, Program& program );
+
 private:
 
   OwnerPointer< SceneGraph::RenderDataProvider > mRenderDataProvider;
@@ -432,11 +561,29 @@ private:
   {
     uint32_t                   uniformIndex;                ///< The index of the cached location in the Program
     const PropertyInputImpl*   propertyValue;
+    uint32_t                   propertyVersion;             ///< The version of the value last set in the Program, zero if not set
   };
 
   typedef Dali::Vector< UniformIndexMap > UniformIndexMappings;
 
-  UniformIndexMappings         mUniformIndexMap;
+  /**
+   * The uniforms of the renderer and of a node using it, merged for a program.
+   * The address of the map is the owner of the values it sets in the program.
+   */
+  struct NodeUniformIndexMap
+  {
+    const SceneGraph::NodeDataProvider* node;               ///< The node the map was merged for
+    const Program*               program;                   ///< The program the uniforms are registered to
+    UniformIndexMappings         uniformIndexMap;           ///< The merged uniforms
+    Dali::Vector< const PropertyInputImpl* > sources;       ///< The properties of the renderer and node maps the uniforms were merged from
+    Dali::Vector< const PropertyInputImpl* > uniformBlockProperties; ///< The mapped property of each uniform in the uniform blocks, NULL if not mapped
+    uint32_t                     lastUsed;                  ///< When the map was last used, the least recently used map is replaced when there are too many
+  };
+
+  OwnerContainer< NodeUniformIndexMap* > mNodeUniformIndexMaps; ///< The uniform index maps of the nodes using the renderer
+  UniformIndexMappings         mPreviousUniformIndexMap;    ///< The uniform index map before it was last rebuilt
+  Dali::Vector< uint32_t >     mUniformMapIndices;          ///< The index in the merged map of each uniform of the program, kept to avoid allocations
+  uint32_t                     mUniformIndexMapUseCount;    ///< The number of times the uniform index maps have been used
   Vector<GLint>                mAttributesLocation;
 
   StencilParameters            mStencilParameters;          ///< Struct containing all stencil related options
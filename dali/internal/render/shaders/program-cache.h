@@ -92,11 +92,28 @@ public: // API
    */
   virtual GLenum ProgramBinaryFormat() = 0;
 
+  /**
+   * @return the identity of the driver, a binary compiled by another driver isn't used
+   */
+  virtual uint64_t GetDriverIdentity() = 0;
+
   /**
    * @param programData to store/save
    */
   virtual void StoreBinary( Internal::ShaderDataPtr programData ) = 0;
 
+  /**
+   * @return true if the driver can compile programs in the background, to be polled for completion
+   */
+  virtual bool IsParallelCompileSupported() = 0;
+
+  /**
+   * Notifies that a program is ready to be drawn with
+   * @param shaderHash of the program
+   * @param compiledInBackground true if the program has been compiled in the background since it was created
+   */
+  virtual void NotifyProgramReady( size_t shaderHash, bool compiledInBackground ) = 0;
+
 private: // not implemented as non-copyable
 
   ProgramCache( const ProgramCache& rhs );
@@ -18,8 +18,12 @@
 // CLASS HEADER
 #include <dali/internal/render/shaders/program-controller.h>
 
+// EXTERNAL INCLUDES
+#include <cstring>
+
 // INTERNAL INCLUDES
 #include <dali/integration-api/gl-defines.h>
+#include <dali/internal/common/hash-64.h>
 #include <dali/internal/common/shader-saver.h>
 #include <dali/internal/render/gl-resources/gl-call-debug.h>
 #include <dali/internal/render/shaders/program.h>
@@ -35,7 +39,9 @@ ProgramController::ProgramController( Integration::GlAbstraction& glAbstraction
   mGlAbstraction( glAbstraction ),
   mCurrentProgram( NULL ),
   mProgramBinaryFormat( 0 ),
-  mNumberOfProgramBinaryFormats( 0 )
+  mNumberOfProgramBinaryFormats( 0 ),
+  mDriverIdentity( 0u ),
+  mParallelCompileSupported( false )
 {
   // we have 17 default programs so make room for those and a few custom ones as well
   mProgramCache.Reserve( 32 );
@@ -75,12 +81,28 @@ void ProgramController::GlContextCreated()
     LOG_GL("GetIntegerv(GL_PROGRAM_BINARY_FORMATS_OES) = %d\n", programBinaryFormats[0] );
     mProgramBinaryFormat = programBinaryFormats[0];
   }
+
+  // The binaries are only valid for the driver which compiled them
+  uint64_t driverIdentity = INITIAL_HASH_VALUE_64;
+  const GLenum driverStrings[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+  for( auto&& name : driverStrings )
+  {
+    driverIdentity = CalculateHash64( reinterpret_cast< const char* >( mGlAbstraction.GetString( name ) ), driverIdentity );
+  }
+  mDriverIdentity = CalculateHash64( &mProgramBinaryFormat, sizeof( mProgramBinaryFormat ), driverIdentity );
+
+  // find out if programs can be compiled in the background
+  const char* extensions = reinterpret_cast< const char* >( mGlAbstraction.GetString( GL_EXTENSIONS ) );
+  mParallelCompileSupported = extensions && ( strstr( extensions, "GL_KHR_parallel_shader_compile" ) || strstr( extensions, "GL_ARB_parallel_shader_compile" ) );
+  LOG_GL( "Parallel shader compile supported: %d\n", mParallelCompileSupported );
 }
 
 void ProgramController::GlContextDestroyed()
 {
   mNumberOfProgramBinaryFormats = 0;
   mProgramBinaryFormat = 0;
+  mDriverIdentity = 0u;
+  mParallelCompileSupported = false;
 
   SetCurrentProgram( NULL );
   // Inform programs they are no longer valid
@@ -139,6 +161,11 @@ GLenum ProgramController::ProgramBinaryFormat()
   return mProgramBinaryFormat;
 }
 
+uint64_t ProgramController::GetDriverIdentity()
+{
+  return mDriverIdentity;
+}
+
 void ProgramController::StoreBinary( Internal::ShaderDataPtr programData )
 {
   DALI_ASSERT_DEBUG( programData->GetBufferSize() > 0 );
@@ -146,10 +173,46 @@ void ProgramController::StoreBinary( Internal::ShaderDataPtr programData )
 
   if( mShaderSaver != NULL )
   {
+    programData->SetDriverIdentity( mDriverIdentity );
     mShaderSaver->SaveBinary( programData );
   }
 }
 
+bool ProgramController::IsParallelCompileSupported()
+{
+  return mParallelCompileSupported;
+}
+
+void ProgramController::NotifyProgramReady( size_t shaderHash, bool compiledInBackground )
+{
+  if( mShaderSaver != NULL )
+  {
+    mShaderSaver->ProgramReady( shaderHash, compiledInBackground );
+  }
+}
+
+bool ProgramController::FinishCompilingPrograms()
+{
+  bool compiling = false;
+  const ProgramIterator end = mProgramCache.End();
+  for ( ProgramIterator iter = mProgramCache.Begin(); iter != end; ++iter )
+  {
+    Program* program = (*iter)->GetProgram();
+    if( !program->IsReady() )
+    {
+      if( program->FinishCompiling() )
+      {
+        NotifyProgramReady( (*iter)->GetHash(), true );
+      }
+      else
+      {
+        compiling = true;
+      }
+    }
+  }
+  return compiling;
+}
+
 void ProgramController::SetShaderSaver( ShaderSaver& shaderSaver )
 {
   mShaderSaver = &shaderSaver;
@@ -129,6 +129,12 @@ public: // API
    */
   void ClearCurrentProgram();
 
+  /**
+   * Finishes loading the programs which the driver has compiled in the background
+   * @return true if some programs are still being compiled
+   */
+  bool FinishCompilingPrograms();
+
 private: // From ProgramCache
 
   /**
@@ -166,11 +172,26 @@ private: // From ProgramCache
    */
   virtual GLenum ProgramBinaryFormat();
 
+  /**
+   * @copydoc ProgramCache::GetDriverIdentity
+   */
+  virtual uint64_t GetDriverIdentity();
+
   /**
    * @copydoc ProgramCache::StoreBinary
    */
   virtual void StoreBinary( Internal::ShaderDataPtr programData );
 
+  /**
+   * @copydoc ProgramCache::IsParallelCompileSupported
+   */
+  virtual bool IsParallelCompileSupported();
+
+  /**
+   * @copydoc ProgramCache::NotifyProgramReady
+   */
+  virtual void NotifyProgramReady( size_t shaderHash, bool compiledInBackground );
+
 private: // not implemented as non-copyable
 
   ProgramController( const ProgramController& rhs );
@@ -188,6 +209,8 @@ private: // Data
 
   GLint mProgramBinaryFormat;
   GLint mNumberOfProgramBinaryFormats;
+  uint64_t mDriverIdentity; ///< Hash over the vendor, renderer, version and binary format of the driver
+  bool mParallelCompileSupported; ///< Whether the driver supports KHR_parallel_shader_compile
 
 };
 
@@ -26,6 +26,7 @@
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/common/constants.h>
+#include <dali/devel-api/common/hash.h>
 #include <dali/integration-api/debug.h>
 #include <dali/internal/common/shader-data.h>
 #include <dali/integration-api/gl-defines.h>
@@ -79,8 +80,10 @@ namespace
 
 const char* const gStdAttribs[ Program::ATTRIB_TYPE_LAST ] =
 {
-  "aPosition",    // ATTRIB_POSITION
-  "aTexCoord",    // ATTRIB_TEXCOORD
+  "aPosition",            // ATTRIB_POSITION
+  "aTexCoord",            // ATTRIB_TEXCOORD
+  "aInstanceModelMatrix", // ATTRIB_INSTANCE_MODEL_MATRIX
+  "aInstanceColor",       // ATTRIB_INSTANCE_COLOR
 };
 
 const char* const gStdUniforms[ Program::UNIFORM_TYPE_LAST ] =
@@ -98,6 +101,11 @@ const char* const gStdUniforms[ Program::UNIFORM_TYPE_LAST ] =
   "uSize"                 // UNIFORM_SIZE
 };
 
+/**
+ * Uniform blocks need at least GLSL ES 3.00, so the blocks of shaders with an older version aren't queried
+ */
+const char* const UNIFORM_BLOCK_SHADER_VERSION = "#version 3";
+
 }  // <unnamed> namespace
 
 // IMPLEMENTATION
@@ -115,6 +123,11 @@ Program* Program::New( ProgramCache& cache, Internal::ShaderDataPtr shaderData,
     cache.AddProgram( shaderHash, program );
   }
 
+  if( program->IsReady() )
+  {
+    cache.NotifyProgramReady( shaderHash, false );
+  }
+
   return program;
 }
 
@@ -183,17 +196,37 @@ GLint Program::GetCustomAttributeLocation( uint32_t attributeIndex )
 
 uint32_t Program::RegisterUniform( const std::string& name )
 {
-  uint32_t index = 0;
+  return RegisterUniform( name, CalculateHash( name ) );
+}
+
+uint32_t Program::RegisterUniform( const std::string& name, std::size_t hash )
+{
   // find the value from cache
-  for( ;index < static_cast<uint32_t>( mUniformLocations.size() ); ++index )
+  auto iter = mUniformIndices.find( hash );
+  if( iter != mUniformIndices.end() )
   {
-    if( mUniformLocations[ index ].first == name )
+    if( mUniformLocations[ iter->second ].first == name )
     {
       // name found so return index
-      return index;
+      return iter->second;
+    }
+
+    // The hash of another name is the same, so search all the names
+    for( uint32_t index = 0; index < static_cast<uint32_t>( mUniformLocations.size() ); ++index )
+    {
+      if( mUniformLocations[ index ].first == name )
+      {
+        return index;
+      }
     }
   }
-  // if we get here, index is one past end so push back the new name
+  else
+  {
+    mUniformIndices.insert( std::make_pair( hash, static_cast<uint32_t>( mUniformLocations.size() ) ) );
+  }
+
+  // if we get here, the name isn't registered so push back the new name
+  const uint32_t index = static_cast<uint32_t>( mUniformLocations.size() );
   mUniformLocations.push_back( std::make_pair( name, UNIFORM_NOT_QUERIED ) );
   return index;
 }
@@ -365,6 +398,76 @@ void Program::GetActiveSamplerUniforms()
   }
 }
 
+void Program::GetActiveUniformBlocks()
+{
+  mUniformBlocks.clear();
+  mUniformBlockMemberCount = 0u;
+
+  // Querying the blocks would be an error on OpenGL ES 2.0
+  if( !strstr( mProgramData->GetVertexShader(), UNIFORM_BLOCK_SHADER_VERSION ) &&
+      !strstr( mProgramData->GetFragmentShader(), UNIFORM_BLOCK_SHADER_VERSION ) )
+  {
+    return;
+  }
+
+  GLint numberOfActiveUniformBlocks = 0;
+  GLint uniformMaxNameLength = 0;
+  mGlAbstraction.GetProgramiv( mProgramId, GL_ACTIVE_UNIFORM_BLOCKS, &numberOfActiveUniformBlocks );
+  mGlAbstraction.GetProgramiv( mProgramId, GL_ACTIVE_UNIFORM_MAX_LENGTH, &uniformMaxNameLength );
+
+  std::vector< char > name( uniformMaxNameLength + 1 ); // Allow for null terminator
+  mUniformBlocks.resize( numberOfActiveUniformBlocks );
+  for( GLint i = 0; i < numberOfActiveUniformBlocks; ++i )
+  {
+    const GLuint blockIndex = static_cast< GLuint >( i );
+    UniformBlock& block = mUniformBlocks[ blockIndex ];
+    block.binding = blockIndex;
+    block.size = 0;
+    mGlAbstraction.UniformBlockBinding( mProgramId, blockIndex, block.binding );
+    mGlAbstraction.GetActiveUniformBlockiv( mProgramId, blockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &block.size );
+
+    GLint memberCount = 0;
+    mGlAbstraction.GetActiveUniformBlockiv( mProgramId, blockIndex, GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS, &memberCount );
+    if( memberCount <= 0 )
+    {
+      continue;
+    }
+
+    std::vector< GLint > indices( memberCount );
+    mGlAbstraction.GetActiveUniformBlockiv( mProgramId, blockIndex, GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES, indices.data() );
+
+    std::vector< GLuint > uniformIndices( indices.begin(), indices.end() );
+    std::vector< GLint > types( memberCount );
+    std::vector< GLint > offsets( memberCount );
+    std::vector< GLint > matrixStrides( memberCount );
+    mGlAbstraction.GetActiveUniformsiv( mProgramId, memberCount, uniformIndices.data(), GL_UNIFORM_TYPE, types.data() );
+    mGlAbstraction.GetActiveUniformsiv( mProgramId, memberCount, uniformIndices.data(), GL_UNIFORM_OFFSET, offsets.data() );
+    mGlAbstraction.GetActiveUniformsiv( mProgramId, memberCount, uniformIndices.data(), GL_UNIFORM_MATRIX_STRIDE, matrixStrides.data() );
+
+    block.members.resize( memberCount );
+    for( GLint j = 0; j < memberCount; ++j )
+    {
+      GLsizei nameLength = 0;
+      GLint size = 0;
+      GLenum type = GL_ZERO;
+      name[0] = '\0';
+      mGlAbstraction.GetActiveUniform( mProgramId, uniformIndices[j], uniformMaxNameLength, &nameLength, &size, &type, name.data() );
+
+      // The uniforms of a block with an instance name are prefixed by the block name
+      const char* memberName = strrchr( name.data(), '.' );
+      memberName = memberName ? memberName + 1 : name.data();
+
+      UniformBlockMember& member = block.members[j];
+      member.uniformIndex = RegisterUniform( memberName );
+      member.type = static_cast< GLenum >( types[j] );
+      member.offset = offsets[j];
+      member.matrixStride = matrixStrides[j];
+    }
+
+    mUniformBlockMemberCount += static_cast< uint32_t >( memberCount );
+  }
+}
+
 bool Program::GetSamplerUniformLocation( uint32_t index, GLint& location  )
 {
   bool result = false;
@@ -617,6 +720,7 @@ void Program::GlContextCreated()
 void Program::GlContextDestroyed()
 {
   mLinked = false;
+  mCompiling = false;
   mVertexShaderId = 0;
   mFragmentShaderId = 0;
   mProgramId = 0;
@@ -634,11 +738,14 @@ Program::Program( ProgramCache& cache, Internal::ShaderDataPtr shaderData, bool
   mGlAbstraction( mCache.GetGlAbstraction() ),
   mProjectionMatrix( NULL ),
   mViewMatrix( NULL ),
+  mUniformMapOwner( NULL ),
   mLinked( false ),
+  mCompiling( false ),
   mVertexShaderId( 0 ),
   mFragmentShaderId( 0 ),
   mProgramId( 0 ),
   mProgramData(shaderData),
+  mUniformBlockMemberCount( 0u ),
   mModifiesGeometry( modifiesGeometry )
 {
   // reserve space for standard attributes
@@ -677,8 +784,8 @@ void Program::Load()
 
   const bool binariesSupported = mCache.IsBinarySupported();
 
-  // if shader binaries are supported and ShaderData contains compiled bytecode?
-  if( binariesSupported && mProgramData->HasBinary() )
+  // if shader binaries are supported and ShaderData contains bytecode compiled by this driver?
+  if( binariesSupported && mProgramData->HasBinary() && mProgramData->GetDriverIdentity() == mCache.GetDriverIdentity() )
   {
     DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, "Program::Load() - Using Compiled Shader, Size = %d\n", mProgramData->GetBufferSize());
 
@@ -718,35 +825,80 @@ void Program::Load()
   if( GL_FALSE == linked )
   {
     DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, "Program::Load() - Runtime compilation\n");
+    if( mCache.IsParallelCompileSupported() )
+    {
+      // The driver compiles and links in the background, the results are checked by FinishCompiling() once it has completed
+      SubmitShader( GL_VERTEX_SHADER, mVertexShaderId, mProgramData->GetVertexShader() );
+      SubmitShader( GL_FRAGMENT_SHADER, mFragmentShaderId, mProgramData->GetFragmentShader() );
+      SubmitLink();
+      mCompiling = true;
+      return;
+    }
+
     if( CompileShader( GL_VERTEX_SHADER, mVertexShaderId, mProgramData->GetVertexShader() ) )
     {
       if( CompileShader( GL_FRAGMENT_SHADER, mFragmentShaderId, mProgramData->GetFragmentShader() ) )
       {
         Link();
+        SaveBinary();
+      }
+    }
+  }
 
-        if( binariesSupported && mLinked )
-        {
-          GLint  binaryLength = 0;
-          GLenum binaryFormat;
-          DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Compiled and linked.\n\nVS:\n%s\nFS:\n%s\n", mProgramData->GetVertexShader(), mProgramData->GetFragmentShader() );
+  FinishLoad();
+}
 
-          CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramiv(mProgramId, GL_PROGRAM_BINARY_LENGTH_OES, &binaryLength) );
-          DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, "Program::Load() - GL_PROGRAM_BINARY_LENGTH_OES: %d\n", binaryLength);
-          if( binaryLength > 0 )
-          {
-            // Allocate space for the bytecode in ShaderData
-            mProgramData->AllocateBuffer(binaryLength);
-            // Copy the bytecode to ShaderData
-            CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramBinary(mProgramId, binaryLength, NULL, &binaryFormat, mProgramData->GetBufferData()) );
-            mCache.StoreBinary( mProgramData );
-            DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Saved binary.\n" );
-          }
-        }
-      }
+bool Program::FinishCompiling()
+{
+  if( mCompiling )
+  {
+    GLint completed = GL_TRUE;
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramiv( mProgramId, GL_COMPLETION_STATUS_KHR, &completed ) );
+    if( GL_FALSE == completed )
+    {
+      return false;
+    }
+
+    mCompiling = false;
+    if( CheckShaderCompiled( mVertexShaderId, mProgramData->GetVertexShader() ) &&
+        CheckShaderCompiled( mFragmentShaderId, mProgramData->GetFragmentShader() ) )
+    {
+      CheckLinked();
+      SaveBinary();
+    }
+
+    FinishLoad();
+  }
+
+  return true;
+}
+
+void Program::SaveBinary()
+{
+  if( mCache.IsBinarySupported() && mLinked )
+  {
+    GLint  binaryLength = 0;
+    GLenum binaryFormat;
+    DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Compiled and linked.\n\nVS:\n%s\nFS:\n%s\n", mProgramData->GetVertexShader(), mProgramData->GetFragmentShader() );
+
+    CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramiv(mProgramId, GL_PROGRAM_BINARY_LENGTH_OES, &binaryLength) );
+    DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, "Program::Load() - GL_PROGRAM_BINARY_LENGTH_OES: %d\n", binaryLength);
+    if( binaryLength > 0 )
+    {
+      // Allocate space for the bytecode in ShaderData
+      mProgramData->AllocateBuffer(binaryLength);
+      // Copy the bytecode to ShaderData
+      CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramBinary(mProgramId, binaryLength, NULL, &binaryFormat, mProgramData->GetBufferData()) );
+      mCache.StoreBinary( mProgramData );
+      DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "Saved binary.\n" );
     }
   }
+}
 
+void Program::FinishLoad()
+{
   GetActiveSamplerUniforms();
+  GetActiveUniformBlocks();
 
   // No longer needed
   FreeShaders();
@@ -775,6 +927,12 @@ void Program::Unload()
 }
 
 bool Program::CompileShader( GLenum shaderType, GLuint& shaderId, const char* src )
+{
+  SubmitShader( shaderType, shaderId, src );
+  return CheckShaderCompiled( shaderId, src );
+}
+
+void Program::SubmitShader( GLenum shaderType, GLuint& shaderId, const char* src )
 {
   if (!shaderId)
   {
@@ -789,7 +947,10 @@ bool Program::CompileShader( GLenum shaderType, GLuint& shaderId, const char* sr
 
   LOG_GL( "CompileShader(%d)\n", shaderId );
   CHECK_GL( mGlAbstraction, mGlAbstraction.CompileShader( shaderId ) );
+}
 
+bool Program::CheckShaderCompiled( GLuint shaderId, const char* src )
+{
   GLint compiled;
   LOG_GL( "GetShaderiv(%d)\n", shaderId );
   CHECK_GL( mGlAbstraction, mGlAbstraction.GetShaderiv( shaderId, GL_COMPILE_STATUS, &compiled ) );
@@ -816,10 +977,19 @@ bool Program::CompileShader( GLenum shaderType, GLuint& shaderId, const char* sr
 }
 
 void Program::Link()
+{
+  SubmitLink();
+  CheckLinked();
+}
+
+void Program::SubmitLink()
 {
   LOG_GL( "LinkProgram(%d)\n", mProgramId );
   CHECK_GL( mGlAbstraction, mGlAbstraction.LinkProgram( mProgramId ) );
+}
 
+void Program::CheckLinked()
+{
   GLint linked;
   LOG_GL( "GetProgramiv(%d)\n", mProgramId );
   CHECK_GL( mGlAbstraction, mGlAbstraction.GetProgramiv( mProgramId, GL_LINK_STATUS, &linked ) );
@@ -881,6 +1051,7 @@ void Program::ResetAttribsUniformCache()
   mSamplerUniformLocations.clear();
 
   // reset uniform caches
+  mUniformMapOwner = NULL;
   mSizeUniformCache.x = mSizeUniformCache.y = mSizeUniformCache.z = 0.f;
 
   for( uint32_t i = 0; i < MAX_UNIFORM_CACHE_SIZE; ++i )
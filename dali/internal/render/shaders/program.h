@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <string>
+#include <unordered_map>
 #include <cstdint> // int32_t, uint32_t
 
 // INTERNAL INCLUDES
@@ -73,9 +74,32 @@ public:
     ATTRIB_UNKNOWN = -1,
     ATTRIB_POSITION,
     ATTRIB_TEXCOORD,
+    ATTRIB_INSTANCE_MODEL_MATRIX,
+    ATTRIB_INSTANCE_COLOR,
     ATTRIB_TYPE_LAST
   };
 
+  /**
+   * An active uniform in a uniform block
+   */
+  struct UniformBlockMember
+  {
+    uint32_t uniformIndex; ///< The index of the uniform in the uniform location cache
+    GLenum type;           ///< The GL type of the uniform
+    GLint offset;          ///< The offset of the uniform in bytes from the start of the block
+    GLint matrixStride;    ///< The stride in bytes between the columns of a matrix uniform
+  };
+
+  /**
+   * An active uniform block, whose uniforms are read from a range of a uniform buffer
+   */
+  struct UniformBlock
+  {
+    GLuint binding;                            ///< The uniform buffer binding point of the block
+    GLint size;                                ///< The size of the block in bytes
+    std::vector< UniformBlockMember > members; ///< The active uniforms of the block
+  };
+
   /**
    * Common shader uniform names
    */
@@ -119,6 +143,20 @@ public:
    */
   bool IsUsed();
 
+  /**
+   * @return true if the program has been loaded, false while the driver is still compiling it in the background
+   */
+  bool IsReady() const
+  {
+    return !mCompiling;
+  }
+
+  /**
+   * Checks whether the driver has finished compiling the program in the background, and finishes loading it if so.
+   * @return true if the program is ready
+   */
+  bool FinishCompiling();
+
   /**
    * @param [in] type of the attribute
    * @return the index of the attribute
@@ -146,6 +184,14 @@ public:
    */
   uint32_t RegisterUniform( const std::string& name );
 
+  /**
+   * Register a uniform name in our local cache, using its precalculated hash to find it
+   * @param [in] name uniform name
+   * @param [in] hash The hash of the name, as calculated by Dali::CalculateHash()
+   * @return the index of the uniform name in local cache
+   */
+  uint32_t RegisterUniform( const std::string& name, std::size_t hash );
+
   /**
    * Gets the location of a pre-registered uniform.
    * Uniforms in list UniformType are always registered and in the order of the enumeration
@@ -159,6 +205,30 @@ public:
    */
   void GetActiveSamplerUniforms();
 
+  /**
+   * Introspect the newly loaded shader to get the layouts of the active uniform blocks.
+   * Each block is bound to the uniform buffer binding point of its index.
+   */
+  void GetActiveUniformBlocks();
+
+  /**
+   * Gets the active uniform blocks of the program
+   * @return The uniform blocks, empty if the shader doesn't use uniform blocks
+   */
+  const std::vector< UniformBlock >& GetUniformBlocks() const
+  {
+    return mUniformBlocks;
+  }
+
+  /**
+   * Gets the number of active uniforms in all of the uniform blocks
+   * @return The number of uniforms
+   */
+  uint32_t GetUniformBlockMemberCount() const
+  {
+    return mUniformBlockMemberCount;
+  }
+
   /**
    * Gets the uniform location for a sampler
    * @param [in] index The index of the active sampler
@@ -303,6 +373,24 @@ public:
     return mViewMatrix;
   }
 
+  /**
+   * Set the owner of the uniform map values that have currently been sent
+   * @param owner of the values, or NULL if they may have been changed by anyone
+   */
+  void SetUniformMapOwner( const void* owner )
+  {
+    mUniformMapOwner = owner;
+  }
+
+  /**
+   * Get the owner of the uniform map values that have currently been sent
+   * @return the owner of the values
+   */
+  const void* GetUniformMapOwner() const
+  {
+    return mUniformMapOwner;
+  }
+
 private: // Implementation
 
   /**
@@ -336,6 +424,16 @@ private:
    */
   void Unload();
 
+  /**
+   * Queries the uniforms of the linked program and frees the shaders
+   */
+  void FinishLoad();
+
+  /**
+   * Saves the binary of the linked program, if binaries are supported
+   */
+  void SaveBinary();
+
   /**
    * Compile the shader
    * @param shaderType vertex or fragment shader
@@ -345,11 +443,37 @@ private:
    */
   bool CompileShader(GLenum shaderType, GLuint& shaderId, const char* src);
 
+  /**
+   * Starts compiling the shader, without waiting for the result
+   * @param shaderType vertex or fragment shader
+   * @param shaderId of the shader, returned
+   * @param src of the shader
+   */
+  void SubmitShader(GLenum shaderType, GLuint& shaderId, const char* src);
+
+  /**
+   * Checks the result of compiling the shader
+   * @param shaderId of the shader
+   * @param src of the shader, logged if the compilation failed
+   * @return true if the compilation succeeded
+   */
+  bool CheckShaderCompiled(GLuint shaderId, const char* src);
+
   /**
    * Links the shaders together to create program
    */
   void Link();
 
+  /**
+   * Starts linking the shaders, without waiting for the result
+   */
+  void SubmitLink();
+
+  /**
+   * Checks the result of linking the shaders
+   */
+  void CheckLinked();
+
   /**
    * Frees the shader programs
    */
@@ -366,7 +490,9 @@ private:  // Data
   Integration::GlAbstraction& mGlAbstraction; ///< The OpenGL Abstraction layer
   const Matrix* mProjectionMatrix;            ///< currently set projection matrix
   const Matrix* mViewMatrix;                  ///< currently set view matrix
+  const void* mUniformMapOwner;               ///< owner of the currently set uniform map values
   bool mLinked;                               ///< whether the program is linked
+  bool mCompiling;                            ///< whether the driver is compiling the program in the background
   GLuint mVertexShaderId;                     ///< GL identifier for vertex shader
   GLuint mFragmentShaderId;                   ///< GL identifier for fragment shader
   GLuint mProgramId;                          ///< GL identifier for program
@@ -378,7 +504,10 @@ private:  // Data
 
   Locations mAttributeLocations;      ///< attribute location cache
   Locations mUniformLocations;        ///< uniform location cache
+  std::unordered_map< std::size_t, uint32_t > mUniformIndices; ///< The index in the uniform location cache of each uniform name hash
   std::vector<GLint> mSamplerUniformLocations; ///< sampler uniform location cache
+  std::vector< UniformBlock > mUniformBlocks;  ///< The layouts of the active uniform blocks
+  uint32_t mUniformBlockMemberCount;           ///< The number of uniforms in all of the uniform blocks
 
   // uniform value caching
   GLint mUniformCacheInt[ MAX_UNIFORM_CACHE_SIZE ];         ///< Value cache for uniforms of single int
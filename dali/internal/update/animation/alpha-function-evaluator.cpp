@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/animation/alpha-function-evaluator.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/constants.h>
+#include <dali/public-api/math/math-utils.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+namespace
+{
+
+const uint32_t NEWTON_ITERATIONS = 4u;          ///< The number of Newton-Raphson iterations refining the curve parameter
+const float NEWTON_MINIMUM_SLOPE = 0.001f;      ///< The slope below which the curve parameter is found by bisection instead
+const uint32_t BISECTION_ITERATIONS = 10u;      ///< The maximum number of bisection iterations
+const float BISECTION_PRECISION = 0.0000001f;   ///< The precision at which the bisection stops
+
+float EaseInSquare( float progress )
+{
+  return progress * progress;
+}
+
+float EaseOutSquare( float progress )
+{
+  return 1.0f - ( 1.0f - progress ) * ( 1.0f - progress );
+}
+
+float Reverse( float progress )
+{
+  return 1.0f - progress;
+}
+
+float EaseIn( float progress )
+{
+  return progress * progress * progress;
+}
+
+float EaseOut( float progress )
+{
+  return ( progress - 1.0f ) * ( progress - 1.0f ) * ( progress - 1.0f ) + 1.0f;
+}
+
+float EaseInOut( float progress )
+{
+  return progress * progress * ( 3.0f - 2.0f * progress );
+}
+
+float EaseInSine( float progress )
+{
+  return -1.0f * cosf( progress * Math::PI_2 ) + 1.0f;
+}
+
+float EaseOutSine( float progress )
+{
+  return sinf( progress * Math::PI_2 );
+}
+
+float EaseInOutSine( float progress )
+{
+  return -0.5f * ( cosf( Math::PI * progress ) - 1.0f );
+}
+
+float Bounce( float progress )
+{
+  return sinf( progress * Math::PI );
+}
+
+float Sin( float progress )
+{
+  return 0.5f - cosf( progress * 2.0f * Math::PI ) * 0.5f;
+}
+
+float EaseOutBack( float progress )
+{
+  const float sqrt2 = 1.70158f;
+  progress -= 1.0f;
+  return 1.0f + progress * progress * ( ( sqrt2 + 1.0f ) * progress + sqrt2 );
+}
+
+/**
+ * The built-in functions, in the order of AlphaFunction::BuiltinFunction; linear functions don't need one.
+ */
+const AlphaFunctionPrototype BUILTIN_FUNCTIONS[ AlphaFunction::COUNT ] =
+{
+  nullptr,       // DEFAULT
+  nullptr,       // LINEAR
+  Reverse,       // REVERSE
+  EaseInSquare,  // EASE_IN_SQUARE
+  EaseOutSquare, // EASE_OUT_SQUARE
+  EaseIn,        // EASE_IN
+  EaseOut,       // EASE_OUT
+  EaseInOut,     // EASE_IN_OUT
+  EaseInSine,    // EASE_IN_SINE
+  EaseOutSine,   // EASE_OUT_SINE
+  EaseInOutSine, // EASE_IN_OUT_SINE
+  Bounce,        // BOUNCE
+  Sin,           // SIN
+  EaseOutBack    // EASE_OUT_BACK
+};
+
+/**
+ * Samples a coordinate of a cubic bezier curve, which starts at 0 and ends at 1.
+ * @param[in] coefficients The coefficients of t, t^2 and t^3 of the coordinate
+ * @param[in] t The parameter of the curve, between 0 and 1
+ * @return The coordinate at t
+ */
+inline float SampleCurve( const float* coefficients, float t )
+{
+  return ( ( coefficients[2] * t + coefficients[1] ) * t + coefficients[0] ) * t;
+}
+
+/**
+ * Samples the derivative of a coordinate of a cubic bezier curve, which starts at 0 and ends at 1.
+ * @param[in] coefficients The coefficients of t, t^2 and t^3 of the coordinate
+ * @param[in] t The parameter of the curve, between 0 and 1
+ * @return The derivative of the coordinate at t
+ */
+inline float SampleCurveDerivative( const float* coefficients, float t )
+{
+  return ( 3.0f * coefficients[2] * t + 2.0f * coefficients[1] ) * t + coefficients[0];
+}
+
+/**
+ * Calculates the coefficients of a coordinate of a cubic bezier curve, which starts at 0 and ends at 1.
+ * @param[in] firstControlPoint The coordinate of the first control point
+ * @param[in] secondControlPoint The coordinate of the second control point
+ * @param[out] coefficients The coefficients of t, t^2 and t^3 of the coordinate
+ */
+void CalculateCoefficients( float firstControlPoint, float secondControlPoint, float* coefficients )
+{
+  coefficients[0] = 3.0f * firstControlPoint;
+  coefficients[1] = 3.0f * ( secondControlPoint - firstControlPoint ) - coefficients[0];
+  coefficients[2] = 1.0f - coefficients[0] - coefficients[1];
+}
+
+} // unnamed namespace
+
+AlphaFunctionEvaluator::AlphaFunctionEvaluator( const AlphaFunction& alphaFunction )
+: mSamples(),
+  mFunction( nullptr ),
+  mCustomFunction( nullptr ),
+  mCoefficientsX(),
+  mCoefficientsY(),
+  mBezier( false )
+{
+  Set( alphaFunction, false );
+}
+
+void AlphaFunctionEvaluator::Set( const AlphaFunction& alphaFunction, bool sampleCustomFunction )
+{
+  mSamples.Clear();
+  mFunction = nullptr;
+  mCustomFunction = nullptr;
+  mBezier = false;
+
+  switch( alphaFunction.GetMode() )
+  {
+    case AlphaFunction::BUILTIN_FUNCTION:
+    {
+      const AlphaFunction::BuiltinFunction builtin = alphaFunction.GetBuiltinFunction();
+      if( builtin < AlphaFunction::COUNT )
+      {
+        mFunction = BUILTIN_FUNCTIONS[ builtin ];
+      }
+      break;
+    }
+    case AlphaFunction::CUSTOM_FUNCTION:
+    {
+      AlphaFunctionPrototype customFunction = alphaFunction.GetCustomFunction();
+      if( customFunction && sampleCustomFunction )
+      {
+        mCustomFunction = customFunction;
+        mSamples.Resize( CUSTOM_SAMPLE_COUNT );
+        for( uint32_t i = 0u; i < CUSTOM_SAMPLE_COUNT; ++i )
+        {
+          mSamples[i] = customFunction( static_cast<float>( i ) / static_cast<float>( CUSTOM_SAMPLE_COUNT - 1u ) );
+        }
+      }
+      else
+      {
+        mFunction = customFunction;
+      }
+      break;
+    }
+    case AlphaFunction::BEZIER:
+    {
+      const Vector4 controlPoints = alphaFunction.GetBezierControlPoints();
+      CalculateCoefficients( controlPoints.x, controlPoints.z, mCoefficientsX );
+      CalculateCoefficients( controlPoints.y, controlPoints.w, mCoefficientsY );
+
+      mBezier = true;
+      mSamples.Resize( BEZIER_SAMPLE_COUNT );
+      for( uint32_t i = 0u; i < BEZIER_SAMPLE_COUNT; ++i )
+      {
+        mSamples[i] = SampleCurve( mCoefficientsX, static_cast<float>( i ) / static_cast<float>( BEZIER_SAMPLE_COUNT - 1u ) );
+      }
+      break;
+    }
+  }
+}
+
+float AlphaFunctionEvaluator::EvaluateBezier( float progress ) const
+{
+  // If progress is very close to 0 or very close to 1 we don't need to evaluate the curve as the result will
+  // be almost 0 or almost 1 respectively
+  if( ( progress <= Math::MACHINE_EPSILON_1 ) || ( ( 1.0f - progress ) <= Math::MACHINE_EPSILON_1 ) )
+  {
+    return progress;
+  }
+
+  // The control points are within [0,1] horizontally, so the samples are in increasing order
+  const float sampleStep = 1.0f / static_cast<float>( BEZIER_SAMPLE_COUNT - 1u );
+  uint32_t interval = 0u;
+  while( ( interval < BEZIER_SAMPLE_COUNT - 2u ) && ( mSamples[ interval + 1u ] <= progress ) )
+  {
+    ++interval;
+  }
+
+  // Guess the curve parameter by interpolating the samples
+  const float intervalStart = mSamples[ interval ];
+  const float intervalSize = mSamples[ interval + 1u ] - intervalStart;
+  const float fraction = ( intervalSize > 0.0f ) ? ( progress - intervalStart ) / intervalSize : 0.0f;
+  float t = ( static_cast<float>( interval ) + fraction ) * sampleStep;
+
+  const float slope = SampleCurveDerivative( mCoefficientsX, t );
+  if( slope >= NEWTON_MINIMUM_SLOPE )
+  {
+    for( uint32_t i = 0u; i < NEWTON_ITERATIONS; ++i )
+    {
+      const float derivative = SampleCurveDerivative( mCoefficientsX, t );
+      if( EqualsZero( derivative ) )
+      {
+        break;
+      }
+      t -= ( SampleCurve( mCoefficientsX, t ) - progress ) / derivative;
+    }
+  }
+  else if( !EqualsZero( slope ) )
+  {
+    // The curve is too flat for Newton-Raphson, so bisect the interval instead
+    float lowerBound = static_cast<float>( interval ) * sampleStep;
+    float upperBound = lowerBound + sampleStep;
+    for( uint32_t i = 0u; i < BISECTION_ITERATIONS; ++i )
+    {
+      t = ( lowerBound + upperBound ) * 0.5f;
+      const float difference = SampleCurve( mCoefficientsX, t ) - progress;
+      if( std::abs( difference ) <= BISECTION_PRECISION )
+      {
+        break;
+      }
+      if( difference > 0.0f )
+      {
+        upperBound = t;
+      }
+      else
+      {
+        lowerBound = t;
+      }
+    }
+  }
+
+  t = std::min( std::max( t, 0.0f ), 1.0f );
+  return SampleCurve( mCoefficientsY, t );
+}
+
+float AlphaFunctionEvaluator::EvaluateSamples( float progress ) const
+{
+  if( ( progress < 0.0f ) || ( progress > 1.0f ) )
+  {
+    return mCustomFunction( progress );
+  }
+
+  const float position = progress * static_cast<float>( CUSTOM_SAMPLE_COUNT - 1u );
+  const uint32_t index = std::min( static_cast<uint32_t>( position ), CUSTOM_SAMPLE_COUNT - 2u );
+  const float fraction = position - static_cast<float>( index );
+  return mSamples[ index ] + ( mSamples[ index + 1u ] - mSamples[ index ] ) * fraction;
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,112 @@
+#ifndef DALI_INTERNAL_SCENE_GRAPH_ALPHA_FUNCTION_EVALUATOR_H
+#define DALI_INTERNAL_SCENE_GRAPH_ALPHA_FUNCTION_EVALUATOR_H
+
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/animation/alpha-function.h>
+#include <dali/public-api/common/dali-vector.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+/**
+ * Evaluates an alpha function for an animator.
+ *
+ * Everything which doesn't depend on the progress is worked out once, when the evaluator is set:
+ * built-in functions are resolved to a function pointer, and the x coordinates of a bezier curve are
+ * sampled into a table, from which a guess of the curve parameter is refined with Newton-Raphson iterations.
+ * Custom functions may also be sampled, in which case they are approximated by linear interpolation.
+ */
+class AlphaFunctionEvaluator
+{
+public:
+
+  static const uint32_t BEZIER_SAMPLE_COUNT = 11u; ///< The number of samples of the x coordinates of a bezier curve
+  static const uint32_t CUSTOM_SAMPLE_COUNT = 65u; ///< The number of samples of a sampled custom function
+
+  /**
+   * Constructor.
+   * @param[in] alphaFunction The alpha function to evaluate.
+   */
+  explicit AlphaFunctionEvaluator( const AlphaFunction& alphaFunction );
+
+  /**
+   * Sets the alpha function to evaluate.
+   * @param[in] alphaFunction The alpha function to evaluate.
+   * @param[in] sampleCustomFunction Whether a custom function is sampled into a table, rather than called on every evaluation.
+   */
+  void Set( const AlphaFunction& alphaFunction, bool sampleCustomFunction );
+
+  /**
+   * Applies the alpha function to the specified progress.
+   * @param[in] progress The progress of the animation.
+   * @return The progress after the alpha function has been applied.
+   */
+  float Evaluate( float progress ) const
+  {
+    if( mFunction )
+    {
+      return mFunction( progress );
+    }
+    if( mSamples.Empty() )
+    {
+      return progress;
+    }
+    return mBezier ? EvaluateBezier( progress ) : EvaluateSamples( progress );
+  }
+
+private:
+
+  /**
+   * Evaluates the bezier curve at the specified progress.
+   * @param[in] progress The progress of the animation, which is the x coordinate on the curve.
+   * @return The y coordinate on the curve.
+   */
+  float EvaluateBezier( float progress ) const;
+
+  /**
+   * Interpolates the samples of a custom function at the specified progress.
+   * @param[in] progress The progress of the animation.
+   * @return The interpolated value of the function.
+   */
+  float EvaluateSamples( float progress ) const;
+
+private:
+
+  Dali::Vector< float > mSamples;         ///< The samples of the x coordinates of the bezier curve, or of the custom function
+  AlphaFunctionPrototype mFunction;       ///< The function to call, if the alpha function isn't evaluated from the samples
+  AlphaFunctionPrototype mCustomFunction; ///< The sampled custom function, which is called for progress outside of the samples
+  float mCoefficientsX[3];                ///< The coefficients of t, t^2 and t^3 of the x coordinates of the bezier curve
+  float mCoefficientsY[3];                ///< The coefficients of t, t^2 and t^3 of the y coordinates of the bezier curve
+  bool mBezier;                           ///< Whether the samples are of a bezier curve
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SCENE_GRAPH_ALPHA_FUNCTION_EVALUATOR_H
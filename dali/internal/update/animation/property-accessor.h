@@ -80,6 +80,15 @@ public:
     return mProperty->IsClean();
   }
 
+  /**
+   * Retrieve the property.
+   * @return The property.
+   */
+  SceneGraph::AnimatableProperty<PropertyType>* GetProperty() const
+  {
+    return mProperty;
+  }
+
   /**
    * Read access to the property.
    * @param [in] bufferIndex The current update buffer index.
@@ -172,6 +181,15 @@ public:
     return mProperty->IsClean();
   }
 
+  /**
+   * Retrieve the property.
+   * @return The property.
+   */
+  SceneGraph::TransformManagerPropertyHandler<T>* GetProperty() const
+  {
+    return mProperty;
+  }
+
   /**
    * Read access to the property.
    * @param [in] bufferIndex The current update buffer index.
@@ -65,7 +65,9 @@ Animation* Animation::New( float durationSeconds, float speedFactor, const Vecto
 }
 
 Animation::Animation( float durationSeconds, float speedFactor, const Vector2& playRange, int32_t loopCount, Dali::Animation::EndAction endAction, Dali::Animation::EndAction disconnectAction )
-: mPlayRange( playRange ),
+: mAnimators(),
+  mAnimatorBatch(),
+  mPlayRange( playRange ),
   mDurationSeconds( durationSeconds ),
   mDelaySeconds( 0.0f ),
   mElapsedSeconds( playRange.x*mDurationSeconds ),
@@ -78,7 +80,8 @@ Animation::Animation( float durationSeconds, float speedFactor, const Vector2& p
   mDisconnectAction(disconnectAction),
   mState(Stopped),
   mProgressReachedSignalRequired( false ),
-  mAutoReverseEnabled( false )
+  mAutoReverseEnabled( false ),
+  mAnimatorsChanged( false )
 {
 }
 
@@ -91,6 +94,16 @@ void Animation::operator delete( void* ptr )
   gAnimationMemoryPool.FreeThreadSafe( static_cast<Animation*>( ptr ) );
 }
 
+uint32_t Animation::TrimMemoryPool()
+{
+  return gAnimationMemoryPool.TrimThreadSafe();
+}
+
+FixedSizeMemoryPool::Statistics Animation::GetMemoryPoolStatistics()
+{
+  return gAnimationMemoryPool.GetStatistics();
+}
+
 void Animation::SetDuration(float durationSeconds)
 {
   mDurationSeconds = durationSeconds;
@@ -300,6 +313,7 @@ void Animation::AddAnimator( OwnerPointer<AnimatorBase>& animator )
   animator->SetDisconnectAction( mDisconnectAction );
 
   mAnimators.PushBack( animator.Release() );
+  mAnimatorsChanged = true;
 }
 
 void Animation::Update( BufferIndex bufferIndex, float elapsedSeconds, bool& looped, bool& finished, bool& progressReached )
@@ -429,55 +443,65 @@ void Animation::UpdateAnimators( BufferIndex bufferIndex, bool bake, bool animat
   const Vector2 playRange( mPlayRange * mDurationSeconds );
   float elapsedSecondsClamped = Clamp( mElapsedSeconds, playRange.x, playRange.y );
 
-  //Loop through all animators
-  bool applied(true);
+  //Remove animators whose PropertyOwner has been destroyed
   for ( auto&& iter = mAnimators.Begin(); iter != mAnimators.End(); )
   {
-    AnimatorBase *animator = *iter;
-
-    if( animator->Orphan() )
+    if( ( *iter )->Orphan() )
     {
-      //Remove animators whose PropertyOwner has been destroyed
       iter = mAnimators.Erase(iter);
+      mAnimatorsChanged = true;
     }
     else
     {
-      if( animator->IsEnabled() )
-      {
-        const float intervalDelay( animator->GetIntervalDelay() );
+      ++iter;
+    }
+  }
 
-        if( elapsedSecondsClamped >= intervalDelay )
-        {
-          // Calculate a progress specific to each individual animator
-          float progress(1.0f);
-          const float animatorDuration = animator->GetDuration();
-          if (animatorDuration > 0.0f) // animators can be "immediate"
-          {
-            progress = Clamp((elapsedSecondsClamped - intervalDelay) / animatorDuration, 0.0f , 1.0f );
-          }
-          animator->Update(bufferIndex, progress, bake);
-        }
-        applied = true;
-      }
-      else
-      {
-        applied = false;
-      }
+  if( mAnimatorsChanged )
+  {
+    mAnimatorBatch.Build( mAnimators );
+    mAnimatorsChanged = false;
+  }
 
-      if ( animationFinished )
-      {
-        animator->SetActive( false );
-      }
+  //Loop through all animators
+  bool applied(true);
+  for ( auto&& animator : mAnimators )
+  {
+    if( animator->IsEnabled() )
+    {
+      const float intervalDelay( animator->GetIntervalDelay() );
 
-      if (applied)
+      // The batched animators are updated together afterwards
+      if( !animator->IsBatched() && elapsedSecondsClamped >= intervalDelay )
       {
-        INCREASE_COUNTER(PerformanceMonitor::ANIMATORS_APPLIED);
+        // Calculate a progress specific to each individual animator
+        float progress(1.0f);
+        const float animatorDuration = animator->GetDuration();
+        if (animatorDuration > 0.0f) // animators can be "immediate"
+        {
+          progress = Clamp((elapsedSecondsClamped - intervalDelay) / animatorDuration, 0.0f , 1.0f );
+        }
+        animator->Update(bufferIndex, progress, bake);
       }
+      applied = true;
+    }
+    else
+    {
+      applied = false;
+    }
 
-      ++iter;
+    if ( animationFinished )
+    {
+      animator->SetActive( false );
+    }
+
+    if (applied)
+    {
+      INCREASE_COUNTER(PerformanceMonitor::ANIMATORS_APPLIED);
     }
   }
 
+  mAnimatorBatch.Update( bufferIndex, elapsedSecondsClamped, bake );
 }
 
 } // namespace SceneGraph
@@ -22,9 +22,11 @@
 #include <dali/public-api/animation/animation.h>
 
 #include <dali/internal/common/buffer-index.h>
+#include <dali/internal/common/fixed-size-memory-pool.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/update/animation/scene-graph-animator.h>
+#include <dali/internal/update/animation/scene-graph-animator-batch.h>
 
 namespace Dali
 {
@@ -77,6 +79,18 @@ public:
    */
   void operator delete( void* ptr );
 
+  /**
+   * Releases the blocks of the global memory pool in which no animations are allocated.
+   * @return The number of blocks released
+   */
+  static uint32_t TrimMemoryPool();
+
+  /**
+   * Retrieves the usage of the memory of the global memory pool of animations.
+   * @return The statistics of the memory pool
+   */
+  static FixedSizeMemoryPool::Statistics GetMemoryPoolStatistics();
+
   /**
    * Set the duration of an animation.
    * @pre durationSeconds must be greater than zero.
@@ -328,6 +342,7 @@ private:
 protected:
 
   OwnerContainer< AnimatorBase* > mAnimators;
+  AnimatorBatch mAnimatorBatch;  ///< Updates the animators which can be batched
 
   Vector2 mPlayRange;
 
@@ -349,6 +364,7 @@ protected:
 
   bool mProgressReachedSignalRequired;  // Flag to indicate the progress marker was hit
   bool mAutoReverseEnabled;             // Flag to identify that the looping mode is auto reverse.
+  bool mAnimatorsChanged;               // Flag to indicate the animator batch has to be rebuilt
 };
 
 }; //namespace SceneGraph
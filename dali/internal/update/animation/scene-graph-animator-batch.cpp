@@ -0,0 +1,496 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/animation/scene-graph-animator-batch.h>
+
+// EXTERNAL INCLUDES
+#include <unordered_map>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/math/math-utils.h>
+#include <dali/internal/update/animation/scene-graph-animator.h>
+#include <dali/internal/update/manager/transform-manager.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+namespace
+{
+
+/**
+ * Compares the alpha functions of two animators.
+ * @param[in] lhs The first animator
+ * @param[in] rhs The second animator
+ * @return True if the alpha functions are evaluated the same way
+ */
+bool IsSameAlphaFunction( const AnimatorBase& lhs, const AnimatorBase& rhs )
+{
+  const AlphaFunction lhsFunction = lhs.GetAlphaFunction();
+  const AlphaFunction rhsFunction = rhs.GetAlphaFunction();
+  if( ( lhsFunction.GetMode() != rhsFunction.GetMode() ) ||
+      ( lhs.IsCustomAlphaFunctionSampled() != rhs.IsCustomAlphaFunctionSampled() ) )
+  {
+    return false;
+  }
+
+  switch( lhsFunction.GetMode() )
+  {
+    case AlphaFunction::BUILTIN_FUNCTION:
+    {
+      return lhsFunction.GetBuiltinFunction() == rhsFunction.GetBuiltinFunction();
+    }
+    case AlphaFunction::CUSTOM_FUNCTION:
+    {
+      return lhsFunction.GetCustomFunction() == rhsFunction.GetCustomFunction();
+    }
+    case AlphaFunction::BEZIER:
+    {
+      return lhsFunction.GetBezierControlPoints() == rhsFunction.GetBezierControlPoints();
+    }
+  }
+  return false;
+}
+
+/**
+ * Retrieves the value of an animator function which animates to or by a value.
+ * @param[in] function The animator function
+ * @param[out] value The target or relative value
+ * @param[out] relative Set to true if the function animates by the value
+ * @return True if the function animates to or by a value
+ */
+template< typename PropertyType, typename AnimateTo, typename AnimateBy >
+bool GetAnimatorValue( const AnimatorFunctionBase* function, PropertyType& value, bool& relative )
+{
+  const AnimateTo* animateTo = dynamic_cast< const AnimateTo* >( function );
+  if( animateTo )
+  {
+    value = animateTo->mTarget;
+    relative = false;
+    return true;
+  }
+
+  const AnimateBy* animateBy = dynamic_cast< const AnimateBy* >( function );
+  if( animateBy )
+  {
+    value = animateBy->mRelative;
+    relative = true;
+    return true;
+  }
+
+  return false;
+}
+
+} // unnamed namespace
+
+/**
+ * A group of batched animators with the same alpha function, which all animate either to or by a value.
+ */
+class AnimatorGroup
+{
+public:
+
+  /**
+   * Constructor.
+   * @param[in] relative Whether the animators animate by a value, rather than to a value
+   */
+  explicit AnimatorGroup( bool relative )
+  : mAnimators(),
+    mDelays(),
+    mDurations(),
+    mAlphas(),
+    mActive(),
+    mRelative( relative )
+  {
+  }
+
+  /**
+   * Virtual destructor.
+   */
+  virtual ~AnimatorGroup()
+  {
+  }
+
+  /**
+   * Query whether an animator can be added to the group.
+   * @param[in] animator The animator
+   * @param[in] relative Whether the animator animates by a value
+   * @return True if the animator evaluates the same way as the animators of the group
+   */
+  bool Accepts( const AnimatorBase& animator, bool relative ) const
+  {
+    return ( relative == mRelative ) && IsSameAlphaFunction( *mAnimators[0], animator );
+  }
+
+  /**
+   * Updates the animators of the group.
+   * @param[in] bufferIndex The buffer to animate
+   * @param[in] elapsedSeconds The elapsed time of the animation, clamped to its play range
+   * @param[in] bake Whether the new values are baked
+   */
+  void Update( BufferIndex bufferIndex, float elapsedSeconds, bool bake )
+  {
+    const uint32_t count = mAnimators.Count();
+
+    // Calculate a progress specific to each individual animator; animators can be "immediate"
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      mActive[i] = ( elapsedSeconds >= mDelays[i] );
+      mAlphas[i] = ( mDurations[i] > 0.0f ) ? Clamp( ( elapsedSeconds - mDelays[i] ) / mDurations[i], 0.0f, 1.0f ) : 1.0f;
+    }
+
+    const AlphaFunctionEvaluator& alphaFunction = mAnimators[0]->GetAlphaFunctionEvaluator();
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      AnimatorBase& animator = *mAnimators[i];
+      mActive[i] = mActive[i] && animator.IsEnabled();
+      if( mActive[i] )
+      {
+        mAlphas[i] = alphaFunction.Evaluate( animator.UpdateProgress( mAlphas[i] ) );
+      }
+    }
+
+    DoUpdate( bufferIndex, bake );
+  }
+
+protected:
+
+  /**
+   * Adds an animator to the group.
+   * @param[in] animator The animator
+   */
+  void AddAnimator( AnimatorBase& animator )
+  {
+    mAnimators.PushBack( &animator );
+    mDelays.PushBack( animator.GetIntervalDelay() );
+    mDurations.PushBack( animator.GetDuration() );
+    mAlphas.PushBack( 0.0f );
+    mActive.PushBack( false );
+  }
+
+  /**
+   * Applies the alphas of the active animators to their properties.
+   * @param[in] bufferIndex The buffer to animate
+   * @param[in] bake Whether the new values are baked
+   */
+  virtual void DoUpdate( BufferIndex bufferIndex, bool bake ) = 0;
+
+protected:
+
+  Dali::Vector< AnimatorBase* > mAnimators; ///< The animators, owned by the animation
+  Dali::Vector< float > mDelays;            ///< The interval delay of each animator
+  Dali::Vector< float > mDurations;         ///< The duration of each animator
+  Dali::Vector< float > mAlphas;            ///< The alpha of each animator in the current update
+  Dali::Vector< bool > mActive;             ///< Whether each animator is applied in the current update
+  bool mRelative;                           ///< Whether the animators animate by a value, rather than to a value
+};
+
+namespace
+{
+
+/**
+ * A group of animators of animatable properties of the same type.
+ */
+template< typename PropertyType >
+class AnimatablePropertyGroup : public AnimatorGroup
+{
+public:
+
+  /**
+   * @copydoc AnimatorGroup::AnimatorGroup()
+   */
+  explicit AnimatablePropertyGroup( bool relative )
+  : AnimatorGroup( relative ),
+    mProperties(),
+    mValues()
+  {
+  }
+
+  /**
+   * Adds an animator to the group.
+   * @param[in] animator The animator
+   * @param[in] property The animated property
+   * @param[in] value The target or relative value
+   */
+  void Add( AnimatorBase& animator, AnimatableProperty< PropertyType >* property, const PropertyType& value )
+  {
+    AddAnimator( animator );
+    mProperties.PushBack( property );
+    mValues.PushBack( value );
+  }
+
+private:
+
+  /**
+   * @copydoc AnimatorGroup::DoUpdate()
+   */
+  void DoUpdate( BufferIndex bufferIndex, bool bake ) override
+  {
+    const uint32_t count = mAnimators.Count();
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      if( mActive[i] )
+      {
+        const PropertyType& current = mProperties[i]->Get( bufferIndex );
+        const PropertyType result = mRelative ? PropertyType( current + mValues[i] * mAlphas[i] )
+                                              : PropertyType( current + ( ( mValues[i] - current ) * mAlphas[i] ) );
+        if( bake )
+        {
+          mProperties[i]->Bake( bufferIndex, result );
+        }
+        else
+        {
+          mProperties[i]->Set( bufferIndex, result );
+        }
+      }
+    }
+  }
+
+private:
+
+  Dali::Vector< AnimatableProperty< PropertyType >* > mProperties; ///< The animated properties
+  Dali::Vector< PropertyType > mValues;                           ///< The target or relative value of each animator
+};
+
+/**
+ * A group of animators of a Vector3 property of the transform manager, which are read and written together.
+ */
+class TransformPropertyGroup : public AnimatorGroup
+{
+public:
+
+  /**
+   * Constructor.
+   * @param[in] transformManager The transform manager
+   * @param[in] property The animated property of the transform components
+   * @param[in] relative Whether the animators animate by a value, rather than to a value
+   */
+  TransformPropertyGroup( TransformManager& transformManager, TransformManagerProperty property, bool relative )
+  : AnimatorGroup( relative ),
+    mTransformManager( transformManager ),
+    mProperty( property ),
+    mHandlers(),
+    mValues(),
+    mIds(),
+    mCurrentValues()
+  {
+  }
+
+  /**
+   * Query whether an animator of a transform manager property can be added to the group.
+   * @param[in] animator The animator
+   * @param[in] handler The animated property
+   * @param[in] relative Whether the animator animates by a value
+   * @return True if the animator evaluates the same way and animates the same property as the animators of the group
+   */
+  bool Accepts( const AnimatorBase& animator, const TransformManagerPropertyVector3& handler, bool relative ) const
+  {
+    return ( handler.mTxManager == &mTransformManager ) && ( handler.mProperty == mProperty ) && AnimatorGroup::Accepts( animator, relative );
+  }
+
+  /**
+   * Adds an animator to the group.
+   * @param[in] animator The animator
+   * @param[in] handler The animated property
+   * @param[in] value The target or relative value
+   */
+  void Add( AnimatorBase& animator, const TransformManagerPropertyVector3& handler, const Vector3& value )
+  {
+    AddAnimator( animator );
+    mHandlers.PushBack( &handler );
+    mValues.PushBack( value );
+    mIds.PushBack( INVALID_TRANSFORM_ID );
+    mCurrentValues.PushBack( Vector3::ZERO );
+  }
+
+private:
+
+  /**
+   * @copydoc AnimatorGroup::DoUpdate()
+   */
+  void DoUpdate( BufferIndex bufferIndex, bool bake ) override
+  {
+    // The transform manager skips the inactive animators
+    const uint32_t count = mAnimators.Count();
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      mIds[i] = mActive[i] ? mHandlers[i]->mId : INVALID_TRANSFORM_ID;
+    }
+
+    mTransformManager.GetVector3PropertyValues( mIds.Begin(), count, mProperty, mCurrentValues.Begin() );
+
+    if( mRelative )
+    {
+      for( uint32_t i = 0u; i < count; ++i )
+      {
+        mCurrentValues[i] = mCurrentValues[i] + mValues[i] * mAlphas[i];
+      }
+    }
+    else
+    {
+      for( uint32_t i = 0u; i < count; ++i )
+      {
+        mCurrentValues[i] = mCurrentValues[i] + ( ( mValues[i] - mCurrentValues[i] ) * mAlphas[i] );
+      }
+    }
+
+    if( bake )
+    {
+      mTransformManager.BakeVector3PropertyValues( mIds.Begin(), count, mProperty, mCurrentValues.Begin() );
+    }
+    else
+    {
+      mTransformManager.SetVector3PropertyValues( mIds.Begin(), count, mProperty, mCurrentValues.Begin() );
+    }
+  }
+
+private:
+
+  TransformManager& mTransformManager;                              ///< The transform manager
+  TransformManagerProperty mProperty;                               ///< The animated property of the transform components
+  Dali::Vector< const TransformManagerPropertyVector3* > mHandlers; ///< The animated properties
+  Dali::Vector< Vector3 > mValues;                                  ///< The target or relative value of each animator
+  Dali::Vector< TransformId > mIds;                                 ///< The transform components of the active animators in the current update
+  Dali::Vector< Vector3 > mCurrentValues;                           ///< The values of the properties in the current update
+};
+
+/**
+ * Adds an animator to a group of animators of animatable properties, if it moves the whole property to or by a value.
+ * @param[in] groups The groups
+ * @param[in] animator The animator
+ * @return True if the animator was added
+ */
+template< typename PropertyType, typename AnimateTo, typename AnimateBy >
+bool AddAnimatablePropertyAnimator( OwnerContainer< AnimatorGroup* >& groups, AnimatorBase& animator )
+{
+  const Animator< PropertyType, PropertyAccessor< PropertyType > >* typedAnimator = dynamic_cast< const Animator< PropertyType, PropertyAccessor< PropertyType > >* >( &animator );
+  PropertyType value;
+  bool relative( false );
+  if( !typedAnimator || !GetAnimatorValue< PropertyType, AnimateTo, AnimateBy >( animator.GetAnimatorFunction(), value, relative ) )
+  {
+    return false;
+  }
+
+  AnimatableProperty< PropertyType >* property = typedAnimator->GetPropertyAccessor().GetProperty();
+  for( auto&& group : groups )
+  {
+    AnimatablePropertyGroup< PropertyType >* typedGroup = dynamic_cast< AnimatablePropertyGroup< PropertyType >* >( group );
+    if( typedGroup && typedGroup->Accepts( animator, relative ) )
+    {
+      typedGroup->Add( animator, property, value );
+      return true;
+    }
+  }
+
+  AnimatablePropertyGroup< PropertyType >* group = new AnimatablePropertyGroup< PropertyType >( relative );
+  group->Add( animator, property, value );
+  groups.PushBack( group );
+  return true;
+}
+
+/**
+ * Adds an animator to a group of animators of transform manager properties, if it moves the whole property to or by a value.
+ * @param[in] groups The groups
+ * @param[in] animator The animator
+ * @return True if the animator was added
+ */
+bool AddTransformPropertyAnimator( OwnerContainer< AnimatorGroup* >& groups, AnimatorBase& animator )
+{
+  using TransformAnimator = AnimatorTransformProperty< Vector3, TransformManagerPropertyAccessor< Vector3 > >;
+  const TransformAnimator* typedAnimator = dynamic_cast< const TransformAnimator* >( &animator );
+  Vector3 value;
+  bool relative( false );
+  if( !typedAnimator || !GetAnimatorValue< Vector3, AnimateToVector3, AnimateByVector3 >( animator.GetAnimatorFunction(), value, relative ) )
+  {
+    return false;
+  }
+
+  const TransformManagerPropertyVector3* handler = dynamic_cast< const TransformManagerPropertyVector3* >( typedAnimator->GetPropertyAccessor().GetProperty() );
+  if( !handler || !handler->mTxManager )
+  {
+    return false;
+  }
+
+  for( auto&& group : groups )
+  {
+    TransformPropertyGroup* typedGroup = dynamic_cast< TransformPropertyGroup* >( group );
+    if( typedGroup && typedGroup->Accepts( animator, *handler, relative ) )
+    {
+      typedGroup->Add( animator, *handler, value );
+      return true;
+    }
+  }
+
+  TransformPropertyGroup* group = new TransformPropertyGroup( *handler->mTxManager, handler->mProperty, relative );
+  group->Add( animator, *handler, value );
+  groups.PushBack( group );
+  return true;
+}
+
+} // unnamed namespace
+
+AnimatorBatch::AnimatorBatch()
+: mGroups()
+{
+}
+
+AnimatorBatch::~AnimatorBatch()
+{
+}
+
+void AnimatorBatch::Build( AnimatorContainer& animators )
+{
+  mGroups.Clear();
+
+  // Count the animators of each property
+  std::unordered_map< const PropertyBase*, uint32_t > animatorCounts;
+  for( auto&& animator : animators )
+  {
+    ++animatorCounts[ animator->GetProperty() ];
+  }
+
+  for( auto&& animator : animators )
+  {
+    const bool batched = ( animatorCounts[ animator->GetProperty() ] == 1u ) &&
+                         ( AddAnimatablePropertyAnimator< float, AnimateToFloat, AnimateByFloat >( mGroups, *animator ) ||
+                           AddAnimatablePropertyAnimator< Vector2, AnimateToVector2, AnimateByVector2 >( mGroups, *animator ) ||
+                           AddAnimatablePropertyAnimator< Vector3, AnimateToVector3, AnimateByVector3 >( mGroups, *animator ) ||
+                           AddAnimatablePropertyAnimator< Vector4, AnimateToVector4, AnimateByVector4 >( mGroups, *animator ) ||
+                           AddTransformPropertyAnimator( mGroups, *animator ) );
+    animator->SetBatched( batched );
+  }
+}
+
+void AnimatorBatch::Update( BufferIndex bufferIndex, float elapsedSeconds, bool bake )
+{
+  for( auto&& group : mGroups )
+  {
+    group->Update( bufferIndex, elapsedSeconds, bake );
+  }
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
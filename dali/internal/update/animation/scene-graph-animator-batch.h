@@ -0,0 +1,96 @@
+#ifndef DALI_INTERNAL_SCENE_GRAPH_ANIMATOR_BATCH_H
+#define DALI_INTERNAL_SCENE_GRAPH_ANIMATOR_BATCH_H
+
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/common/owner-container.h>
+#include <dali/internal/common/buffer-index.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+class AnimatorBase;
+class AnimatorGroup;
+
+/**
+ * Updates the animators of an animation which move a whole property linearly to or by a value, in batches.
+ *
+ * The animators are grouped by the type of their property, whether they animate to or by a value, and their
+ * alpha function. Each group keeps the data of its animators in structure-of-arrays form, so the progress,
+ * the alpha and the new values of a whole group are worked out in tight loops over contiguous arrays, rather
+ * than through the virtual calls and property accessors of AnimatorBase::Update().
+ */
+class AnimatorBatch
+{
+public:
+
+  using AnimatorContainer = OwnerContainer< AnimatorBase* >;
+
+  /**
+   * Constructor.
+   */
+  AnimatorBatch();
+
+  /**
+   * Destructor.
+   */
+  ~AnimatorBatch();
+
+  /**
+   * Rebuilds the groups from the animators of an animation, and marks the animators which are batched.
+   * An animator is only batched if no other animator of the animation animates its property, so the
+   * order in which the animators of a property are applied is kept.
+   * @param[in] animators The animators of the animation.
+   */
+  void Build( AnimatorContainer& animators );
+
+  /**
+   * Updates the batched animators.
+   * @param[in] bufferIndex The buffer to animate.
+   * @param[in] elapsedSeconds The elapsed time of the animation, clamped to its play range.
+   * @param[in] bake Whether the new values are baked.
+   */
+  void Update( BufferIndex bufferIndex, float elapsedSeconds, bool bake );
+
+private:
+
+  // Undefined
+  AnimatorBatch( const AnimatorBatch& ) = delete;
+
+  // Undefined
+  AnimatorBatch& operator=( const AnimatorBatch& ) = delete;
+
+private:
+
+  OwnerContainer< AnimatorGroup* > mGroups; ///< The groups of batched animators
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SCENE_GRAPH_ANIMATOR_BATCH_H
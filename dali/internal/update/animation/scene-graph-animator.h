@@ -34,6 +34,7 @@
 #include <dali/internal/event/animation/path-impl.h>
 #include <dali/internal/update/nodes/node.h>
 #include <dali/internal/update/common/property-base.h>
+#include <dali/internal/update/animation/alpha-function-evaluator.h>
 #include <dali/internal/update/animation/property-accessor.h>
 #include <dali/integration-api/debug.h>
 
@@ -135,11 +136,13 @@ public:
    * Constructor.
    */
   AnimatorBase( PropertyOwner* propertyOwner,
+                PropertyBase* property,
                 AnimatorFunctionBase* animatorFunction,
                 AlphaFunction alphaFunction,
                 const TimePeriod& timePeriod )
   : mLifecycleObserver( nullptr ),
     mPropertyOwner( propertyOwner ),
+    mProperty( property ),
     mAnimatorFunction( animatorFunction ),
     mDurationSeconds( timePeriod.durationSeconds ),
     mIntervalDelaySeconds( timePeriod.delaySeconds ),
@@ -147,11 +150,14 @@ public:
     mCurrentProgress( 0.f ),
     mLoopCount( 1 ),
     mAlphaFunction( alphaFunction ),
+    mAlphaFunctionEvaluator( alphaFunction ),
     mDisconnectAction( Dali::Animation::BakeFinal ),
     mAnimationPlaying( false ),
     mEnabled( true ),
     mConnectedToSceneGraph( false ),
-    mAutoReverseEnabled( false )
+    mAutoReverseEnabled( false ),
+    mCustomAlphaFunctionSampled( false ),
+    mBatched( false )
   {
   }
 
@@ -224,6 +230,24 @@ public:
     mPropertyOwner->AddObserver(*this);
   }
 
+  /**
+   * Retrieve the animated property.
+   * @return The property; a component accessor may animate only a part of it.
+   */
+  const PropertyBase* GetProperty() const
+  {
+    return mProperty;
+  }
+
+  /**
+   * Retrieve the function used to animate the property.
+   * @return The animator function.
+   */
+  const AnimatorFunctionBase* GetAnimatorFunction() const
+  {
+    return mAnimatorFunction;
+  }
+
   /**
    * Set the duration of the animator.
    * @pre durationSeconds must be zero or greater; zero is useful when animating boolean values.
@@ -305,6 +329,7 @@ public:
   void SetAlphaFunction(const AlphaFunction& alphaFunction)
   {
     mAlphaFunction = alphaFunction;
+    mAlphaFunctionEvaluator.Set( mAlphaFunction, mCustomAlphaFunctionSampled );
   }
 
   /**
@@ -323,127 +348,35 @@ public:
    */
   float ApplyAlphaFunction( float progress ) const
   {
-    float result = progress;
+    return mAlphaFunctionEvaluator.Evaluate( progress );
+  }
 
-    AlphaFunction::Mode alphaFunctionMode( mAlphaFunction.GetMode() );
-    if( alphaFunctionMode == AlphaFunction::BUILTIN_FUNCTION )
-    {
-      switch(mAlphaFunction.GetBuiltinFunction())
-      {
-        case AlphaFunction::DEFAULT:
-        case AlphaFunction::LINEAR:
-        {
-          break;
-        }
-        case AlphaFunction::REVERSE:
-        {
-          result = 1.0f-progress;
-          break;
-        }
-        case AlphaFunction::EASE_IN_SQUARE:
-        {
-          result = progress * progress;
-          break;
-        }
-        case AlphaFunction::EASE_OUT_SQUARE:
-        {
-          result = 1.0f - (1.0f-progress) * (1.0f-progress);
-          break;
-        }
-        case AlphaFunction::EASE_IN:
-        {
-          result = progress * progress * progress;
-          break;
-        }
-        case AlphaFunction::EASE_OUT:
-        {
-          result = (progress-1.0f) * (progress-1.0f) * (progress-1.0f) + 1.0f;
-          break;
-        }
-        case AlphaFunction::EASE_IN_OUT:
-        {
-          result = progress*progress*(3.0f-2.0f*progress);
-          break;
-        }
-        case AlphaFunction::EASE_IN_SINE:
-        {
-          result = -1.0f * cosf(progress * Math::PI_2) + 1.0f;
-          break;
-        }
-        case AlphaFunction::EASE_OUT_SINE:
-        {
-          result = sinf(progress * Math::PI_2);
-          break;
-        }
-        case AlphaFunction::EASE_IN_OUT_SINE:
-        {
-          result = -0.5f * (cosf(Math::PI * progress) - 1.0f);
-          break;
-        }
-        case AlphaFunction::BOUNCE:
-        {
-          result = sinf(progress * Math::PI);
-          break;
-        }
-        case AlphaFunction::SIN:
-        {
-          result = 0.5f - cosf(progress * 2.0f * Math::PI) * 0.5f;
-          break;
-        }
-        case AlphaFunction::EASE_OUT_BACK:
-        {
-          const float sqrt2 = 1.70158f;
-          progress -= 1.0f;
-          result = 1.0f + progress * progress * ( ( sqrt2 + 1.0f ) * progress + sqrt2 );
-          break;
-        }
-        case AlphaFunction::COUNT:
-        {
-          break;
-        }
-      }
-    }
-    else if(  alphaFunctionMode == AlphaFunction::CUSTOM_FUNCTION )
-    {
-      AlphaFunctionPrototype customFunction = mAlphaFunction.GetCustomFunction();
-      if( customFunction )
-      {
-        result = customFunction(progress);
-      }
-    }
-    else
-    {
-      //If progress is very close to 0 or very close to 1 we don't need to evaluate the curve as the result will
-      //be almost 0 or almost 1 respectively
-      if( ( progress > Math::MACHINE_EPSILON_1 ) && ((1.0f - progress) > Math::MACHINE_EPSILON_1) )
-      {
-        Dali::Vector4 controlPoints = mAlphaFunction.GetBezierControlPoints();
-
-        static const float tolerance = 0.001f;  //10 iteration max
-
-        //Perform a binary search on the curve
-        float lowerBound(0.0f);
-        float upperBound(1.0f);
-        float currentT(0.5f);
-        float currentX = EvaluateCubicBezier( controlPoints.x, controlPoints.z, currentT);
-        while( fabsf( progress - currentX ) > tolerance )
-        {
-          if( progress > currentX )
-          {
-            lowerBound = currentT;
-          }
-          else
-          {
-            upperBound = currentT;
-          }
-          currentT = (upperBound+lowerBound)*0.5f;
-          currentX = EvaluateCubicBezier( controlPoints.x, controlPoints.z, currentT);
-        }
-        result = EvaluateCubicBezier( controlPoints.y, controlPoints.w, currentT);
-      }
-    }
+  /**
+   * Retrieve the evaluator of the alpha function.
+   * @return The evaluator.
+   */
+  const AlphaFunctionEvaluator& GetAlphaFunctionEvaluator() const
+  {
+    return mAlphaFunctionEvaluator;
+  }
 
-    return result;
+  /**
+   * Query whether a custom alpha function is sampled into a table.
+   * @return True if the custom alpha function is sampled.
+   */
+  bool IsCustomAlphaFunctionSampled() const
+  {
+    return mCustomAlphaFunctionSampled;
+  }
+
+  /**
+   * Set whether a custom alpha function is sampled into a table, rather than called on every update.
+   * @param[in] sampled True if the custom alpha function is sampled.
+   */
+  void SetCustomAlphaFunctionSampled( bool sampled )
+  {
+    mCustomAlphaFunctionSampled = sampled;
+    mAlphaFunctionEvaluator.Set( mAlphaFunction, mCustomAlphaFunctionSampled );
   }
 
   /**
@@ -506,12 +439,29 @@ public:
   }
 
   /**
-   * Update the scene object attached to the animator.
-   * @param[in] bufferIndex The buffer to animate.
+   * Set whether the animator is updated by the AnimatorBatch of its animation, rather than by Update().
+   * @param[in] batched True if the animator is batched.
+   */
+  void SetBatched( bool batched )
+  {
+    mBatched = batched;
+  }
+
+  /**
+   * Query whether the animator is updated by the AnimatorBatch of its animation.
+   * @return True if the animator is batched.
+   */
+  bool IsBatched() const
+  {
+    return mBatched;
+  }
+
+  /**
+   * Update the progress of the animator for its looping mode, without updating the scene object.
    * @param[in] progress A value from 0 to 1, where 0 is the start of the animation, and 1 is the end point.
-   * @param[in] bake Bake.
+   * @return The progress to apply the alpha function to.
    */
-  void Update( BufferIndex bufferIndex, float progress, bool bake )
+  float UpdateProgress( float progress )
   {
     if( mLoopCount >= 0 )
     {
@@ -519,12 +469,24 @@ public:
       progress = SetProgress( progress );
     }
 
+    mCurrentProgress = progress;
+    return progress;
+  }
+
+  /**
+   * Update the scene object attached to the animator.
+   * @param[in] bufferIndex The buffer to animate.
+   * @param[in] progress A value from 0 to 1, where 0 is the start of the animation, and 1 is the end point.
+   * @param[in] bake Bake.
+   */
+  void Update( BufferIndex bufferIndex, float progress, bool bake )
+  {
+    progress = UpdateProgress( progress );
+
     float alpha = ApplyAlphaFunction( progress );
 
     // PropertyType specific part
     DoUpdate( bufferIndex, bake, alpha );
-
-    mCurrentProgress = progress;
   }
 
   /**
@@ -537,21 +499,9 @@ public:
 
 protected:
 
-  /**
-   * Helper function to evaluate a cubic bezier curve assuming first point is at 0.0 and last point is at 1.0
-   * @param[in] p0 First control point of the bezier curve
-   * @param[in] p1 Second control point of the bezier curve
-   * @param[in] t A floating point value between 0.0 and 1.0
-   * @return Value of the curve at progress t
-   */
-  inline float EvaluateCubicBezier( float p0, float p1, float t ) const
-  {
-    float tSquare = t*t;
-    return 3.0f*(1.0f-t)*(1.0f-t)*t*p0 + 3.0f*(1.0f-t)*tSquare*p1 + tSquare*t;
-  }
-
   LifecycleObserver* mLifecycleObserver;
   PropertyOwner* mPropertyOwner;
+  PropertyBase* mProperty;
   AnimatorFunctionBase* mAnimatorFunction;
   float mDurationSeconds;
   float mIntervalDelaySeconds;
@@ -561,12 +511,15 @@ protected:
   int32_t mLoopCount;
 
   AlphaFunction mAlphaFunction;
+  AlphaFunctionEvaluator mAlphaFunctionEvaluator;   ///< Evaluates mAlphaFunction, with everything independent of the progress worked out once.
 
   Dali::Animation::EndAction mDisconnectAction;     ///< EndAction to apply when target object gets disconnected from the stage.
   bool mAnimationPlaying:1;                         ///< whether disconnect has been applied while it's running.
   bool mEnabled:1;                                  ///< Animator is "enabled" while its target object is valid and on the stage.
   bool mConnectedToSceneGraph:1;                    ///< True if ConnectToSceneGraph() has been called in update-thread.
   bool mAutoReverseEnabled:1;
+  bool mCustomAlphaFunctionSampled:1;               ///< True if a custom alpha function is sampled into a table.
+  bool mBatched:1;                                  ///< True if the animator is updated by the AnimatorBatch of its animation.
 };
 
 /**
@@ -606,6 +559,15 @@ public:
   {
   }
 
+  /**
+   * Retrieve the accessor of the animated property.
+   * @return The property accessor.
+   */
+  const PropertyAccessorType& GetPropertyAccessor() const
+  {
+    return mPropertyAccessor;
+  }
+
   /**
    * @copydoc AnimatorBase::DoUpdate( BufferIndex bufferIndex, bool bake, float alpha )
    */
@@ -636,7 +598,7 @@ private:
             AnimatorFunctionBase* animatorFunction,
             AlphaFunction alphaFunction,
             const TimePeriod& timePeriod )
-  : AnimatorBase( propertyOwner, animatorFunction, alphaFunction, timePeriod ),
+  : AnimatorBase( propertyOwner, property, animatorFunction, alphaFunction, timePeriod ),
     mPropertyAccessor( property )
   {
     // WARNING - this object is created in the event-thread
@@ -695,6 +657,15 @@ public:
   {
   }
 
+  /**
+   * Retrieve the accessor of the animated property.
+   * @return The property accessor.
+   */
+  const PropertyAccessorType& GetPropertyAccessor() const
+  {
+    return mPropertyAccessor;
+  }
+
   /**
    * @copydoc AnimatorBase::DoUpdate( BufferIndex bufferIndex, bool bake, float alpha )
    */
@@ -725,7 +696,7 @@ private:
             AnimatorFunctionBase* animatorFunction,
             AlphaFunction alphaFunction,
             const TimePeriod& timePeriod )
-  : AnimatorBase( propertyOwner, animatorFunction, alphaFunction, timePeriod ),
+  : AnimatorBase( propertyOwner, property, animatorFunction, alphaFunction, timePeriod ),
     mPropertyAccessor( property )
   {
     // WARNING - this object is created in the event-thread
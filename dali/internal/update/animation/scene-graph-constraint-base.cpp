@@ -36,6 +36,7 @@ ConstraintBase::ConstraintBase( PropertyOwnerContainer& ownerSet, RemoveAction r
 : mRemoveAction( removeAction ),
   mFirstApply( true ),
   mDisconnected( true ),
+  mEvaluateEveryFrame( false ),
   mObservedOwners( ownerSet ),
   mLifecycleObserver( nullptr )
 {
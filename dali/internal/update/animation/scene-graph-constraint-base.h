@@ -128,6 +128,23 @@ public:
     return mRemoveAction;
   }
 
+  /**
+   * @copydoc Dali::DevelConstraint::SetEvaluateEveryFrame()
+   */
+  void SetEvaluateEveryFrame( bool evaluateEveryFrame )
+  {
+    mEvaluateEveryFrame = evaluateEveryFrame;
+  }
+
+  /**
+   * Retrieve the property owners observed by the constraint; the owner of the target and the owners of the inputs.
+   * @return The property owners, or an empty container if the constraint is disconnected.
+   */
+  const PropertyOwnerContainer& GetObservedOwners() const
+  {
+    return mObservedOwners;
+  }
+
   /**
    * Constrain the associated scene object.
    * @param[in] updateBufferIndex The current update buffer index.
@@ -233,8 +250,9 @@ protected:
 
   RemoveAction mRemoveAction;
 
-  bool mFirstApply   : 1;
-  bool mDisconnected : 1;
+  bool mFirstApply         : 1;
+  bool mDisconnected       : 1;
+  bool mEvaluateEveryFrame : 1; ///< Whether the constraint function is called even if its inputs didn't change
 
 private:
 
@@ -249,6 +267,17 @@ private:
 
 // Messages for ConstraintBase
 
+inline void SetEvaluateEveryFrameMessage( EventThreadServices& eventThreadServices, const ConstraintBase& constraint, bool evaluateEveryFrame )
+{
+  typedef MessageValue1< ConstraintBase, bool > LocalType;
+
+  // Reserve some memory inside the message queue
+  uint32_t* slot = eventThreadServices.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &constraint, &ConstraintBase::SetEvaluateEveryFrame, evaluateEveryFrame );
+}
+
 inline void  SetRemoveActionMessage( EventThreadServices& eventThreadServices, const ConstraintBase& constraint, Dali::Constraint::RemoveAction removeAction )
 {
   typedef MessageValue1< ConstraintBase, Dali::Constraint::RemoveAction > LocalType;
@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <cstring>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/signals/callback.h>
@@ -86,19 +89,30 @@ public:
       if ( mFunc->InputsInitialized() )
       {
         PropertyType current = mTargetProperty.Get( updateBufferIndex );
-        mFunc->Apply( updateBufferIndex, current );
 
-        // Optionally bake the final value
-        if ( Dali::Constraint::Bake == mRemoveAction )
+        // The function returns the same value again if neither its inputs nor the current value changed
+        const bool inputsChanged = mFunc->InputVersionsChanged( updateBufferIndex );
+        if ( mFirstApply || mEvaluateEveryFrame || inputsChanged || !IsSameValue( current, mInputValue ) )
         {
-          mTargetProperty.Bake( updateBufferIndex, current );
+          mInputValue = current;
+          mFunc->Apply( updateBufferIndex, current );
+          mConstrainedValue = current;
+          mFirstApply = false;
+
+          SetTargetValue( updateBufferIndex, current );
+
+          INCREASE_COUNTER(PerformanceMonitor::CONSTRAINTS_APPLIED);
         }
         else
         {
-          mTargetProperty.Set( updateBufferIndex, current );
-        }
+          // Only write the previous result if something else changed the property since
+          if ( !IsSameValue( current, mConstrainedValue ) )
+          {
+            SetTargetValue( updateBufferIndex, mConstrainedValue );
+          }
 
-        INCREASE_COUNTER(PerformanceMonitor::CONSTRAINTS_APPLIED);
+          INCREASE_COUNTER(PerformanceMonitor::CONSTRAINTS_SKIPPED);
+        }
       }
       else
       {
@@ -109,6 +123,35 @@ public:
 
 private:
 
+  /**
+   * Query whether two values are bitwise identical.
+   * @param[in] lhs The first value
+   * @param[in] rhs The second value
+   * @return True if the values are identical.
+   */
+  static bool IsSameValue( const PropertyType& lhs, const PropertyType& rhs )
+  {
+    return 0 == std::memcmp( &lhs, &rhs, sizeof( PropertyType ) );
+  }
+
+  /**
+   * Set or bake the constrained value, according to the remove action.
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] value The constrained value.
+   */
+  void SetTargetValue( BufferIndex updateBufferIndex, const PropertyType& value )
+  {
+    // Optionally bake the final value
+    if ( Dali::Constraint::Bake == mRemoveAction )
+    {
+      mTargetProperty.Bake( updateBufferIndex, value );
+    }
+    else
+    {
+      mTargetProperty.Set( updateBufferIndex, value );
+    }
+  }
+
   /**
    * @copydoc Dali::Internal::SceneGraph::Constraint::New()
    */
@@ -118,7 +161,9 @@ private:
               RemoveAction removeAction )
   : ConstraintBase( ownerContainer, removeAction ),
     mTargetProperty( &targetProperty ),
-    mFunc( func )
+    mFunc( func ),
+    mInputValue(),
+    mConstrainedValue()
   {
   }
 
@@ -143,6 +188,9 @@ protected:
 
   ConstraintFunctionPtr mFunc;
 
+  PropertyType mInputValue;       ///< The value of the target property passed to the function when it was last called
+  PropertyType mConstrainedValue; ///< The value returned by the function when it was last called
+
 };
 
 } // namespace SceneGraph
@@ -71,8 +71,12 @@ public:
    */
   AnimatablePropertyBase()
   : PropertyBase(),
-    mDirtyFlags( BAKED_FLAG )
-  {}
+    mDirtyFlags( BAKED_FLAG ),
+    mBaseVersion( 1u ),
+    mLastVersion( 1u )
+  {
+    mVersion[0] = mVersion[1] = mBaseVersion;
+  }
 
   /**
    * Virtual destructor.
@@ -84,18 +88,44 @@ protected: // for derived classes
 
   /**
    * Flag that the property has been Set during the current frame.
+   * @param[in] bufferIndex The buffer which was written.
    */
-  void OnSet()
+  void OnSet( BufferIndex bufferIndex )
   {
     mDirtyFlags = SET_FLAG;
+    mVersion[bufferIndex] = NextVersion();
   }
 
   /**
    * Flag that the property has been Baked during the current frame.
+   * The other buffer only takes the version of the base value when it is next reset, so that the version
+   * read by the render thread never changes while it renders.
+   * @param[in] bufferIndex The buffer which was written.
    */
-  void OnBake()
+  void OnBake( BufferIndex bufferIndex )
   {
     mDirtyFlags = BAKED_FLAG;
+    mBaseVersion = NextVersion();
+    mVersion[bufferIndex] = mBaseVersion;
+  }
+
+  /**
+   * Flag that the value has been reset to the base value during the current frame.
+   * @param[in] bufferIndex The buffer which was reset.
+   */
+  void OnReset( BufferIndex bufferIndex )
+  {
+    mDirtyFlags = ( mDirtyFlags >> 1 );
+    mVersion[bufferIndex] = mBaseVersion;
+  }
+
+  /**
+   * Flag that both buffers and the base value have been set, before the property is used by the scene-graph.
+   */
+  void OnSetInitial()
+  {
+    mBaseVersion = NextVersion();
+    mVersion[0] = mVersion[1] = mBaseVersion;
   }
 
 public: // From PropertyBase
@@ -116,10 +146,39 @@ public: // From PropertyBase
     return true; // Animatable properties are always valid
   }
 
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::GetVersion()
+   */
+  virtual uint32_t GetVersion( BufferIndex bufferIndex ) const
+  {
+    return mVersion[bufferIndex];
+  }
+
+private:
+
+  /**
+   * Creates a new version for a value, skipping zero which means the value is not tracked.
+   * @return The new version.
+   */
+  uint32_t NextVersion()
+  {
+    if( ++mLastVersion == 0u )
+    {
+      mLastVersion = 1u;
+    }
+    return mLastVersion;
+  }
+
 protected: // so that ResetToBaseValue can set it directly
 
   uint32_t mDirtyFlags; ///< Flag whether value changed during previous 2 frames
 
+private:
+
+  uint32_t mVersion[2];  ///< The version of the value in each buffer; buffers with the same version hold the same value
+  uint32_t mBaseVersion; ///< The version of the base value, which a buffer takes when it is baked or reset
+  uint32_t mLastVersion; ///< The last version created for a value of the property
+
 };
 
 
@@ -165,7 +224,7 @@ public:
     {
       mValue[updateBufferIndex] = mBaseValue;
 
-      mDirtyFlags = ( mDirtyFlags >> 1 );
+      OnReset( updateBufferIndex );
     }
   }
 
@@ -190,7 +249,7 @@ public:
     {
       mValue[bufferIndex] = value;
 
-      OnSet();
+      OnSet( bufferIndex );
     }
   }
 
@@ -207,7 +266,7 @@ public:
     {
       mValue[bufferIndex] += delta;
 
-      OnSet();
+      OnSet( bufferIndex );
     }
   }
 
@@ -263,7 +322,7 @@ public:
       mValue[bufferIndex] = value;
       mValue[1-bufferIndex] = value;
 
-      OnBake();
+      OnBake( bufferIndex );
     }
   }
 
@@ -277,7 +336,7 @@ public:
     mValue[bufferIndex] += delta;
     mBaseValue = mValue[bufferIndex];
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
 private:
@@ -338,7 +397,7 @@ public:
     {
       mValue[updateBufferIndex] = mBaseValue;
 
-      mDirtyFlags = ( mDirtyFlags >> 1 );
+      OnReset( updateBufferIndex );
     }
   }
 
@@ -360,7 +419,7 @@ public:
   {
     mValue[bufferIndex] = value;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -372,7 +431,7 @@ public:
   {
     mValue[bufferIndex] = mValue[bufferIndex] + delta;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -422,7 +481,7 @@ public:
     mValue[1-bufferIndex] = value;
     mBaseValue = mValue[bufferIndex];
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -435,7 +494,7 @@ public:
     mValue[bufferIndex] = mValue[bufferIndex] + delta;
     mBaseValue = mValue[bufferIndex];
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -448,6 +507,8 @@ public:
     mValue[0]  = value;
     mValue[1]  = mValue[0];
     mBaseValue = mValue[0];
+
+    OnSetInitial();
   }
 
   /**
@@ -460,6 +521,8 @@ public:
     mValue[0] = mValue[0] + delta;
     mValue[1] = mValue[0];
     mBaseValue = mValue[0];
+
+    OnSetInitial();
   }
 
 private:
@@ -519,7 +582,7 @@ public:
     {
       mValue[updateBufferIndex] = mBaseValue;
 
-      mDirtyFlags = ( mDirtyFlags >> 1 );
+      OnReset( updateBufferIndex );
     }
   }
 
@@ -541,7 +604,7 @@ public:
   {
     mValue[bufferIndex] = value;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -553,7 +616,7 @@ public:
   {
     mValue[bufferIndex] = mValue[bufferIndex] + delta;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -605,7 +668,7 @@ public:
     mValue[1-bufferIndex] = value;
     mBaseValue = mValue[bufferIndex];
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -618,7 +681,7 @@ public:
     mValue[bufferIndex] = mValue[bufferIndex] + delta;
     mBaseValue = mValue[bufferIndex];
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -631,6 +694,8 @@ public:
     mValue[0]  = value;
     mValue[1]  = mValue[0];
     mBaseValue = mValue[0];
+
+    OnSetInitial();
   }
 
   /**
@@ -643,6 +708,8 @@ public:
     mValue[0] = mValue[0] + delta;
     mValue[1] = mValue[0];
     mBaseValue = mValue[0];
+
+    OnSetInitial();
   }
 
 private:
@@ -701,7 +768,7 @@ public:
     {
       mValue[updateBufferIndex] = mBaseValue;
 
-      mDirtyFlags = ( mDirtyFlags >> 1 );
+      OnReset( updateBufferIndex );
     }
   }
 
@@ -723,7 +790,7 @@ public:
   {
     mValue[bufferIndex] = value;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -736,7 +803,7 @@ public:
   {
     mValue[bufferIndex].x = value;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -749,7 +816,7 @@ public:
   {
     mValue[bufferIndex].y = value;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -761,7 +828,7 @@ public:
   {
     mValue[bufferIndex] += delta;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -773,7 +840,7 @@ public:
   {
     mValue[bufferIndex].x += delta;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -785,7 +852,7 @@ public:
   {
     mValue[bufferIndex].y += delta;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -837,7 +904,7 @@ public:
     mValue[1-bufferIndex] = value;
     mBaseValue = value;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -851,7 +918,7 @@ public:
     mValue[1-bufferIndex].x = value;
     mBaseValue.x = value;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -865,7 +932,7 @@ public:
     mValue[1-bufferIndex].y = value;
     mBaseValue.y = value;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -878,7 +945,7 @@ public:
     mValue[bufferIndex] += delta;
     mBaseValue = mValue[bufferIndex];
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -891,7 +958,7 @@ public:
     mValue[bufferIndex].x += delta;
     mBaseValue.x = mValue[bufferIndex].x;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -904,7 +971,7 @@ public:
     mValue[bufferIndex].y += delta;
     mBaseValue.y = mValue[bufferIndex].y;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
 private:
@@ -973,7 +1040,7 @@ public:
     {
       mValue[updateBufferIndex] = mBaseValue;
 
-      mDirtyFlags = ( mDirtyFlags >> 1 );
+      OnReset( updateBufferIndex );
     }
   }
 
@@ -995,7 +1062,7 @@ public:
   {
     mValue[bufferIndex] = value;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1008,7 +1075,7 @@ public:
   {
     mValue[bufferIndex].x = value;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1021,7 +1088,7 @@ public:
   {
     mValue[bufferIndex].y = value;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1034,7 +1101,7 @@ public:
   {
     mValue[bufferIndex].z = value;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1046,7 +1113,7 @@ public:
   {
     mValue[bufferIndex] += delta;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1058,7 +1125,7 @@ public:
   {
     mValue[bufferIndex].x += delta;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1070,7 +1137,7 @@ public:
   {
     mValue[bufferIndex].y += delta;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1082,7 +1149,7 @@ public:
   {
     mValue[bufferIndex].z += delta;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1132,7 +1199,7 @@ public:
     mValue[1-bufferIndex] = value;
     mBaseValue = value;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1146,7 +1213,7 @@ public:
     mValue[1-bufferIndex].x = value;
     mBaseValue.x = value;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1160,7 +1227,7 @@ public:
     mValue[1-bufferIndex].y = value;
     mBaseValue.y = value;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1174,7 +1241,7 @@ public:
     mValue[1-bufferIndex].z = value;
     mBaseValue.z = value;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1187,7 +1254,7 @@ public:
     mValue[bufferIndex] += delta;
     mBaseValue = mValue[bufferIndex];
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1200,7 +1267,7 @@ public:
     mValue[bufferIndex] *= delta;
     mBaseValue = mValue[bufferIndex];
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1213,7 +1280,7 @@ public:
     mValue[bufferIndex].x += delta;
     mBaseValue.x = mValue[bufferIndex].x;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1226,7 +1293,7 @@ public:
     mValue[bufferIndex].y += delta;
     mBaseValue.y = mValue[bufferIndex].y;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1239,7 +1306,7 @@ public:
     mValue[bufferIndex].z += delta;
     mBaseValue.z = mValue[bufferIndex].z;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
 private:
@@ -1299,7 +1366,7 @@ public:
     {
       mValue[updateBufferIndex] = mBaseValue;
 
-      mDirtyFlags = ( mDirtyFlags >> 1 );
+      OnReset( updateBufferIndex );
     }
   }
 
@@ -1321,7 +1388,7 @@ public:
   {
     mValue[bufferIndex] = value;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1334,7 +1401,7 @@ public:
   {
     mValue[bufferIndex].x = value;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1347,7 +1414,7 @@ public:
   {
     mValue[bufferIndex].y = value;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1360,7 +1427,7 @@ public:
   {
     mValue[bufferIndex].z = value;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1373,7 +1440,7 @@ public:
   {
     mValue[bufferIndex].w = value;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1385,7 +1452,7 @@ public:
   {
     mValue[bufferIndex] = mValue[bufferIndex] + delta;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1397,7 +1464,7 @@ public:
   {
     mValue[bufferIndex].x = mValue[bufferIndex].x + delta;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1409,7 +1476,7 @@ public:
   {
     mValue[bufferIndex].y = mValue[bufferIndex].y + delta;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1421,7 +1488,7 @@ public:
   {
     mValue[bufferIndex].z = mValue[bufferIndex].z + delta;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1433,7 +1500,7 @@ public:
   {
     mValue[bufferIndex].w = mValue[bufferIndex].w + delta;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1483,7 +1550,7 @@ public:
     mValue[1-bufferIndex] = value;
     mBaseValue = mValue[bufferIndex];
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1497,7 +1564,7 @@ public:
     mValue[1-bufferIndex].x = value;
     mBaseValue.x = mValue[bufferIndex].x;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1511,7 +1578,7 @@ public:
     mValue[1-bufferIndex].y = value;
     mBaseValue.y = mValue[bufferIndex].y;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1525,7 +1592,7 @@ public:
     mValue[1-bufferIndex].z = value;
     mBaseValue.z = mValue[bufferIndex].z;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1539,7 +1606,7 @@ public:
     mValue[1-bufferIndex].w = value;
     mBaseValue.w = mValue[bufferIndex].w;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1552,7 +1619,7 @@ public:
     mValue[bufferIndex] = mValue[bufferIndex] + delta;
     mBaseValue = mValue[bufferIndex];
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1565,7 +1632,7 @@ public:
     mValue[bufferIndex].x = mValue[bufferIndex].x + delta;
     mBaseValue.x = mValue[bufferIndex].x;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1578,7 +1645,7 @@ public:
     mValue[bufferIndex].y = mValue[bufferIndex].y + delta;
     mBaseValue.y = mValue[bufferIndex].y;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1591,7 +1658,7 @@ public:
     mValue[bufferIndex].z = mValue[bufferIndex].z + delta;
     mBaseValue.z = mValue[bufferIndex].z;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1604,7 +1671,7 @@ public:
     mValue[bufferIndex].w = mValue[bufferIndex].w + delta;
     mBaseValue.w = mValue[bufferIndex].w;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1617,6 +1684,8 @@ public:
     mValue[0].w  = value;
     mValue[1].w  = mValue[0].w;
     mBaseValue.w = mValue[0].w;
+
+    OnSetInitial();
   }
 
 private:
@@ -1684,7 +1753,7 @@ public:
     {
       mValue[updateBufferIndex] = mBaseValue;
 
-      mDirtyFlags = ( mDirtyFlags >> 1 );
+      OnReset( updateBufferIndex );
     }
   }
 
@@ -1706,7 +1775,7 @@ public:
   {
     mValue[bufferIndex] = value;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1718,7 +1787,7 @@ public:
   {
     mValue[bufferIndex] *= delta;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1770,7 +1839,7 @@ public:
     mValue[1-bufferIndex] = value;
     mBaseValue = value;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1783,7 +1852,7 @@ public:
     mValue[bufferIndex] *= delta;
     mBaseValue = mValue[bufferIndex];
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
 private:
@@ -1843,7 +1912,7 @@ public:
     {
       mValue[updateBufferIndex] = mBaseValue;
 
-      mDirtyFlags = ( mDirtyFlags >> 1 );
+      OnReset( updateBufferIndex );
     }
   }
 
@@ -1864,7 +1933,7 @@ public:
   void Set(BufferIndex bufferIndex, const Matrix& value)
   {
     mValue[bufferIndex] = value;
-    OnSet();
+    OnSet( bufferIndex );
   }
 
 
@@ -1879,7 +1948,7 @@ public:
     Matrix::Multiply(temp, mValue[bufferIndex], delta);
     mValue[bufferIndex] = temp;
 
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -1931,7 +2000,7 @@ public:
     mValue[1-bufferIndex] = value;
     mBaseValue = mValue[bufferIndex];
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -1946,7 +2015,7 @@ public:
     mValue[bufferIndex] = temp;
     mBaseValue = temp;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
 private:
@@ -2006,7 +2075,7 @@ public:
     {
       mValue[updateBufferIndex] = mBaseValue;
 
-      mDirtyFlags = ( mDirtyFlags >> 1 );
+      OnReset( updateBufferIndex );
     }
   }
 
@@ -2027,7 +2096,7 @@ public:
   void Set(BufferIndex bufferIndex, const Matrix3& value)
   {
     mValue[bufferIndex] = value;
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -2040,7 +2109,7 @@ public:
     Matrix3 temp;
     Matrix3::Multiply(temp, mValue[bufferIndex], delta);
     mValue[bufferIndex] = temp;
-    OnSet();
+    OnSet( bufferIndex );
   }
 
   /**
@@ -2092,7 +2161,7 @@ public:
     mValue[1-bufferIndex] = value;
     mBaseValue = mValue[bufferIndex];
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
   /**
@@ -2107,7 +2176,7 @@ public:
     mValue[bufferIndex] = temp;
     mBaseValue = temp;
 
-    OnBake();
+    OnBake( bufferIndex );
   }
 
 private:
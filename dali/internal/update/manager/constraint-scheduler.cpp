@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/manager/constraint-scheduler.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <atomic>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/threading/thread-pool.h>
+#include <dali/internal/update/animation/scene-graph-constraint-base.h>
+#include <dali/internal/update/manager/update-algorithms.h>
+#include <dali/internal/update/nodes/flattened-node-tree.h>
+#include <dali/internal/update/nodes/node.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+namespace
+{
+
+// The groups of constraints are only applied by the worker threads when there are at least this many constrained nodes
+const uint32_t MINIMUM_NODES_PER_PARALLEL_APPLY = 32u;
+
+// Used while ordering the nodes
+const uint8_t UNVISITED = 0u;
+const uint8_t VISITING  = 1u;
+const uint8_t VISITED   = 2u;
+
+const uint32_t INVALID_GROUP = 0xFFFFFFFF;
+
+} // unnamed namespace
+
+ConstraintScheduler::ConstraintScheduler()
+: mOwners(),
+  mDependencies(),
+  mScheduledDependencies(),
+  mSchedule(),
+  mGroupBegin(),
+  mGroupParents(),
+  mOwnerIndices(),
+  mThreadPool( nullptr )
+{
+}
+
+ConstraintScheduler::~ConstraintScheduler()
+{
+}
+
+void ConstraintScheduler::SetThreadPool( Dali::ThreadPool* threadPool )
+{
+  mThreadPool = threadPool;
+}
+
+void ConstraintScheduler::AddNodes( const FlattenedNodeTree& nodeTree, BufferIndex updateBufferIndex )
+{
+  if( nodeTree.Count() == 0u || !nodeTree[0].node || !nodeTree[0].node->IsVisible( updateBufferIndex ) )
+  {
+    return;
+  }
+
+  for( uint32_t i = 1u; i < nodeTree.Count(); )
+  {
+    Node* node = nodeTree[i].node;
+    if( !node || ( !node->IsVisible( updateBufferIndex ) && node->GetConstraints().Empty() ) )
+    {
+      // Skip the nodes disconnected since the tree was built, and the subtrees which aren't updated
+      i += nodeTree[i].subtreeSize;
+      continue;
+    }
+    ++i;
+
+    if( !node->GetConstraints().Empty() )
+    {
+      mOwners.PushBack( node );
+
+      mDependencies.PushBack( node );
+      for( auto&& constraint : node->GetConstraints() )
+      {
+        mDependencies.PushBack( constraint );
+        for( auto&& owner : constraint->GetObservedOwners() )
+        {
+          mDependencies.PushBack( owner );
+        }
+      }
+      mDependencies.PushBack( nullptr );
+    }
+  }
+}
+
+void ConstraintScheduler::Apply( BufferIndex updateBufferIndex )
+{
+  // The order is only recalculated when the constraints or their inputs changed
+  if( mDependencies.Count() != mScheduledDependencies.Count() ||
+      !std::equal( mDependencies.Begin(), mDependencies.End(), mScheduledDependencies.Begin() ) )
+  {
+    Schedule();
+    mScheduledDependencies.Swap( mDependencies );
+  }
+  mDependencies.Clear();
+  mOwners.Clear();
+
+  // The threads take the next group which is not constrained yet, as the groups can have very different sizes
+  std::atomic< uint32_t > nextGroup( 0u );
+  const uint32_t groupCount = mGroupBegin.Empty() ? 0u : mGroupBegin.Count() - 1u;
+  auto applyGroups = [&]( uint32_t /*workerIndex*/ )
+  {
+    for( uint32_t group = nextGroup++; group < groupCount; group = nextGroup++ )
+    {
+      for( uint32_t i = mGroupBegin[group]; i < mGroupBegin[group + 1u]; ++i )
+      {
+        ConstrainPropertyOwner( *mSchedule[i], updateBufferIndex );
+      }
+    }
+  };
+
+  // The calling thread applies constraints as well
+  uint32_t taskCount = 0u;
+  if( mThreadPool && groupCount > 1u && mSchedule.Count() >= MINIMUM_NODES_PER_PARALLEL_APPLY )
+  {
+    taskCount = std::min( static_cast<uint32_t>( mThreadPool->GetWorkerCount() ), groupCount - 1u );
+  }
+
+  if( taskCount > 0u )
+  {
+    std::vector< Task > tasks( taskCount, applyGroups );
+    UniqueFutureGroup futures = mThreadPool->SubmitTasks( tasks, taskCount );
+    applyGroups( 0u );
+    futures->Wait();
+  }
+  else
+  {
+    applyGroups( 0u );
+  }
+}
+
+void ConstraintScheduler::Schedule()
+{
+  const uint32_t count = mOwners.Count();
+
+  mOwnerIndices.clear();
+  for( uint32_t i = 0u; i < count; ++i )
+  {
+    mOwnerIndices[ mOwners[i] ] = i;
+  }
+
+  // Find the constrained nodes read by the constraints of each node, and merge the nodes which depend on each other into groups
+  Dali::Vector< uint32_t > readBegin;
+  Dali::Vector< uint32_t > reads;
+  readBegin.Resize( count + 1u );
+  mGroupParents.Resize( count );
+  for( uint32_t i = 0u; i < count; ++i )
+  {
+    mGroupParents[i] = i;
+  }
+
+  for( uint32_t i = 0u; i < count; ++i )
+  {
+    readBegin[i] = reads.Count();
+    for( auto&& constraint : mOwners[i]->GetConstraints() )
+    {
+      for( auto&& owner : constraint->GetObservedOwners() )
+      {
+        auto iter = mOwnerIndices.find( owner );
+        if( iter != mOwnerIndices.end() && iter->second != i )
+        {
+          reads.PushBack( iter->second );
+
+          const uint32_t group = FindGroup( i );
+          const uint32_t otherGroup = FindGroup( iter->second );
+          mGroupParents[ std::max( group, otherGroup ) ] = std::min( group, otherGroup );
+        }
+      }
+    }
+  }
+  readBegin[count] = reads.Count();
+
+  // Order the nodes depth first, so each node follows the nodes it reads; a cycle is broken where it is found
+  Dali::Vector< uint8_t > states;
+  Dali::Vector< uint32_t > order;
+  Dali::Vector< uint32_t > stack;
+  Dali::Vector< uint32_t > nextRead;
+  states.Resize( count, UNVISITED );
+  order.Reserve( count );
+  for( uint32_t first = 0u; first < count; ++first )
+  {
+    if( states[first] != UNVISITED )
+    {
+      continue;
+    }
+
+    states[first] = VISITING;
+    stack.PushBack( first );
+    nextRead.PushBack( readBegin[first] );
+    while( !stack.Empty() )
+    {
+      const uint32_t top = stack.Count() - 1u;
+      const uint32_t index = stack[top];
+      if( nextRead[top] < readBegin[index + 1u] )
+      {
+        const uint32_t read = reads[ nextRead[top]++ ];
+        if( states[read] == UNVISITED )
+        {
+          states[read] = VISITING;
+          stack.PushBack( read );
+          nextRead.PushBack( readBegin[read] );
+        }
+      }
+      else
+      {
+        states[index] = VISITED;
+        order.PushBack( index );
+        stack.Resize( top );
+        nextRead.Resize( top );
+      }
+    }
+  }
+
+  // Gather the nodes of each group, keeping their order; the groups are ordered by their first node
+  Dali::Vector< uint32_t > groupIndices;
+  groupIndices.Resize( count, INVALID_GROUP );
+  mGroupBegin.Clear();
+  for( auto&& index : order )
+  {
+    const uint32_t group = FindGroup( index );
+    if( groupIndices[group] == INVALID_GROUP )
+    {
+      groupIndices[group] = mGroupBegin.Count();
+      mGroupBegin.PushBack( 0u );
+    }
+    ++mGroupBegin[ groupIndices[group] ];
+  }
+
+  // Convert the sizes of the groups to their first indices
+  uint32_t begin = 0u;
+  for( auto&& groupBegin : mGroupBegin )
+  {
+    const uint32_t size = groupBegin;
+    groupBegin = begin;
+    begin += size;
+  }
+  mGroupBegin.PushBack( begin );
+
+  Dali::Vector< uint32_t > positions;
+  positions.Resize( mGroupBegin.Count() );
+  std::copy( mGroupBegin.Begin(), mGroupBegin.End(), positions.Begin() );
+  mSchedule.Resize( count );
+  for( auto&& index : order )
+  {
+    mSchedule[ positions[ groupIndices[ FindGroup( index ) ] ]++ ] = mOwners[index];
+  }
+
+  mOwnerIndices.clear();
+}
+
+uint32_t ConstraintScheduler::FindGroup( uint32_t index )
+{
+  while( mGroupParents[index] != index )
+  {
+    mGroupParents[index] = mGroupParents[ mGroupParents[index] ];
+    index = mGroupParents[index];
+  }
+  return index;
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,123 @@
+#ifndef DALI_INTERNAL_SCENE_GRAPH_CONSTRAINT_SCHEDULER_H
+#define DALI_INTERNAL_SCENE_GRAPH_CONSTRAINT_SCHEDULER_H
+
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <unordered_map>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/internal/common/buffer-index.h>
+
+namespace Dali
+{
+
+class ThreadPool;
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+class FlattenedNodeTree;
+class PropertyOwner;
+
+/**
+ * Applies the constraints of the nodes in the order of their dependencies.
+ *
+ * The constraints of a node are applied after the constraints of the nodes which provide their inputs,
+ * so they read the constrained values of the current frame. The order is only recalculated when
+ * the constraints or their inputs change. Nodes whose constraints don't depend on each other form
+ * independent groups, which are constrained by the worker threads when a thread pool is set.
+ */
+class ConstraintScheduler
+{
+public:
+
+  /**
+   * Constructor
+   */
+  ConstraintScheduler();
+
+  /**
+   * Non-virtual destructor
+   */
+  ~ConstraintScheduler();
+
+  /**
+   * Sets the worker threads used to apply the independent groups of constraints in parallel
+   * @param[in] threadPool The thread pool, or nullptr to apply all the constraints on the update thread
+   */
+  void SetThreadPool( Dali::ThreadPool* threadPool );
+
+  /**
+   * Collects the nodes of a tree which have constraints; the root of the tree is not constrained.
+   * The nodes below an invisible node are not constrained either, unless the invisible node has
+   * constraints of its own, which might make it visible.
+   * @param[in] nodeTree The nodes of the tree in depth first order
+   * @param[in] updateBufferIndex The current update buffer index
+   */
+  void AddNodes( const FlattenedNodeTree& nodeTree, BufferIndex updateBufferIndex );
+
+  /**
+   * Applies the constraints of the nodes collected since the last call
+   * @param[in] updateBufferIndex The current update buffer index
+   */
+  void Apply( BufferIndex updateBufferIndex );
+
+private:
+
+  /**
+   * Calculates the order and the groups of the collected nodes from the dependencies of their constraints
+   */
+  void Schedule();
+
+  /**
+   * Finds the group of a node
+   * @param[in] index The index of the node in mOwners
+   * @return The index of the node representing the group
+   */
+  uint32_t FindGroup( uint32_t index );
+
+  // Undefined
+  ConstraintScheduler( const ConstraintScheduler& );
+
+  // Undefined
+  ConstraintScheduler& operator=( const ConstraintScheduler& );
+
+private:
+
+  Dali::Vector< PropertyOwner* > mOwners;              ///< The nodes with constraints, in the order they were collected
+  Dali::Vector< const void* > mDependencies;           ///< Each node followed by its constraints and their observed owners, used to detect changes
+  Dali::Vector< const void* > mScheduledDependencies;  ///< The dependencies when the order was last calculated
+  Dali::Vector< PropertyOwner* > mSchedule;            ///< The nodes in the order their constraints are applied, grouped
+  Dali::Vector< uint32_t > mGroupBegin;                ///< The index of the first node of each group in mSchedule, followed by the number of nodes
+  Dali::Vector< uint32_t > mGroupParents;              ///< Used to merge the nodes into groups while scheduling
+  std::unordered_map< const PropertyOwner*, uint32_t > mOwnerIndices; ///< The indices of the nodes in mOwners, while scheduling
+  Dali::ThreadPool* mThreadPool;                       ///< The worker threads, not owned
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SCENE_GRAPH_CONSTRAINT_SCHEDULER_H
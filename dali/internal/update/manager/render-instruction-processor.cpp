@@ -18,11 +18,17 @@
 // CLASS HEADER
 #include <dali/internal/update/manager/render-instruction-processor.h>
 
+// EXTERNAL INCLUDES
+#include <cstring> // for memcpy
+#include <cmath>
+#include <algorithm>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/actors/layer.h>
 #include <dali/integration-api/debug.h>
 #include <dali/internal/event/actors/layer-impl.h> // for the default sorting function
 #include <dali/internal/update/manager/sorted-layers.h>
+#include <dali/internal/update/manager/transform-kernels.h>
 #include <dali/internal/update/render-tasks/scene-graph-render-task.h>
 #include <dali/internal/update/rendering/scene-graph-texture-set.h>
 #include <dali/internal/render/common/render-item.h>
@@ -82,8 +88,6 @@ inline bool PartialCompareItems( const RenderInstructionProcessor::SortAttribute
  */
 bool CompareItems( const RenderInstructionProcessor::SortAttributes& lhs, const RenderInstructionProcessor::SortAttributes& rhs )
 {
-  // @todo Consider replacing all these sortAttributes with a single long int that
-  // encapsulates the same data (e.g. the middle-order bits of the ptrs).
   if( lhs.renderItem->mDepthIndex == rhs.renderItem->mDepthIndex )
   {
     return PartialCompareItems( lhs, rhs );
@@ -141,34 +145,278 @@ bool CompareItems3DWithClipping( const RenderInstructionProcessor::SortAttribute
   return lhs.renderItem->mNode->mClippingSortModifier < rhs.renderItem->mNode->mClippingSortModifier;
 }
 
+/**
+ * Below this number of render items, a comparison sort of the keys is faster than a radix sort
+ */
+const uint32_t MINIMUM_RADIX_SORT_ITEMS = 64u;
+
+/**
+ * The average number of positions a key of a patched render list can be moved by before a full sort is used instead
+ */
+const uint32_t MAXIMUM_INSERTION_SORT_MOVES_PER_ITEM = 4u;
+
+/**
+ * From this number of renderables, a layer is culled through its bounding volume hierarchy instead of sphere by sphere
+ */
+const uint32_t MINIMUM_BOUNDING_VOLUME_HIERARCHY_RENDERABLES = 128u;
+
+/**
+ * The number of 8 bit digits of a SortKey
+ */
+const uint32_t SORT_KEY_DIGITS = 16u;
+
+/**
+ * The number of bits of each instance id in the keys with a Z value, and in the keys without one
+ */
+const uint32_t INSTANCE_ID_BITS_WITH_Z_VALUE = 10u;
+const uint32_t INSTANCE_ID_BITS = 21u;
+
+/**
+ * The minimum number of slots of the hash table of the instance ids
+ */
+const uint32_t MINIMUM_INSTANCE_SLOTS = 64u;
+
+/**
+ * Packs the ids of the shader, textureSet and geometry instances into a key.
+ * The ids are given to the instances of each list which is sorted, so they only exceed the bits of the key, and
+ * share the largest id, if a list has more instances of a kind. That only loses some batching of the instances.
+ * @param[in] shaderId The id of the shader instance
+ * @param[in] textureSetId The id of the textureSet instance
+ * @param[in] geometryId The id of the geometry instance
+ * @param[in] idBits The number of bits of each id
+ * @return The key
+ */
+inline uint64_t PackInstances( uint32_t shaderId, uint32_t textureSetId, uint32_t geometryId, uint32_t idBits )
+{
+  const uint32_t maximumId = ( 1u << idBits ) - 1u;
+  return ( static_cast<uint64_t>( std::min( shaderId, maximumId ) ) << ( idBits * 2u ) ) |
+         ( static_cast<uint64_t>( std::min( textureSetId, maximumId ) ) << idBits ) |
+         static_cast<uint64_t>( std::min( geometryId, maximumId ) );
+}
+
+/**
+ * Converts a Z value into a key which sorts the furthest Z values first.
+ * The Z value is rounded down to a multiple of the epsilon which Equals() uses for it, so the Z values the
+ * comparitors consider equal usually get the same key, and are ordered by their instances as well.
+ * @param[in] zValue The Z value
+ * @return The key
+ */
+inline uint32_t PackZValue( float zValue )
+{
+  // Values near zero are only equal to themselves
+  const float epsilon = GetRangedEpsilon( zValue, zValue );
+  if( epsilon > Math::MACHINE_EPSILON_0 )
+  {
+    zValue = std::floor( zValue / epsilon ) * epsilon;
+  }
+
+  // Make sure -0.0 and 0.0 get the same key
+  zValue += 0.0f;
+
+  uint32_t bits;
+  memcpy( &bits, &zValue, sizeof( bits ) );
+
+  // Flip the floats so they sort as unsigned integers, then reverse the order
+  bits = ( bits & 0x80000000u ) ? ~bits : ( bits | 0x80000000u );
+  return ~bits;
+}
+
+/**
+ * Retrieves a digit of a key, the least significant first.
+ * @param[in] key The key
+ * @param[in] digit The index of the digit
+ * @return The digit
+ */
+inline uint32_t GetDigit( const RenderInstructionProcessor::SortKey& key, uint32_t digit )
+{
+  return ( digit < 8u ) ? static_cast<uint32_t>( key.secondaryKey >> ( digit * 8u ) ) & 0xffu
+                        : static_cast<uint32_t>( key.primaryKey >> ( ( digit - 8u ) * 8u ) ) & 0xffu;
+}
+
+/**
+ * Function which compares keys by primary key, then by secondary key
+ * @param[in] lhs Left hand side key
+ * @param[in] rhs Right hand side key
+ * @return True if left key is less than right
+ */
+bool CompareKeys( const RenderInstructionProcessor::SortKey& lhs, const RenderInstructionProcessor::SortKey& rhs )
+{
+  if( lhs.primaryKey == rhs.primaryKey )
+  {
+    return lhs.secondaryKey < rhs.secondaryKey;
+  }
+  return lhs.primaryKey < rhs.primaryKey;
+}
+
+/**
+ * Stable insertion sort of keys which are mostly sorted already.
+ * @param[in,out] keys The keys to sort
+ * @param[in] maximumMoves The number of moves of a key by one position after which the sort gives up
+ * @return true if the keys are sorted, false if the sort gave up
+ */
+bool InsertionSortKeys( std::vector< RenderInstructionProcessor::SortKey >& keys, uint32_t maximumMoves )
+{
+  uint32_t moves = 0u;
+  const uint32_t count = static_cast<uint32_t>( keys.size() );
+  for( uint32_t index = 1u; index < count; ++index )
+  {
+    if( CompareKeys( keys[ index ], keys[ index - 1u ] ) )
+    {
+      const RenderInstructionProcessor::SortKey key = keys[ index ];
+      uint32_t position = index;
+      do
+      {
+        keys[ position ] = keys[ position - 1u ];
+        --position;
+        ++moves;
+      }
+      while( ( position > 0u ) && CompareKeys( key, keys[ position - 1u ] ) );
+      keys[ position ] = key;
+
+      if( moves > maximumMoves )
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * Stable least significant digit radix sort of the keys.
+ * The passes of the digits which are the same for all the keys are skipped.
+ * @param[in,out] keys The keys to sort
+ * @param[in] buffer Scratch buffer, resized as needed
+ */
+void RadixSortKeys( std::vector< RenderInstructionProcessor::SortKey >& keys, std::vector< RenderInstructionProcessor::SortKey >& buffer )
+{
+  const uint32_t count = static_cast<uint32_t>( keys.size() );
+  buffer.resize( count );
+
+  // Count the digits of all the passes at once
+  uint32_t histograms[ SORT_KEY_DIGITS ][ 256u ] = {};
+  for( auto&& key : keys )
+  {
+    for( uint32_t digit = 0u; digit < SORT_KEY_DIGITS; ++digit )
+    {
+      ++histograms[ digit ][ GetDigit( key, digit ) ];
+    }
+  }
+
+  RenderInstructionProcessor::SortKey* source = keys.data();
+  RenderInstructionProcessor::SortKey* destination = buffer.data();
+  for( uint32_t digit = 0u; digit < SORT_KEY_DIGITS; ++digit )
+  {
+    uint32_t* histogram = histograms[ digit ];
+    if( histogram[ GetDigit( source[0], digit ) ] == count )
+    {
+      continue;
+    }
+
+    // Turn the counts into the first index of each digit
+    uint32_t offset = 0u;
+    for( uint32_t value = 0u; value < 256u; ++value )
+    {
+      const uint32_t digitCount = histogram[ value ];
+      histogram[ value ] = offset;
+      offset += digitCount;
+    }
+
+    for( uint32_t index = 0u; index < count; ++index )
+    {
+      destination[ histogram[ GetDigit( source[ index ], digit ) ]++ ] = source[ index ];
+    }
+    std::swap( source, destination );
+  }
+
+  if( source != keys.data() )
+  {
+    keys.swap( buffer );
+  }
+}
+
+/**
+ * Checks whether a renderable can be culled
+ * @param renderable Node-Renderer pair
+ * @return true if the renderable is culled when it is outside the view frustum
+ */
+inline bool IsCullable( const Renderable& renderable )
+{
+  return renderable.mRenderer && !renderable.mRenderer->GetShader().HintEnabled( Dali::Shader::Hint::MODIFIES_GEOMETRY );
+}
+
+/**
+ * Checks whether a renderable is inside the view frustum of the camera
+ * @param updateBufferIndex to read the bounding sphere from
+ * @param renderable Node-Renderer pair
+ * @param camera The camera used to render
+ * @param cull Whether frustum culling is enabled or not
+ * @return true if the renderable is inside the frustum or is not culled
+ */
+inline bool IsInsideFrustum( BufferIndex updateBufferIndex,
+                             const Renderable& renderable,
+                             SceneGraph::Camera& camera,
+                             bool cull )
+{
+  if( cull && IsCullable( renderable ) )
+  {
+    const Vector4& boundingSphere = renderable.mNode->GetBoundingSphere();
+    return ( boundingSphere.w > Math::MACHINE_EPSILON_1000 ) &&
+           ( camera.CheckSphereInFrustum( updateBufferIndex, Vector3( boundingSphere ), boundingSphere.w ) );
+  }
+  return true;
+}
+
+/**
+ * Sets the attributes of a render item which don't depend on the transform of its node
+ * @param item to set the attributes of
+ * @param renderable Node-Renderer pair
+ * @param opacityType The opacity of the renderer
+ * @param isLayer3d Whether we are processing a 3D layer or not
+ */
+inline void SetItemAttributes( RenderItem& item,
+                               const Renderable& renderable,
+                               Renderer::OpacityType opacityType,
+                               bool isLayer3d )
+{
+  item.mNode = renderable.mNode;
+  item.mIsOpaque = ( opacityType == Renderer::OPAQUE );
+  item.mDepthIndex = 0;
+
+  if(!isLayer3d)
+  {
+    item.mDepthIndex = renderable.mNode->GetDepthIndex();
+  }
+
+  if( DALI_LIKELY( renderable.mRenderer ) )
+  {
+    item.mRenderer =   &renderable.mRenderer->GetRenderer();
+    item.mTextureSet =  renderable.mRenderer->GetTextures();
+    item.mDepthIndex += renderable.mRenderer->GetDepthIndex();
+  }
+  else
+  {
+    item.mRenderer = nullptr;
+  }
+}
+
 /**
  * Add a renderer to the list
+ * The modelview matrix of the item is calculated later, for all the items at once
  * @param updateBufferIndex to read the model matrix from
  * @param renderList to add the item to
  * @param renderable Node-Renderer pair
- * @param viewMatrix used to calculate modelview matrix for the item
- * @param camera The camera used to render
  * @param isLayer3d Whether we are processing a 3D layer or not
- * @param cull Whether frustum culling is enabled or not
+ * @param inside Whether the renderable is inside the view frustum, or is not culled
  */
 inline void AddRendererToRenderList( BufferIndex updateBufferIndex,
                                      RenderList& renderList,
                                      Renderable& renderable,
-                                     const Matrix& viewMatrix,
-                                     SceneGraph::Camera& camera,
                                      bool isLayer3d,
-                                     bool cull )
+                                     bool inside )
 {
-  bool inside( true );
   Node* node = renderable.mNode;
 
-  if( cull && renderable.mRenderer && !renderable.mRenderer->GetShader().HintEnabled( Dali::Shader::Hint::MODIFIES_GEOMETRY ) )
-  {
-    const Vector4& boundingSphere = node->GetBoundingSphere();
-    inside = ( boundingSphere.w > Math::MACHINE_EPSILON_1000 ) &&
-             ( camera.CheckSphereInFrustum( updateBufferIndex, Vector3( boundingSphere ), boundingSphere.w ) );
-  }
-
   if( inside )
   {
     Renderer::OpacityType opacityType = renderable.mRenderer ? renderable.mRenderer->GetOpacityType( updateBufferIndex, *renderable.mNode ) : Renderer::OPAQUE;
@@ -176,31 +424,10 @@ inline void AddRendererToRenderList( BufferIndex updateBufferIndex,
     {
       // Get the next free RenderItem.
       RenderItem& item = renderList.GetNextFreeItem();
+      SetItemAttributes( item, renderable, opacityType, isLayer3d );
 
-      item.mNode = renderable.mNode;
-      item.mIsOpaque = ( opacityType == Renderer::OPAQUE );
-      item.mDepthIndex = 0;
-
-      if(!isLayer3d)
-      {
-        item.mDepthIndex = renderable.mNode->GetDepthIndex();
-      }
-
-      if( DALI_LIKELY( renderable.mRenderer ) )
-      {
-        item.mRenderer =   &renderable.mRenderer->GetRenderer();
-        item.mTextureSet =  renderable.mRenderer->GetTextures();
-        item.mDepthIndex += renderable.mRenderer->GetDepthIndex();
-      }
-      else
-      {
-        item.mRenderer = nullptr;
-      }
-
-      // Save ModelView matrix onto the item.
+      // Save model matrix onto the item.
       node->GetWorldMatrixAndSize( item.mModelMatrix, item.mSize );
-
-      Matrix::Multiply( item.mModelViewMatrix, item.mModelMatrix, viewMatrix );
     }
 
      node->SetCulled( updateBufferIndex, false );
@@ -213,6 +440,8 @@ inline void AddRendererToRenderList( BufferIndex updateBufferIndex,
 
 /**
  * Add all renderers to the list
+ * The bounding spheres of all the renderers are checked against the view frustum at once, then the
+ * modelview matrices are calculated for the items which were added.
  * @param updateBufferIndex to read the model matrix from
  * @param renderList to add the items to
  * @param renderers to render
@@ -221,6 +450,9 @@ inline void AddRendererToRenderList( BufferIndex updateBufferIndex,
  * @param camera The camera used to render
  * @param isLayer3d Whether we are processing a 3D layer or not
  * @param cull Whether frustum culling is enabled or not
+ * @param boundingVolumes The bounding volume hierarchy of the renderers, used to cull large layers
+ * @param boundingSpheres Scratch buffer for the bounding spheres of the renderers
+ * @param insideFrustum Scratch buffer for the culling results of the renderers
  */
 inline void AddRenderersToRenderList( BufferIndex updateBufferIndex,
                                       RenderList& renderList,
@@ -228,35 +460,76 @@ inline void AddRenderersToRenderList( BufferIndex updateBufferIndex,
                                       const Matrix& viewMatrix,
                                       SceneGraph::Camera& camera,
                                       bool isLayer3d,
-                                      bool cull )
+                                      bool cull,
+                                      BoundingVolumeHierarchy& boundingVolumes,
+                                      Dali::Vector< Vector4 >& boundingSpheres,
+                                      Dali::Vector< bool >& insideFrustum )
 {
   DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "AddRenderersToRenderList()\n");
 
-  for( auto&& renderer : renderers )
+  const uint32_t renderableCount = static_cast<uint32_t>( renderers.Size() );
+  if( cull )
+  {
+    const SceneGraph::Camera::FrustumPlanes& frustum = camera.GetFrustumPlanes( updateBufferIndex );
+    Vector4 planes[ TransformKernels::FRUSTUM_PLANE_COUNT ];
+    for( uint32_t plane = 0; plane < TransformKernels::FRUSTUM_PLANE_COUNT; ++plane )
+    {
+      planes[ plane ] = Vector4( frustum.mPlanes[ plane ].mNormal );
+      planes[ plane ].w = frustum.mPlanes[ plane ].mDistance;
+    }
+
+    insideFrustum.Resize( renderableCount );
+    if( renderableCount >= MINIMUM_BOUNDING_VOLUME_HIERARCHY_RENDERABLES )
+    {
+      boundingVolumes.Update( renderers.Begin(), renderableCount );
+      boundingVolumes.CheckInFrustum( planes, insideFrustum.Begin() );
+    }
+    else
+    {
+      // Release the hierarchy of a layer which had more renderables
+      boundingVolumes.Clear();
+
+      boundingSpheres.Resize( renderableCount );
+      for( uint32_t index = 0; index < renderableCount; ++index )
+      {
+        boundingSpheres[ index ] = renderers[ index ].mNode->GetBoundingSphere();
+      }
+
+      TransformKernels::CheckSpheresInFrustum( insideFrustum.Begin(), boundingSpheres.Begin(), planes, renderableCount );
+    }
+  }
+
+  const uint32_t firstItem = renderList.Count();
+  for( uint32_t index = 0; index < renderableCount; ++index )
   {
+    Renderable& renderable = renderers[ index ];
     AddRendererToRenderList( updateBufferIndex,
                              renderList,
-                             renderer,
-                             viewMatrix,
-                             camera,
+                             renderable,
                              isLayer3d,
-                             cull );
+                             !cull || !IsCullable( renderable ) || insideFrustum[ index ] );
+  }
+
+  // Save ModelView matrices onto the items.
+  const uint32_t itemCount = renderList.Count();
+  for( uint32_t index = firstItem; index < itemCount; ++index )
+  {
+    RenderItem& item = renderList.GetItem( index );
+    TransformKernels::Multiply( item.mModelViewMatrix, item.mModelMatrix, viewMatrix );
   }
 }
 
 /**
- * Try to reuse cached RenderItems from the RenderList
- * This avoids recalculating the model view matrices in case this part of the scene was static
- * An example case is a toolbar layer that rarely changes or a popup on top of the rest of the stage
+ * Checks whether the cached RenderItems of the RenderList were created from the same renderables
  * @param layer that is being processed
  * @param renderList that is cached from frame N-1
  * @param renderables list of renderables
+ * @return true if the cached items are from the same renderables
  */
-inline bool TryReuseCachedRenderers( Layer& layer,
-                                     RenderList& renderList,
-                                     RenderableContainer& renderables )
+inline bool HasSameRenderers( Layer& layer,
+                              RenderList& renderList,
+                              RenderableContainer& renderables )
 {
-  bool retValue = false;
   uint32_t renderableCount = static_cast<uint32_t>( renderables.Size() );
   // Check that the cached list originates from this layer and that the counts match
   if( ( renderList.GetSourceLayer() == &layer )&&
@@ -264,23 +537,158 @@ inline bool TryReuseCachedRenderers( Layer& layer,
   {
     // Check that all the same renderers are there. This gives us additional security in avoiding rendering the wrong things.
     // Render list is sorted so at this stage renderers may be in different order.
-    // Therefore we check a combined sum of all renderer addresses.
+    // Therefore we check a combined sum of all renderer addresses, and of all node addresses as renderers can be shared.
     size_t checkSumNew = 0;
     size_t checkSumOld = 0;
+    size_t nodeCheckSumNew = 0;
+    size_t nodeCheckSumOld = 0;
     for( uint32_t index = 0; index < renderableCount; ++index )
     {
-      const Render::Renderer& renderer = renderables[index].mRenderer->GetRenderer();
-      checkSumNew += reinterpret_cast<std::size_t>( &renderer );
-      checkSumOld += reinterpret_cast<std::size_t>( &renderList.GetRenderer( index ) );
+      const Render::Renderer* renderer = renderables[index].mRenderer ? &renderables[index].mRenderer->GetRenderer() : nullptr;
+      const RenderItem& item = renderList.GetItem( index );
+      checkSumNew += reinterpret_cast<std::size_t>( renderer );
+      checkSumOld += reinterpret_cast<std::size_t>( item.mRenderer );
+      nodeCheckSumNew += reinterpret_cast<std::size_t>( renderables[index].mNode );
+      nodeCheckSumOld += reinterpret_cast<std::size_t>( item.mNode );
     }
-    if( checkSumNew == checkSumOld )
+    return ( checkSumNew == checkSumOld ) && ( nodeCheckSumNew == nodeCheckSumOld );
+  }
+  return false;
+}
+
+/**
+ * Try to reuse cached RenderItems from the RenderList
+ * This avoids recalculating the model view matrices in case this part of the scene was static
+ * An example case is a toolbar layer that rarely changes or a popup on top of the rest of the stage
+ * @param layer that is being processed
+ * @param renderList that is cached from frame N-1
+ * @param renderables list of renderables
+ */
+inline bool TryReuseCachedRenderers( Layer& layer,
+                                     RenderList& renderList,
+                                     RenderableContainer& renderables )
+{
+  bool retValue = false;
+  if( HasSameRenderers( layer, renderList, renderables ) )
+  {
+    // tell list to reuse its existing items
+    renderList.ReuseCachedItems();
+    retValue = true;
+  }
+  return retValue;
+}
+
+/**
+ * Finds the scene-graph renderer of a cached RenderItem
+ * @param item The cached item
+ * @param[out] renderable Node-Renderer pair of the item
+ * @return true if the renderer was found, false if it has been removed from the node
+ */
+inline bool FindRenderable( const RenderItem& item, Renderable& renderable )
+{
+  renderable.mNode = item.mNode;
+  renderable.mRenderer = nullptr;
+  if( item.mRenderer )
+  {
+    const uint32_t rendererCount = item.mNode->GetRendererCount();
+    for( uint32_t rendererIndex = 0; rendererIndex < rendererCount; ++rendererIndex )
     {
-      // tell list to reuse its existing items
-      renderList.ReuseCachedItems();
-      retValue = true;
+      Renderer* renderer = item.mNode->GetRendererAt( rendererIndex );
+      if( &renderer->GetRenderer() == item.mRenderer )
+      {
+        renderable.mRenderer = renderer;
+        return true;
+      }
     }
+    return false;
   }
-  return retValue;
+  return true;
+}
+
+/**
+ * Try to patch cached RenderItems of the RenderList in place
+ * Only the items whose node has moved since the list was created get their model view matrix recalculated and are
+ * culled again, so the list can only be patched while the view and projection matrices of the camera are unchanged.
+ * The items keep the order of the previous sort so they can be re-sorted cheaply.
+ * All the items are checked before any of them is patched, so the list is left as it was if it can't be patched.
+ * An example case is a scrolling list where a few items are animated
+ * @param updateBufferIndex to read the model matrix from
+ * @param layer that is being processed
+ * @param renderList that is cached from frame N-1
+ * @param renderables list of renderables
+ * @param viewMatrix used to calculate modelview matrix for the items
+ * @param camera The camera used to render
+ * @param isLayer3d Whether we are processing a 3D layer or not
+ * @param cull Whether frustum culling is enabled or not
+ * @return true if the items were patched, false if the list has to be created again
+ */
+inline bool TryPatchCachedRenderers( BufferIndex updateBufferIndex,
+                                     Layer& layer,
+                                     RenderList& renderList,
+                                     RenderableContainer& renderables,
+                                     const Matrix& viewMatrix,
+                                     SceneGraph::Camera& camera,
+                                     bool isLayer3d,
+                                     bool cull )
+{
+  if( !HasSameRenderers( layer, renderList, renderables ) )
+  {
+    return false;
+  }
+
+  Matrix modelMatrix( false );
+  Vector3 size;
+  Renderable renderable;
+  const uint32_t itemCount = renderList.GetCachedItemCount();
+
+  // Check the list can be patched
+  for( uint32_t index = 0; index < itemCount; ++index )
+  {
+    const RenderItem& item = renderList.GetItem( index );
+    if( !FindRenderable( item, renderable ) )
+    {
+      return false;
+    }
+
+    // An item which is culled now has to be removed, so the list is created again
+    item.mNode->GetWorldMatrixAndSize( modelMatrix, size );
+    if( ( memcmp( modelMatrix.AsFloat(), item.mModelMatrix.AsFloat(), sizeof( float ) * 16u ) != 0 ||
+          memcmp( size.AsFloat(), item.mSize.AsFloat(), sizeof( float ) * 3u ) != 0 ) &&
+        !IsInsideFrustum( updateBufferIndex, renderable, camera, cull ) )
+    {
+      return false;
+    }
+
+    Renderer::OpacityType opacityType = renderable.mRenderer ? renderable.mRenderer->GetOpacityType( updateBufferIndex, *renderable.mNode ) : Renderer::OPAQUE;
+    if( opacityType == Renderer::TRANSPARENT && item.mNode->GetClippingMode() != ClippingMode::CLIP_CHILDREN )
+    {
+      return false;
+    }
+  }
+
+  // Patch the items
+  for( uint32_t index = 0; index < itemCount; ++index )
+  {
+    RenderItem& item = renderList.GetItem( index );
+    FindRenderable( item, renderable );
+
+    // The item is up to date if the node has not moved, as the camera has not changed either
+    item.mNode->GetWorldMatrixAndSize( modelMatrix, size );
+    if( memcmp( modelMatrix.AsFloat(), item.mModelMatrix.AsFloat(), sizeof( float ) * 16u ) != 0 ||
+        memcmp( size.AsFloat(), item.mSize.AsFloat(), sizeof( float ) * 3u ) != 0 )
+    {
+      item.mModelMatrix = modelMatrix;
+      item.mSize = size;
+      TransformKernels::Multiply( item.mModelViewMatrix, item.mModelMatrix, viewMatrix );
+    }
+
+    Renderer::OpacityType opacityType = renderable.mRenderer ? renderable.mRenderer->GetOpacityType( updateBufferIndex, *renderable.mNode ) : Renderer::OPAQUE;
+    SetItemAttributes( item, renderable, opacityType, isLayer3d );
+  }
+
+  // tell list to use its patched items
+  renderList.ReuseCachedItems();
+  return true;
 }
 
 inline bool SetupRenderList( RenderableContainer& renderables,
@@ -301,7 +709,12 @@ inline bool SetupRenderList( RenderableContainer& renderables,
 
 
 RenderInstructionProcessor::RenderInstructionProcessor()
-: mSortingHelper()
+: mSortingHelper(),
+  mSortKeys(),
+  mSortKeysBuffer(),
+  mBoundingSpheres(),
+  mInsideFrustum(),
+  mInstanceSlots()
 {
   // Set up a container of comparators for fast run-time selection.
   mSortComparitors.Reserve( 3u );
@@ -315,8 +728,15 @@ RenderInstructionProcessor::~RenderInstructionProcessor()
 {
 }
 
-inline void RenderInstructionProcessor::SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, bool respectClippingOrder )
+inline void RenderInstructionProcessor::SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, bool respectClippingOrder, bool isMostlySorted )
 {
+  // Layers with a custom sort function keep using the comparitors
+  if( layer.UsesDefaultSortFunction() )
+  {
+    SortRenderItemsByKey( bufferIndex, renderList, layer, respectClippingOrder, isMostlySorted );
+    return;
+  }
+
   const uint32_t renderableCount = static_cast<uint32_t>( renderList.Count() );
   // Reserve space if needed.
   const uint32_t oldcapacity = static_cast<uint32_t>( mSortingHelper.size() );
@@ -335,46 +755,20 @@ inline void RenderInstructionProcessor::SortRenderItems( BufferIndex bufferIndex
   }
 
   // Calculate the sorting value, once per item by calling the layers sort function.
-  // Using an if and two for-loops rather than if inside for as its better for branch prediction.
-  if( layer.UsesDefaultSortFunction() )
-  {
-    for( uint32_t index = 0; index < renderableCount; ++index )
-    {
-      RenderItem& item = renderList.GetItem( index );
-
-      if( item.mRenderer )
-      {
-        item.mRenderer->SetSortAttributes( bufferIndex, mSortingHelper[ index ] );
-      }
-
-      // texture set
-      mSortingHelper[ index ].textureSet = item.mTextureSet;
-
-      // The default sorting function should get inlined here.
-      mSortingHelper[ index ].zValue = Internal::Layer::ZValue( item.mModelViewMatrix.GetTranslation3() ) - static_cast<float>( item.mDepthIndex );
-
-      // Keep the renderitem pointer in the helper so we can quickly reorder items after sort.
-      mSortingHelper[ index ].renderItem = &item;
-    }
-  }
-  else
+  const Dali::Layer::SortFunctionType sortFunction = layer.GetSortFunction();
+  for( uint32_t index = 0; index < renderableCount; ++index )
   {
-    const Dali::Layer::SortFunctionType sortFunction = layer.GetSortFunction();
-    for( uint32_t index = 0; index < renderableCount; ++index )
-    {
-      RenderItem& item = renderList.GetItem( index );
+    RenderItem& item = renderList.GetItem( index );
 
-      item.mRenderer->SetSortAttributes( bufferIndex, mSortingHelper[ index ] );
+    item.mRenderer->SetSortAttributes( bufferIndex, mSortingHelper[ index ] );
 
-      // texture set
-      mSortingHelper[ index ].textureSet = item.mTextureSet;
+    // texture set
+    mSortingHelper[ index ].textureSet = item.mTextureSet;
 
+    mSortingHelper[ index ].zValue = (*sortFunction)( item.mModelViewMatrix.GetTranslation3() ) - static_cast<float>( item.mDepthIndex );
 
-      mSortingHelper[ index ].zValue = (*sortFunction)( item.mModelViewMatrix.GetTranslation3() ) - static_cast<float>( item.mDepthIndex );
-
-      // Keep the RenderItem pointer in the helper so we can quickly reorder items after sort.
-      mSortingHelper[ index ].renderItem = &item;
-    }
+    // Keep the RenderItem pointer in the helper so we can quickly reorder items after sort.
+    mSortingHelper[ index ].renderItem = &item;
   }
 
   // Here we determine which comparitor (of the 3) to use.
@@ -395,6 +789,117 @@ inline void RenderInstructionProcessor::SortRenderItems( BufferIndex bufferIndex
   }
 }
 
+inline uint32_t RenderInstructionProcessor::GetInstanceId( const void* instance, uint32_t& nextId )
+{
+  if( !instance )
+  {
+    return 0u;
+  }
+
+  // Open addressing with linear probing, the table is never more than three quarters full
+  const uint32_t mask = static_cast<uint32_t>( mInstanceSlots.Count() ) - 1u;
+  const uint64_t hash = static_cast<uint64_t>( reinterpret_cast<std::uintptr_t>( instance ) >> 4u ) * 0x9E3779B97F4A7C15ull;
+  uint32_t slot = static_cast<uint32_t>( hash >> 32u ) & mask;
+  while( mInstanceSlots[ slot ].instance )
+  {
+    if( mInstanceSlots[ slot ].instance == instance )
+    {
+      return mInstanceSlots[ slot ].id;
+    }
+    slot = ( slot + 1u ) & mask;
+  }
+
+  mInstanceSlots[ slot ].instance = instance;
+  mInstanceSlots[ slot ].id = nextId;
+  return nextId++;
+}
+
+inline void RenderInstructionProcessor::SortRenderItemsByKey( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, bool respectClippingOrder, bool isMostlySorted )
+{
+  const uint32_t renderableCount = static_cast<uint32_t>( renderList.Count() );
+  mSortKeys.resize( renderableCount );
+
+  // Each item has up to three instances, which are given ids in the order they are found, from 1
+  uint32_t slotCount = MINIMUM_INSTANCE_SLOTS;
+  while( slotCount < renderableCount * 4u )
+  {
+    slotCount <<= 1u;
+  }
+  mInstanceSlots.Resize( slotCount );
+  memset( mInstanceSlots.Begin(), 0, slotCount * sizeof( InstanceSlot ) );
+  uint32_t nextShaderId = 1u;
+  uint32_t nextTextureSetId = 1u;
+  uint32_t nextGeometryId = 1u;
+
+  // Pack the same order as CompareItems, CompareItems3D and CompareItems3DWithClipping into the keys
+  const bool isLayer3D = layer.GetBehavior() == Dali::Layer::LAYER_3D;
+  SortAttributes attributes;
+  for( uint32_t index = 0; index < renderableCount; ++index )
+  {
+    RenderItem& item = renderList.GetItem( index );
+
+    attributes.shader = nullptr;
+    attributes.geometry = nullptr;
+    if( item.mRenderer )
+    {
+      item.mRenderer->SetSortAttributes( bufferIndex, attributes );
+    }
+
+    const uint32_t shaderId = GetInstanceId( attributes.shader, nextShaderId );
+    const uint32_t textureSetId = GetInstanceId( item.mTextureSet, nextTextureSetId );
+    const uint32_t geometryId = GetInstanceId( attributes.geometry, nextGeometryId );
+
+    SortKey& key = mSortKeys[ index ];
+    if( isLayer3D && !item.mIsOpaque )
+    {
+      // Transparent items after the opaque ones, sorted by Z
+      const uint64_t clippingSortModifier = respectClippingOrder ? item.mNode->mClippingSortModifier : 0u;
+      const uint64_t zValue = PackZValue( Internal::Layer::ZValue( item.mModelViewMatrix.GetTranslation3() ) - static_cast<float>( item.mDepthIndex ) );
+      key.primaryKey = ( clippingSortModifier << 1u ) | 1u;
+      key.secondaryKey = ( zValue << 32u ) | PackInstances( shaderId, textureSetId, geometryId, INSTANCE_ID_BITS_WITH_Z_VALUE );
+    }
+    else
+    {
+      if( isLayer3D )
+      {
+        const uint64_t clippingSortModifier = respectClippingOrder ? item.mNode->mClippingSortModifier : 0u;
+        key.primaryKey = clippingSortModifier << 1u;
+      }
+      else
+      {
+        // Bias the depth index so it sorts as an unsigned integer
+        key.primaryKey = static_cast<uint32_t>( item.mDepthIndex ) ^ 0x80000000u;
+      }
+      key.secondaryKey = PackInstances( shaderId, textureSetId, geometryId, INSTANCE_ID_BITS );
+    }
+    key.renderItem = &item;
+  }
+
+  // A patched list keeps the order of the previous sort, so usually only a few items have to be moved.
+  // If too many have to be moved, all the keys are sorted again.
+  const bool isSorted = isMostlySorted && InsertionSortKeys( mSortKeys, renderableCount * MAXIMUM_INSERTION_SORT_MOVES_PER_ITEM );
+  if( !isSorted )
+  {
+    if( renderableCount < MINIMUM_RADIX_SORT_ITEMS )
+    {
+      std::stable_sort( mSortKeys.begin(), mSortKeys.end(), CompareKeys );
+    }
+    else
+    {
+      RadixSortKeys( mSortKeys, mSortKeysBuffer );
+    }
+  }
+
+  // Reorder / re-populate the RenderItems in the RenderList to correct order based on the keys.
+  DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "Sorted Transparent List:\n");
+  RenderItemContainer::Iterator renderListIter = renderList.GetContainer().Begin();
+  for( uint32_t index = 0; index < renderableCount; ++index, ++renderListIter )
+  {
+    *renderListIter = mSortKeys[ index ].renderItem;
+    DALI_LOG_INFO( gRenderListLogFilter, Debug::Verbose, "  sortedList[%d] = %p\n", index, mSortKeys[ index ].renderItem->mRenderer);
+  }
+}
+
 void RenderInstructionProcessor::Prepare( BufferIndex updateBufferIndex,
                                           SortedLayerPointers& sortedLayers,
                                           RenderTask& renderTask,
@@ -406,7 +911,8 @@ void RenderInstructionProcessor::Prepare( BufferIndex updateBufferIndex,
   // then populate with instructions.
   RenderInstruction& instruction = instructions.GetNextInstruction( updateBufferIndex );
   renderTask.PrepareRenderInstruction( instruction, updateBufferIndex );
-  bool viewMatrixHasNotChanged = !renderTask.ViewMatrixUpdated();
+  // The culling of cached items is only valid while the view frustum is the same
+  bool cameraHasNotChanged = !renderTask.ViewMatrixUpdated() && !renderTask.ProjectionMatrixUpdated();
   bool isRenderListAdded = false;
   bool isRootLayerDirty = false;
 
@@ -417,7 +923,8 @@ void RenderInstructionProcessor::Prepare( BufferIndex updateBufferIndex,
   for( SortedLayersIter iter = sortedLayers.begin(); iter != endIter; ++iter )
   {
     Layer& layer = **iter;
-    const bool tryReuseRenderList( viewMatrixHasNotChanged && layer.CanReuseRenderers( &renderTask.GetCamera() ) );
+    const bool tryPatchRenderList( cameraHasNotChanged && layer.CanPatchRenderers( &renderTask.GetCamera() ) );
+    const bool tryReuseRenderList( cameraHasNotChanged && layer.CanReuseRenderers( &renderTask.GetCamera() ) );
     const bool isLayer3D = layer.GetBehavior() == Dali::Layer::LAYER_3D;
     RenderList* renderList = NULL;
 
@@ -434,16 +941,24 @@ void RenderInstructionProcessor::Prepare( BufferIndex updateBufferIndex,
       if( !SetupRenderList( renderables, layer, instruction, tryReuseRenderList, &renderList ) )
       {
         renderList->SetHasColorRenderItems( true );
-        AddRenderersToRenderList( updateBufferIndex,
-                                  *renderList,
-                                  renderables,
-                                  viewMatrix,
-                                  camera,
-                                  isLayer3D,
-                                  cull );
+        const bool isPatched = tryPatchRenderList &&
+                               TryPatchCachedRenderers( updateBufferIndex, layer, *renderList, renderables, viewMatrix, camera, isLayer3D, cull );
+        if( !isPatched )
+        {
+          AddRenderersToRenderList( updateBufferIndex,
+                                    *renderList,
+                                    renderables,
+                                    viewMatrix,
+                                    camera,
+                                    isLayer3D,
+                                    cull,
+                                    layer.colorBoundingVolumes,
+                                    mBoundingSpheres,
+                                    mInsideFrustum );
+        }
 
         // We only use the clipping version of the sort comparitor if any clipping nodes exist within the RenderList.
-        SortRenderItems( updateBufferIndex, *renderList, layer, hasClippingNodes );
+        SortRenderItems( updateBufferIndex, *renderList, layer, hasClippingNodes, isPatched );
       }
 
       isRenderListAdded = true;
@@ -456,16 +971,24 @@ void RenderInstructionProcessor::Prepare( BufferIndex updateBufferIndex,
       if( !SetupRenderList( renderables, layer, instruction, tryReuseRenderList, &renderList ) )
       {
         renderList->SetHasColorRenderItems( false );
-        AddRenderersToRenderList( updateBufferIndex,
-                                  *renderList,
-                                  renderables,
-                                  viewMatrix,
-                                  camera,
-                                  isLayer3D,
-                                  cull );
+        const bool isPatched = tryPatchRenderList &&
+                               TryPatchCachedRenderers( updateBufferIndex, layer, *renderList, renderables, viewMatrix, camera, isLayer3D, cull );
+        if( !isPatched )
+        {
+          AddRenderersToRenderList( updateBufferIndex,
+                                    *renderList,
+                                    renderables,
+                                    viewMatrix,
+                                    camera,
+                                    isLayer3D,
+                                    cull,
+                                    layer.overlayBoundingVolumes,
+                                    mBoundingSpheres,
+                                    mInsideFrustum );
+        }
 
         // Clipping hierarchy is irrelevant when sorting overlay items, so we specify using the non-clipping version of the sort comparitor.
-        SortRenderItems( updateBufferIndex, *renderList, layer, false );
+        SortRenderItems( updateBufferIndex, *renderList, layer, false, isPatched );
       }
 
       isRenderListAdded = true;
@@ -22,6 +22,7 @@
 #include <dali/internal/common/buffer-index.h>
 #include <dali/internal/update/manager/sorted-layers.h>
 #include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/math/vector4.h>
 
 namespace Dali
 {
@@ -84,6 +85,26 @@ public:
     float                   zValue;            ///< The Z value of the given renderer (either distance from camera, or a custom calculated value)
   };
 
+  /**
+   * @brief Structure to store the sorting information of a renderer packed into integers,
+   * so the renderers can be radix sorted by ( primaryKey, secondaryKey ).
+   */
+  struct SortKey
+  {
+    uint64_t    primaryKey;   ///< The depth index for 2D layers, or the clipping hierarchy and transparency for 3D layers
+    uint64_t    secondaryKey; ///< The Z value in the high bits, and the ids of the shader, textureSet and geometry instances in the low bits
+    RenderItem* renderItem;   ///< The render item that is being sorted
+  };
+
+  /**
+   * @brief A slot of the hash table giving small ids to the shader, textureSet and geometry instances of the renderers being sorted
+   */
+  struct InstanceSlot
+  {
+    const void* instance;     ///< The instance, NULL if the slot is free
+    uint32_t    id;           ///< The id of the instance
+  };
+
 
   /**
    * @brief Sorts and prepares the list of opaque/transparent Renderers for each layer.
@@ -125,15 +146,40 @@ private:
    * @param renderList to sort
    * @param layer where the Renderers are from
    * @param respectClippingOrder Sort with the correct clipping hierarchy.
+   * @param isMostlySorted Whether the items are still in the order of a previous sort
+   */
+  inline void SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, bool respectClippingOrder, bool isMostlySorted );
+
+  /**
+   * @brief Sort render items of a layer using the default sort function, by packing their sorting information into integer keys
+   * @param bufferIndex The buffer to read from
+   * @param renderList to sort
+   * @param layer where the Renderers are from
+   * @param respectClippingOrder Sort with the correct clipping hierarchy.
+   * @param isMostlySorted Whether the items are still in the order of a previous sort
+   */
+  inline void SortRenderItemsByKey( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, bool respectClippingOrder, bool isMostlySorted );
+
+  /**
+   * @brief Gets the id of an instance of the renderers being sorted, giving it the next id of its kind if it hasn't got one yet
+   * @param instance The shader, textureSet or geometry instance, or NULL
+   * @param nextId The next id of the kind of the instance, incremented if the instance is given it
+   * @return The id of the instance, 0 for NULL
    */
-  inline void SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, bool respectClippingOrder );
+  inline uint32_t GetInstanceId( const void* instance, uint32_t& nextId );
 
   /// Sort comparitor function pointer type.
   typedef bool ( *ComparitorPointer )( const SortAttributes& lhs, const SortAttributes& rhs );
   typedef std::vector< SortAttributes > SortingHelper;
+  typedef std::vector< SortKey > SortKeyContainer;
 
   Dali::Vector< ComparitorPointer > mSortComparitors;       ///< Contains all sort comparitors, used for quick look-up
   RenderInstructionProcessor::SortingHelper mSortingHelper; ///< Helper used to sort Renderers
+  SortKeyContainer mSortKeys;                               ///< The keys of the Renderers sorted by key
+  SortKeyContainer mSortKeysBuffer;                         ///< Scratch buffer for the radix sort of the keys
+  Dali::Vector< Vector4 > mBoundingSpheres;                 ///< Scratch buffer for the bounding spheres of the Renderers being culled
+  Dali::Vector< bool > mInsideFrustum;                      ///< Scratch buffer for the culling results of the Renderers
+  Dali::Vector< InstanceSlot > mInstanceSlots;              ///< Scratch hash table of the ids of the instances of the Renderers being sorted
 
 };
 
@@ -18,8 +18,12 @@
 // CLASS HEADER
 #include <dali/internal/update/manager/render-task-processor.h>
 
+// EXTERNAL INCLUDES
+#include <vector>
+
 // INTERNAL INCLUDES
 #include <dali/internal/update/manager/sorted-layers.h>
+#include <dali/internal/update/nodes/flattened-node-tree.h>
 #include <dali/internal/update/render-tasks/scene-graph-render-task.h>
 #include <dali/internal/update/render-tasks/scene-graph-render-task-list.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
@@ -82,118 +86,140 @@ Layer* FindLayer( Node& node )
   return NULL;
 }
 
+typedef RenderTaskProcessor::InheritedState InheritedState;
+typedef RenderTaskProcessor::InheritedStateContainer InheritedStateContainer;
+
 /**
  * Rebuild the Layer::colorRenderables and overlayRenderables members,
  * including only renderers which are included in the current render-task.
  *
  * @param[in]  updateBufferIndex The current update buffer index.
- * @param[in]  node The current node of the scene-graph.
- * @param[in]  currentLayer The current layer containing lists of opaque/transparent renderables.
+ * @param[in]  nodeTree The nodes of the scene-graph in depth first order.
+ * @param[in]  sourceIndex The index of the entry of the source node of the render-task.
+ * @param[in]  sourceLayer The layer containing lists of opaque/transparent renderables of the source node.
  * @param[in]  renderTask The current render-task.
- * @param[in]  inheritedDrawMode The draw mode of the parent
- * @param[in]  parentDepthIndex The inherited parent node depth index
  * @param[in]  currentClippingId The current Clipping Id
- *               Note: ClippingId is passed by reference, so it is permanently modified when traversing back up the tree for uniqueness.
- * @param[in]  clippingDepth The current stencil clipping depth
- * @param[in]  clippingDepth The current scissor clipping depth
+ *               Note: ClippingId is passed by reference, so it is permanently modified when traversing the tree for uniqueness.
  * @param[out] clippingUsed  Gets set to true if any clipping nodes have been found
+ * @param[in]  states The container for the inherited states, reused between render-tasks.
  * @return true if rendering should be kept, false otherwise.
  */
 bool AddRenderablesForTask( BufferIndex updateBufferIndex,
-                            Node& node,
-                            Layer& currentLayer,
+                            const FlattenedNodeTree& nodeTree,
+                            uint32_t sourceIndex,
+                            Layer& sourceLayer,
                             RenderTask& renderTask,
-                            int inheritedDrawMode,
                             uint32_t& currentClippingId,
-                            uint32_t clippingDepth,
-                            uint32_t scissorDepth,
-                            bool& clippingUsed )
+                            bool& clippingUsed,
+                            InheritedStateContainer& states )
 {
   bool keepRendering = false;
 
-  // Short-circuit for invisible nodes
-  if( !node.IsVisible( updateBufferIndex ) )
+  // The nodes at depth baseDepth + n inherit the values stored in states[n]
+  const uint32_t baseDepth = nodeTree[sourceIndex].depth;
+  if( states.empty() )
   {
-    return keepRendering;
+    states.resize( 1u );
   }
+  states[0] = { &sourceLayer, nodeTree[sourceIndex].node->GetDrawMode(), 0u, 0u };
 
-  // Check whether node is exclusive to a different render-task
-  const RenderTask* exclusiveTo = node.GetExclusiveRenderTask();
-  if( exclusiveTo && ( exclusiveTo != &renderTask ) )
+  const uint32_t end = sourceIndex + nodeTree[sourceIndex].subtreeSize;
+  for( uint32_t i = sourceIndex; i < end; )
   {
-    return keepRendering;
-  }
+    const FlattenedNodeTree::Entry& entry = nodeTree[i];
+    Node* node = entry.node;
 
-  // Assume all children go to this layer (if this node is a layer).
-  Layer* layer = node.GetLayer();
-  if( layer )
-  {
-    // Layers do not inherit the DrawMode from their parents
-    inheritedDrawMode = node.GetDrawMode();
-  }
-  else
-  {
-    // This node is not a layer.
-    layer = &currentLayer;
-    inheritedDrawMode |= node.GetDrawMode();
-  }
+    // Short-circuit for disconnected and invisible nodes
+    if( !node || !node->IsVisible( updateBufferIndex ) )
+    {
+      i += entry.subtreeSize;
+      continue;
+    }
 
-  DALI_ASSERT_DEBUG( NULL != layer );
+    // Check whether node is exclusive to a different render-task
+    const RenderTask* exclusiveTo = node->GetExclusiveRenderTask();
+    if( exclusiveTo && ( exclusiveTo != &renderTask ) )
+    {
+      i += entry.subtreeSize;
+      continue;
+    }
 
-  const uint32_t count = node.GetRendererCount();
+    const uint32_t level = entry.depth - baseDepth;
+    const InheritedState& parent = states[level];
 
-  // Update the clipping Id and depth for this node (if clipping is enabled).
-  const Dali::ClippingMode::Type clippingMode = node.GetClippingMode();
-  if( DALI_UNLIKELY( clippingMode != ClippingMode::DISABLED ) )
-  {
-    if( DALI_LIKELY( clippingMode == ClippingMode::CLIP_TO_BOUNDING_BOX ) )
+    // Assume all children go to this layer (if this node is a layer).
+    int inheritedDrawMode;
+    Layer* layer = node->GetLayer();
+    if( layer )
     {
-      ++scissorDepth;        // This only modifies the local value (which is passed in when the method recurses).
-      // If we do not have any renderers, create one to house the scissor operation.
-      if( count == 0u )
-      {
-        layer->colorRenderables.PushBack( Renderable( &node, nullptr ) );
-      }
+      // Layers do not inherit the DrawMode from their parents
+      inheritedDrawMode = node->GetDrawMode();
     }
     else
     {
-      // We only need clipping Id for stencil clips. This means we can deliberately avoid modifying it for bounding box clips,
-      // thus allowing bounding box clipping to still detect clip depth changes without turning on the stencil buffer for non-clipped nodes.
-      ++currentClippingId;   // This modifies the reference passed in as well as the local value, causing the value to be global to the recursion.
-      ++clippingDepth;       // This only modifies the local value (which is passed in when the method recurses).
+      // This node is not a layer.
+      layer = parent.layer;
+      inheritedDrawMode = parent.drawMode | node->GetDrawMode();
     }
-    clippingUsed = true;
-  }
-  // Set the information in the node.
-  node.SetClippingInformation( currentClippingId, clippingDepth, scissorDepth );
 
-  for( uint32_t i = 0; i < count; ++i )
-  {
-    SceneGraph::Renderer* renderer = node.GetRendererAt( i );
+    DALI_ASSERT_DEBUG( NULL != layer );
+
+    const uint32_t count = node->GetRendererCount();
 
-    // Normal is the more-likely draw mode to occur.
-    if( DALI_LIKELY( inheritedDrawMode == DrawMode::NORMAL ) )
+    // Update the clipping Id and depth for this node (if clipping is enabled).
+    uint32_t clippingDepth = parent.clippingDepth;
+    uint32_t scissorDepth = parent.scissorDepth;
+    const Dali::ClippingMode::Type clippingMode = node->GetClippingMode();
+    if( DALI_UNLIKELY( clippingMode != ClippingMode::DISABLED ) )
     {
-      layer->colorRenderables.PushBack( Renderable( &node, renderer ) );
+      if( DALI_LIKELY( clippingMode == ClippingMode::CLIP_TO_BOUNDING_BOX ) )
+      {
+        ++scissorDepth;        // This only modifies the value inherited by the children of the node.
+        // If we do not have any renderers, create one to house the scissor operation.
+        if( count == 0u )
+        {
+          layer->colorRenderables.PushBack( Renderable( node, nullptr ) );
+        }
+      }
+      else
+      {
+        // We only need clipping Id for stencil clips. This means we can deliberately avoid modifying it for bounding box clips,
+        // thus allowing bounding box clipping to still detect clip depth changes without turning on the stencil buffer for non-clipped nodes.
+        ++currentClippingId;   // This modifies the reference passed in as well as the local value, causing the value to be global to the traversal.
+        ++clippingDepth;       // This only modifies the value inherited by the children of the node.
+      }
+      clippingUsed = true;
     }
-    else
+    // Set the information in the node.
+    node->SetClippingInformation( currentClippingId, clippingDepth, scissorDepth );
+
+    for( uint32_t rendererIndex = 0; rendererIndex < count; ++rendererIndex )
     {
-      layer->overlayRenderables.PushBack( Renderable( &node, renderer ) );
+      SceneGraph::Renderer* renderer = node->GetRendererAt( rendererIndex );
+
+      // Normal is the more-likely draw mode to occur.
+      if( DALI_LIKELY( inheritedDrawMode == DrawMode::NORMAL ) )
+      {
+        layer->colorRenderables.PushBack( Renderable( node, renderer ) );
+      }
+      else
+      {
+        layer->overlayRenderables.PushBack( Renderable( node, renderer ) );
+      }
+
+      if( renderer->GetRenderingBehavior() == DevelRenderer::Rendering::CONTINUOUSLY )
+      {
+        keepRendering = true;
+      }
     }
 
-    if( renderer->GetRenderingBehavior() == DevelRenderer::Rendering::CONTINUOUSLY )
+    // The children follow the node.
+    if( states.size() <= level + 1u )
     {
-      keepRendering = true;
+      states.resize( level + 2u );
     }
-  }
-
-  // Recurse children.
-  NodeContainer& children = node.GetChildren();
-  const NodeIter endIter = children.End();
-  for( NodeIter iter = children.Begin(); iter != endIter; ++iter )
-  {
-    Node& child = **iter;
-    keepRendering |= AddRenderablesForTask( updateBufferIndex, child, *layer, renderTask, inheritedDrawMode, currentClippingId, clippingDepth, scissorDepth, clippingUsed );
+    states[level + 1u] = { layer, inheritedDrawMode, clippingDepth, scissorDepth };
+    ++i;
   }
 
   return keepRendering;
@@ -205,24 +231,26 @@ bool AddRenderablesForTask( BufferIndex updateBufferIndex,
  * If there is only one default render-task, then no further processing is required.
  * @param[in]  updateBufferIndex          The current update buffer index.
  * @param[in]  taskContainer              The container of render-tasks.
- * @param[in]  rootNode                   The root node of the scene-graph.
+ * @param[in]  nodeTree                   The nodes of the scene-graph in depth first order.
  * @param[in]  sortedLayers               The layers containing lists of opaque / transparent renderables.
  * @param[out] instructions               The instructions for rendering the next frame.
  * @param[in]  renderInstructionProcessor An instance of the RenderInstructionProcessor used to sort and handle the renderers for each layer.
  * @param[in]  renderToFboEnabled         Whether rendering into the Frame Buffer Object is enabled (used to measure FPS above 60)
  * @param[in]  isRenderingToFbo           Whether this frame is being rendered into the Frame Buffer Object (used to measure FPS above 60)
  * @param[in]  processOffscreen           Whether the offscreen render tasks are the ones processed. Otherwise it processes the onscreen tasks.
+ * @param[in]  states                     The container for the inherited states, reused between render-tasks.
  * @return true if rendering should be kept, false otherwise.
  */
 bool ProcessTasks( BufferIndex updateBufferIndex,
                    RenderTaskList::RenderTaskContainer& taskContainer,
-                   Layer& rootNode,
+                   const FlattenedNodeTree& nodeTree,
                    SortedLayerPointers& sortedLayers,
                    RenderInstructionContainer& instructions,
                    RenderInstructionProcessor& renderInstructionProcessor,
                    bool renderToFboEnabled,
                    bool isRenderingToFbo,
-                   bool processOffscreen )
+                   bool processOffscreen,
+                   InheritedStateContainer& states )
 {
   uint32_t clippingId = 0u;
   bool hasClippingNodes = false;
@@ -265,6 +293,13 @@ bool ProcessTasks( BufferIndex updateBufferIndex,
       continue;
     }
 
+    uint32_t sourceIndex = 0u;
+    if( !nodeTree.FindNode( *sourceNode, sourceIndex ) )
+    {
+      // Skip to next task as the source node is not connected to the scene-graph.
+      continue;
+    }
+
     const uint32_t currentNumberOfInstructions = instructions.Count( updateBufferIndex );
 
     if( renderTask.IsRenderRequired() )
@@ -275,14 +310,13 @@ bool ProcessTasks( BufferIndex updateBufferIndex,
       }
 
       keepRendering |= AddRenderablesForTask( updateBufferIndex,
-                                              *sourceNode,
+                                              nodeTree,
+                                              sourceIndex,
                                               *layer,
                                               renderTask,
-                                              sourceNode->GetDrawMode(),
                                               clippingId,
-                                              0u,
-                                              0u,
-                                              hasClippingNodes );
+                                              hasClippingNodes,
+                                              states );
 
       renderInstructionProcessor.Prepare( updateBufferIndex,
                                           sortedLayers,
@@ -319,7 +353,7 @@ RenderTaskProcessor::~RenderTaskProcessor()
 
 bool RenderTaskProcessor::Process( BufferIndex updateBufferIndex,
                                    RenderTaskList& renderTasks,
-                                   Layer& rootNode,
+                                   const FlattenedNodeTree& nodeTree,
                                    SortedLayerPointers& sortedLayers,
                                    RenderInstructionContainer& instructions,
                                    bool renderToFboEnabled,
@@ -346,13 +380,14 @@ bool RenderTaskProcessor::Process( BufferIndex updateBufferIndex,
 
   keepRendering = ProcessTasks( updateBufferIndex,
                                 taskContainer,
-                                rootNode,
+                                nodeTree,
                                 sortedLayers,
                                 instructions,
                                 mRenderInstructionProcessor,
                                 renderToFboEnabled,
                                 isRenderingToFbo,
-                                true );
+                                true,
+                                mInheritedStates );
 
   DALI_LOG_INFO( gRenderTaskLogFilter, Debug::General, "RenderTaskProcessor::Process() Onscreen\n" );
 
@@ -361,13 +396,14 @@ bool RenderTaskProcessor::Process( BufferIndex updateBufferIndex,
 
   keepRendering |= ProcessTasks( updateBufferIndex,
                                  taskContainer,
-                                 rootNode,
+                                 nodeTree,
                                  sortedLayers,
                                  instructions,
                                  mRenderInstructionProcessor,
                                  renderToFboEnabled,
                                  isRenderingToFbo,
-                                 false );
+                                 false,
+                                 mInheritedStates );
 
   return keepRendering;
 }
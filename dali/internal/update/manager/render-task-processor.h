@@ -19,6 +19,7 @@
  */
 
 // INTERNAL INCLUDES
+#include <dali/public-api/common/vector-wrapper.h>
 #include <dali/internal/update/manager/sorted-layers.h>
 #include <dali/internal/update/manager/render-instruction-processor.h>
 
@@ -31,6 +32,7 @@ namespace Internal
 namespace SceneGraph
 {
 
+class FlattenedNodeTree;
 class RenderTaskList;
 
 /**
@@ -40,6 +42,19 @@ class RenderTaskProcessor
 {
 public:
 
+  /**
+   * The values which the children of a node inherit from it
+   */
+  struct InheritedState
+  {
+    Layer* layer;           ///< The layer of the node
+    int drawMode;           ///< The draw mode of the node
+    uint32_t clippingDepth; ///< The stencil clipping depth of the node
+    uint32_t scissorDepth;  ///< The scissor clipping depth of the node
+  };
+
+  typedef std::vector< InheritedState > InheritedStateContainer;
+
   /**
    * @brief Constructor.
    */
@@ -56,7 +71,7 @@ public:
    * If there is only one default render-task, then no further processing is required.
    * @param[in]  updateBufferIndex  The current update buffer index.
    * @param[in]  renderTasks        The list of render-tasks.
-   * @param[in]  rootNode           The root node of the scene-graph.
+   * @param[in]  nodeTree           The nodes of the scene-graph in depth first order.
    * @param[in]  sortedLayers       The layers containing lists of opaque / transparent renderables.
    * @param[out] instructions       The instructions for rendering the next frame.
    * @param[in]  renderToFboEnabled Whether rendering into the Frame Buffer Object is enabled (used to measure FPS above 60)
@@ -65,7 +80,7 @@ public:
    */
   bool Process( BufferIndex updateBufferIndex,
                 RenderTaskList& renderTasks,
-                Layer& rootNode,
+                const FlattenedNodeTree& nodeTree,
                 SortedLayerPointers& sortedLayers,
                 RenderInstructionContainer& instructions,
                 bool renderToFboEnabled,
@@ -82,6 +97,7 @@ private:
 private:
 
   RenderInstructionProcessor mRenderInstructionProcessor; ///< An instance of the RenderInstructionProcessor used to sort and handle the renderers for each layer.
+  InheritedStateContainer mInheritedStates;               ///< The states inherited at each depth of a traversal, kept to avoid allocating them for every render-task
 };
 
 
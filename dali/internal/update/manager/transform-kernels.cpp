@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/manager/transform-kernels.h>
+
+// EXTERNAL INCLUDES
+#include <cmath>
+
+#if defined( __SSE__ )
+#include <xmmintrin.h>
+#elif defined( __ARM_NEON__ ) || defined( __ARM_NEON )
+#include <arm_neon.h>
+#endif
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/constants.h>
+#include <dali/public-api/math/matrix.h>
+#include <dali/public-api/math/quaternion.h>
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/math/vector4.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+namespace TransformKernels
+{
+
+namespace
+{
+
+/**
+ * Minimal four-wide float vector used to write the kernels once for every instruction set.
+ * Only element-wise IEEE operations are used so every lane gets the same result as the scalar code.
+ */
+#if defined( __SSE__ )
+
+typedef __m128 Float4;
+typedef __m128 Mask4;
+
+inline Float4 Load( const float* values )                    { return _mm_loadu_ps( values ); }
+inline void   Store( float* values, Float4 v )               { _mm_storeu_ps( values, v ); }
+inline Float4 Set( float a, float b, float c, float d )      { return _mm_setr_ps( a, b, c, d ); }
+inline Float4 Splat( float value )                           { return _mm_set1_ps( value ); }
+inline Float4 Add( Float4 a, Float4 b )                      { return _mm_add_ps( a, b ); }
+inline Float4 Sub( Float4 a, Float4 b )                      { return _mm_sub_ps( a, b ); }
+inline Float4 Mul( Float4 a, Float4 b )                      { return _mm_mul_ps( a, b ); }
+inline Float4 Sqrt( Float4 a )                               { return _mm_sqrt_ps( a ); }
+inline Mask4  MakeMask( bool a, bool b, bool c, bool d )    { return _mm_cmpneq_ps( _mm_setr_ps( a, b, c, d ), _mm_setzero_ps() ); }
+inline Float4 Select( Mask4 mask, Float4 a, Float4 b )       { return _mm_or_ps( _mm_and_ps( mask, a ), _mm_andnot_ps( mask, b ) ); }
+inline Mask4  Less( Float4 a, Float4 b )                     { return _mm_cmplt_ps( a, b ); }
+inline Mask4  Or( Mask4 a, Mask4 b )                         { return _mm_or_ps( a, b ); }
+inline uint32_t MaskBits( Mask4 mask )                       { return static_cast<uint32_t>( _mm_movemask_ps( mask ) ); }
+inline void   Transpose( Float4& r0, Float4& r1, Float4& r2, Float4& r3 ) { _MM_TRANSPOSE4_PS( r0, r1, r2, r3 ); }
+
+#elif defined( __ARM_NEON__ ) || defined( __ARM_NEON )
+
+typedef float32x4_t Float4;
+typedef uint32x4_t  Mask4;
+
+inline Float4 Load( const float* values )                    { return vld1q_f32( values ); }
+inline void   Store( float* values, Float4 v )               { vst1q_f32( values, v ); }
+inline Float4 Set( float a, float b, float c, float d )      { const float values[] = { a, b, c, d }; return vld1q_f32( values ); }
+inline Float4 Splat( float value )                           { return vdupq_n_f32( value ); }
+inline Float4 Add( Float4 a, Float4 b )                      { return vaddq_f32( a, b ); }
+inline Float4 Sub( Float4 a, Float4 b )                      { return vsubq_f32( a, b ); }
+inline Float4 Mul( Float4 a, Float4 b )                      { return vmulq_f32( a, b ); }
+inline Mask4  MakeMask( bool a, bool b, bool c, bool d )    { const uint32_t values[] = { a ? ~0u : 0u, b ? ~0u : 0u, c ? ~0u : 0u, d ? ~0u : 0u }; return vld1q_u32( values ); }
+inline Float4 Select( Mask4 mask, Float4 a, Float4 b )       { return vbslq_f32( mask, a, b ); }
+inline Mask4  Less( Float4 a, Float4 b )                     { return vcltq_f32( a, b ); }
+inline Mask4  Or( Mask4 a, Mask4 b )                         { return vorrq_u32( a, b ); }
+
+inline uint32_t MaskBits( Mask4 mask )
+{
+  uint32_t values[4];
+  vst1q_u32( values, mask );
+  return ( values[0] & 1u ) | ( values[1] & 2u ) | ( values[2] & 4u ) | ( values[3] & 8u );
+}
+
+inline Float4 Sqrt( Float4 a )
+{
+  // ARMv7 NEON only has a reciprocal square root estimate, so use the correctly rounded scalar one
+  float values[4];
+  vst1q_f32( values, a );
+  return Set( sqrtf( values[0] ), sqrtf( values[1] ), sqrtf( values[2] ), sqrtf( values[3] ) );
+}
+
+inline void Transpose( Float4& r0, Float4& r1, Float4& r2, Float4& r3 )
+{
+  const float32x4x2_t t01 = vtrnq_f32( r0, r1 );
+  const float32x4x2_t t23 = vtrnq_f32( r2, r3 );
+  r0 = vcombine_f32( vget_low_f32( t01.val[0] ), vget_low_f32( t23.val[0] ) );
+  r1 = vcombine_f32( vget_low_f32( t01.val[1] ), vget_low_f32( t23.val[1] ) );
+  r2 = vcombine_f32( vget_high_f32( t01.val[0] ), vget_high_f32( t23.val[0] ) );
+  r3 = vcombine_f32( vget_high_f32( t01.val[1] ), vget_high_f32( t23.val[1] ) );
+}
+
+#else
+
+struct Float4
+{
+  float v[4];
+};
+
+struct Mask4
+{
+  bool v[4];
+};
+
+inline Float4 Load( const float* values )                    { return Float4{ { values[0], values[1], values[2], values[3] } }; }
+inline void   Store( float* values, Float4 a )               { values[0] = a.v[0]; values[1] = a.v[1]; values[2] = a.v[2]; values[3] = a.v[3]; }
+inline Float4 Set( float a, float b, float c, float d )      { return Float4{ { a, b, c, d } }; }
+inline Float4 Splat( float value )                           { return Float4{ { value, value, value, value } }; }
+inline Float4 Add( Float4 a, Float4 b )                      { return Float4{ { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] } }; }
+inline Float4 Sub( Float4 a, Float4 b )                      { return Float4{ { a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3] } }; }
+inline Float4 Mul( Float4 a, Float4 b )                      { return Float4{ { a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] } }; }
+inline Float4 Sqrt( Float4 a )                               { return Float4{ { sqrtf( a.v[0] ), sqrtf( a.v[1] ), sqrtf( a.v[2] ), sqrtf( a.v[3] ) } }; }
+inline Mask4  MakeMask( bool a, bool b, bool c, bool d )    { return Mask4{ { a, b, c, d } }; }
+inline Mask4  Less( Float4 a, Float4 b )                     { return Mask4{ { a.v[0] < b.v[0], a.v[1] < b.v[1], a.v[2] < b.v[2], a.v[3] < b.v[3] } }; }
+inline Mask4  Or( Mask4 a, Mask4 b )                         { return Mask4{ { a.v[0] || b.v[0], a.v[1] || b.v[1], a.v[2] || b.v[2], a.v[3] || b.v[3] } }; }
+inline uint32_t MaskBits( Mask4 mask )                       { return ( mask.v[0] ? 1u : 0u ) | ( mask.v[1] ? 2u : 0u ) | ( mask.v[2] ? 4u : 0u ) | ( mask.v[3] ? 8u : 0u ); }
+
+inline Float4 Select( Mask4 mask, Float4 a, Float4 b )
+{
+  return Float4{ { mask.v[0] ? a.v[0] : b.v[0], mask.v[1] ? a.v[1] : b.v[1], mask.v[2] ? a.v[2] : b.v[2], mask.v[3] ? a.v[3] : b.v[3] } };
+}
+
+inline void Transpose( Float4& r0, Float4& r1, Float4& r2, Float4& r3 )
+{
+  const Float4 t0 = r0, t1 = r1, t2 = r2, t3 = r3;
+  r0 = Set( t0.v[0], t1.v[0], t2.v[0], t3.v[0] );
+  r1 = Set( t0.v[1], t1.v[1], t2.v[1], t3.v[1] );
+  r2 = Set( t0.v[2], t1.v[2], t2.v[2], t3.v[2] );
+  r3 = Set( t0.v[3], t1.v[3], t2.v[3], t3.v[3] );
+}
+
+#endif
+
+} // unnamed namespace
+
+void ComposeTransforms( Matrix* const matrices[BATCH_SIZE],
+                        const Vector3* const scales[BATCH_SIZE],
+                        const Quaternion* const orientations[BATCH_SIZE],
+                        const Vector3 positions[BATCH_SIZE] )
+{
+  // Transpose the orientations so each register holds the same component of the four quaternions
+  Float4 x = Load( orientations[0]->mVector.AsFloat() );
+  Float4 y = Load( orientations[1]->mVector.AsFloat() );
+  Float4 z = Load( orientations[2]->mVector.AsFloat() );
+  Float4 w = Load( orientations[3]->mVector.AsFloat() );
+  Transpose( x, y, z, w );
+
+  const Float4 scaleX = Set( scales[0]->x, scales[1]->x, scales[2]->x, scales[3]->x );
+  const Float4 scaleY = Set( scales[0]->y, scales[1]->y, scales[2]->y, scales[3]->y );
+  const Float4 scaleZ = Set( scales[0]->z, scales[1]->z, scales[2]->z, scales[3]->z );
+
+  const Float4 xx = Mul( x, x );
+  const Float4 yy = Mul( y, y );
+  const Float4 zz = Mul( z, z );
+  const Float4 xy = Mul( x, y );
+  const Float4 xz = Mul( x, z );
+  const Float4 wx = Mul( w, x );
+  const Float4 wy = Mul( w, y );
+  const Float4 wz = Mul( w, z );
+  const Float4 yz = Mul( y, z );
+
+  const Float4 one = Splat( 1.0f );
+  const Float4 two = Splat( 2.0f );
+  const Float4 zero = Splat( 0.0f );
+
+  // Matrix::SetTransformComponents() only uses the scale when the rotation is the identity
+  const Mask4 identity = MakeMask( orientations[0]->IsIdentity(), orientations[1]->IsIdentity(), orientations[2]->IsIdentity(), orientations[3]->IsIdentity() );
+
+  Float4 m0  = Select( identity, scaleX, Mul( scaleX, Sub( one, Mul( two, Add( yy, zz ) ) ) ) );
+  Float4 m1  = Select( identity, zero,   Mul( scaleX, Mul( two, Add( xy, wz ) ) ) );
+  Float4 m2  = Select( identity, zero,   Mul( scaleX, Mul( two, Sub( xz, wy ) ) ) );
+  Float4 m3  = zero;
+
+  Float4 m4  = Select( identity, zero,   Mul( scaleY, Mul( two, Sub( xy, wz ) ) ) );
+  Float4 m5  = Select( identity, scaleY, Mul( scaleY, Sub( one, Mul( two, Add( xx, zz ) ) ) ) );
+  Float4 m6  = Select( identity, zero,   Mul( scaleY, Mul( two, Add( yz, wx ) ) ) );
+  Float4 m7  = zero;
+
+  Float4 m8  = Select( identity, zero,   Mul( scaleZ, Mul( two, Add( xz, wy ) ) ) );
+  Float4 m9  = Select( identity, zero,   Mul( scaleZ, Mul( two, Sub( yz, wx ) ) ) );
+  Float4 m10 = Select( identity, scaleZ, Mul( scaleZ, Sub( one, Mul( two, Add( xx, yy ) ) ) ) );
+  Float4 m11 = zero;
+
+  // Transpose back so each register holds a column of one of the matrices
+  Transpose( m0, m1, m2, m3 );
+  Transpose( m4, m5, m6, m7 );
+  Transpose( m8, m9, m10, m11 );
+
+  const Float4 columns[3][BATCH_SIZE] = { { m0, m1, m2, m3 }, { m4, m5, m6, m7 }, { m8, m9, m10, m11 } };
+  for( uint32_t i = 0u; i < BATCH_SIZE; ++i )
+  {
+    float* matrix = matrices[i]->AsFloat();
+    Store( matrix,     columns[0][i] );
+    Store( matrix + 4, columns[1][i] );
+    Store( matrix + 8, columns[2][i] );
+    matrix[12] = positions[i].x;
+    matrix[13] = positions[i].y;
+    matrix[14] = positions[i].z;
+    matrix[15] = 1.0f;
+  }
+}
+
+void Multiply( Matrix& result, const Matrix& lhs, const Matrix& rhs )
+{
+  const float* lhsPtr = lhs.AsFloat();
+  const float* rhsPtr = rhs.AsFloat();
+  float* resultPtr = result.AsFloat();
+
+  const Float4 rhs0 = Load( rhsPtr );
+  const Float4 rhs1 = Load( rhsPtr + 4 );
+  const Float4 rhs2 = Load( rhsPtr + 8 );
+  const Float4 rhs3 = Load( rhsPtr + 12 );
+
+  // Same order of operations as Matrix::Multiply(); result may alias lhs, so compute all columns first
+  Float4 columns[4];
+  for( uint32_t i = 0u; i < 4u; ++i )
+  {
+    const float* lhsColumn = lhsPtr + ( i << 2 );
+    columns[i] = Add( Add( Add( Mul( Splat( lhsColumn[0] ), rhs0 ),
+                                Mul( Splat( lhsColumn[1] ), rhs1 ) ),
+                           Mul( Splat( lhsColumn[2] ), rhs2 ) ),
+                      Mul( Splat( lhsColumn[3] ), rhs3 ) );
+  }
+
+  for( uint32_t i = 0u; i < 4u; ++i )
+  {
+    Store( resultPtr + ( i << 2 ), columns[i] );
+  }
+}
+
+void ComputeBoundingSpheres( Vector4* spheres, const Matrix* worlds, const Vector3* sizes, uint32_t count )
+{
+  const Float4 half = Splat( 0.5f );
+
+  uint32_t i = 0u;
+  for( ; i + BATCH_SIZE <= count; i += BATCH_SIZE )
+  {
+    const Vector3* size = sizes + i;
+    const float* m0 = worlds[i].AsFloat();
+    const float* m1 = worlds[i + 1u].AsFloat();
+    const float* m2 = worlds[i + 2u].AsFloat();
+    const float* m3 = worlds[i + 3u].AsFloat();
+
+    const Float4 sizeX = Set( size[0].x, size[1].x, size[2].x, size[3].x );
+    const Float4 sizeY = Set( size[0].y, size[1].y, size[2].y, size[3].y );
+    const Float4 sizeZ = Set( size[0].z, size[1].z, size[2].z, size[3].z );
+    const Float4 centerToEdge = Mul( Sqrt( Add( Add( Mul( sizeX, sizeX ), Mul( sizeY, sizeY ) ), Mul( sizeZ, sizeZ ) ) ), half );
+
+    // Only the first column of the world matrix transforms the center to edge vector ( centerToEdge, 0, 0 )
+    const Float4 edgeX = Mul( centerToEdge, Set( m0[0], m1[0], m2[0], m3[0] ) );
+    const Float4 edgeY = Mul( centerToEdge, Set( m0[1], m1[1], m2[1], m3[1] ) );
+    const Float4 edgeZ = Mul( centerToEdge, Set( m0[2], m1[2], m2[2], m3[2] ) );
+
+    float radius[BATCH_SIZE];
+    Store( radius, Sqrt( Add( Add( Mul( edgeX, edgeX ), Mul( edgeY, edgeY ) ), Mul( edgeZ, edgeZ ) ) ) );
+
+    for( uint32_t j = 0u; j < BATCH_SIZE; ++j )
+    {
+      spheres[i + j] = worlds[i + j].GetTranslation();
+      spheres[i + j].w = radius[j];
+    }
+  }
+
+  for( ; i < count; ++i )
+  {
+    const float* m = worlds[i].AsFloat();
+    const float centerToEdge = sizes[i].Length() * 0.5f;
+    const float edgeX = centerToEdge * m[0];
+    const float edgeY = centerToEdge * m[1];
+    const float edgeZ = centerToEdge * m[2];
+
+    spheres[i] = worlds[i].GetTranslation();
+    spheres[i].w = sqrtf( edgeX * edgeX + edgeY * edgeY + edgeZ * edgeZ );
+  }
+}
+
+void CheckSpheresInFrustum( bool* inside, const Vector4* spheres, const Vector4 planes[FRUSTUM_PLANE_COUNT], uint32_t count )
+{
+  const Float4 zero = Splat( 0.0f );
+  const Float4 minimumRadius = Splat( Math::MACHINE_EPSILON_1000 );
+
+  uint32_t i = 0u;
+  for( ; i + BATCH_SIZE <= count; i += BATCH_SIZE )
+  {
+    // Transpose the spheres so each register holds the same component of the four spheres
+    Float4 x = Load( spheres[i].AsFloat() );
+    Float4 y = Load( spheres[i + 1u].AsFloat() );
+    Float4 z = Load( spheres[i + 2u].AsFloat() );
+    Float4 radius = Load( spheres[i + 3u].AsFloat() );
+    Transpose( x, y, z, radius );
+
+    // Same order of operations as Camera::CheckSphereInFrustum(), which all the planes are checked against
+    const Float4 negativeRadius = Sub( zero, radius );
+    Mask4 outside = Less( Add( Splat( planes[0].w ), Add( Add( Mul( Splat( planes[0].x ), x ), Mul( Splat( planes[0].y ), y ) ), Mul( Splat( planes[0].z ), z ) ) ), negativeRadius );
+    for( uint32_t plane = 1u; plane < FRUSTUM_PLANE_COUNT; ++plane )
+    {
+      const Vector4& p = planes[plane];
+      const Float4 dot = Add( Add( Mul( Splat( p.x ), x ), Mul( Splat( p.y ), y ) ), Mul( Splat( p.z ), z ) );
+      outside = Or( outside, Less( Add( Splat( p.w ), dot ), negativeRadius ) );
+    }
+
+    // Spheres are only visible if their radius is greater than the minimum, which is false for NaN
+    const uint32_t insideBits = MaskBits( Less( minimumRadius, radius ) ) & ~MaskBits( outside );
+    for( uint32_t j = 0u; j < BATCH_SIZE; ++j )
+    {
+      inside[i + j] = ( ( insideBits >> j ) & 1u ) != 0u;
+    }
+  }
+
+  for( ; i < count; ++i )
+  {
+    const Vector4& sphere = spheres[i];
+    bool isInside = ( sphere.w > Math::MACHINE_EPSILON_1000 );
+    for( uint32_t plane = 0u; isInside && plane < FRUSTUM_PLANE_COUNT; ++plane )
+    {
+      const Vector4& p = planes[plane];
+      isInside = !( ( p.w + ( p.x * sphere.x + p.y * sphere.y + p.z * sphere.z ) ) < -sphere.w );
+    }
+    inside[i] = isInside;
+  }
+}
+
+} // namespace TransformKernels
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
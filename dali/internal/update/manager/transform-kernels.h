@@ -0,0 +1,109 @@
+#ifndef DALI_INTERNAL_TRANSFORM_KERNELS_H
+#define DALI_INTERNAL_TRANSFORM_KERNELS_H
+
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+namespace Dali
+{
+
+struct Vector3;
+struct Vector4;
+class Matrix;
+class Quaternion;
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+/**
+ * Batched kernels used by the TransformManager to update its components.
+ * They use SSE or NEON when available, and a scalar implementation otherwise.
+ * The results are the same as those of the equivalent Matrix methods, which
+ * use the same order of floating point operations.
+ */
+namespace TransformKernels
+{
+
+/**
+ * Number of components processed at once by ComposeTransforms()
+ */
+static constexpr uint32_t BATCH_SIZE = 4u;
+
+/**
+ * Number of planes of a view frustum
+ */
+static constexpr uint32_t FRUSTUM_PLANE_COUNT = 6u;
+
+/**
+ * @brief Computes the transform matrices of a batch of components.
+ * Equivalent to calling matrices[i]->SetTransformComponents( *scales[i], *orientations[i], positions[i] ) for each component.
+ * @param[out] matrices The matrices to compute
+ * @param[in] scales The scales of the components
+ * @param[in] orientations The orientations of the components
+ * @param[in] positions The translations of the components
+ */
+void ComposeTransforms( Matrix* const matrices[BATCH_SIZE],
+                        const Vector3* const scales[BATCH_SIZE],
+                        const Quaternion* const orientations[BATCH_SIZE],
+                        const Vector3 positions[BATCH_SIZE] );
+
+/**
+ * @brief Multiplies two transform matrices.
+ * Equivalent to Matrix::Multiply( result, lhs, rhs ).
+ * @param[out] result The result of the multiplication
+ * @param[in] lhs The matrix on the left of the multiplication
+ * @param[in] rhs The matrix on the right of the multiplication
+ */
+void Multiply( Matrix& result, const Matrix& lhs, const Matrix& rhs );
+
+/**
+ * @brief Computes the world space bounding spheres of consecutive components.
+ * The center of a sphere is the translation of the world matrix and its radius is half
+ * the length of the size, transformed to world space.
+ * @param[out] spheres The bounding spheres of the components
+ * @param[in] worlds The world matrices of the components
+ * @param[in] sizes The sizes of the components
+ * @param[in] count The number of components
+ */
+void ComputeBoundingSpheres( Vector4* spheres, const Matrix* worlds, const Vector3* sizes, uint32_t count );
+
+/**
+ * @brief Checks whether bounding spheres are inside a view frustum.
+ * Equivalent to ( sphere.w > Math::MACHINE_EPSILON_1000 ) && camera.CheckSphereInFrustum( bufferIndex, Vector3( sphere ), sphere.w )
+ * for each sphere, except that all the planes are checked.
+ * @param[out] inside Whether each sphere is inside the frustum
+ * @param[in] spheres The bounding spheres, with the radius in w
+ * @param[in] planes The planes of the frustum, with the normal in x, y, z and the distance in w
+ * @param[in] count The number of spheres
+ */
+void CheckSpheresInFrustum( bool* inside, const Vector4* spheres, const Vector4 planes[FRUSTUM_PLANE_COUNT], uint32_t count );
+
+} // namespace TransformKernels
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_TRANSFORM_KERNELS_H
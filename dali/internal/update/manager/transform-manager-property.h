@@ -127,6 +127,12 @@ struct TransformManagerPropertyHandler : public AnimatablePropertyBase
    */
   virtual bool IsClean() const{ return false; }
 
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::GetVersion()
+   * The values are stored in the transform manager, so their changes are not tracked.
+   */
+  virtual uint32_t GetVersion( BufferIndex bufferIndex ) const{ return 0u; }
+
   /**
    * Initializes the property
    * @param[in] transformManager Pointer to the transform manager
@@ -25,7 +25,8 @@
 
 //INTERNAL INCLUDES
 #include <dali/public-api/common/constants.h>
-#include <dali/internal/common/math.h>
+#include <dali/devel-api/threading/thread-pool.h>
+#include <dali/internal/update/manager/transform-kernels.h>
 
 namespace Dali
 {
@@ -41,11 +42,16 @@ namespace
 //Default values for scale (1.0,1.0,1.0), orientation (Identity) and position (0.0,0.0,0.0)
 static const float gDefaultTransformComponentAnimatableData[] = { 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f };
 
-//Default values for anchor point (CENTER) and parent origin (TOP_LEFT)
-static const float gDefaultTransformComponentStaticData[] = { 0.5f, 0.5f, 0.5f, 0.0f, 0.0f, 0.5f, true };
-
 static_assert( sizeof(gDefaultTransformComponentAnimatableData) == sizeof(TransformComponentAnimatable), "gDefaultTransformComponentAnimatableData should have the same number of floats as specified in TransformComponentAnimatable" );
-static_assert( sizeof(gDefaultTransformComponentStaticData) == sizeof(TransformComponentStatic), "gDefaultTransformComponentStaticData should have the same number of floats as specified in TransformComponentStatic" );
+
+//Minimum number of components given to a worker thread. Smaller levels are updated on the calling thread
+static const uint32_t MINIMUM_COMPONENTS_PER_TASK = 512u;
+
+//Level of a component which hasn't been found yet when the components are sorted by level
+static const uint32_t INVALID_LEVEL = 0xffffffffu;
+
+static const Vector3 HALF( 0.5f, 0.5f, 0.5f );
+static const Vector3 TOP_LEFT( 0.0f, 0.0f, 0.5f );
 
 /**
  * @brief Calculates the center position for the transform component
@@ -75,12 +81,27 @@ inline void CalculateCenterPosition(
   }
 }
 
+/**
+ * @brief Retrieves the member of the animatable part of a transform component which stores a property
+ * @param[in] property The property; the position or scale
+ * @return The member
+ */
+Vector3 TransformComponentAnimatable::* GetAnimatableVector3Member( TransformManagerProperty property )
+{
+  DALI_ASSERT_ALWAYS( ( property == TRANSFORM_PROPERTY_POSITION || property == TRANSFORM_PROPERTY_SCALE ) && "Property can't be accessed in batches" );
+  return ( property == TRANSFORM_PROPERTY_POSITION ) ? &TransformComponentAnimatable::mPosition : &TransformComponentAnimatable::mScale;
+}
+
 } // unnamed namespace
 
 TransformManager::TransformManager()
 :mComponentCount(0),
- mReorder(false)
-{}
+ mThreadPool( nullptr ),
+ mReorder( false )
+{
+  //There is always at least one level, the one of the components without a parent
+  mLevelOffsets.PushBack( 0u );
+}
 
 TransformManager::~TransformManager()
 {}
@@ -104,14 +125,16 @@ TransformId TransformManager::CreateTransform()
     mBoundingSpheres.PushBack( Vector4(0.0f,0.0f,0.0f,0.0f) );
     mTxComponentAnimatableBaseValue.PushBack(TransformComponentAnimatable());
     mSizeBase.PushBack(Vector3(0.0f,0.0f,0.0f));
-    mComponentDirty.PushBack(false);
+    mComponentDirty.PushBack(true);
     mLocalMatrixDirty.PushBack(false);
+    mWorldMatrixDirty.PushBack(false);
+    mChildCount.PushBack(0u);
   }
   else
   {
     //Set default values
     memcpy( &mTxComponentAnimatable[mComponentCount], &gDefaultTransformComponentAnimatableData, sizeof( TransformComponentAnimatable ) );
-    memcpy( &mTxComponentStatic[mComponentCount], &gDefaultTransformComponentStaticData, sizeof( TransformComponentStatic ) );
+    mTxComponentStatic[mComponentCount] = TransformComponentStatic();
     memcpy( &mTxComponentAnimatableBaseValue[mComponentCount], &gDefaultTransformComponentAnimatableData, sizeof( TransformComponentAnimatable ) );
     mInheritanceMode[mComponentCount] = INHERIT_ALL;
     mComponentId[mComponentCount] = id;
@@ -121,47 +144,72 @@ TransformId TransformManager::CreateTransform()
     mWorld[mComponentCount].SetIdentity();
     mBoundingSpheres[mComponentCount] = Vector4(0.0f,0.0f,0.0f,0.0f);
     mSizeBase[mComponentCount] = Vector3(0.0f,0.0f,0.0f);
-    mComponentDirty[mComponentCount] = false;
+    mComponentDirty[mComponentCount] = true;
     mLocalMatrixDirty[mComponentCount] = false;
+    mWorldMatrixDirty[mComponentCount] = false;
+    mChildCount[mComponentCount] = 0u;
   }
 
+  //The new component has no parent so it belongs to the first level
   mComponentCount++;
+  if( !mReorder )
+  {
+    MoveComponent( mComponentCount - 1u, mLevelOffsets.Count() - 1u, 0u );
+  }
   return id;
 }
 
 void TransformManager::RemoveTransform(TransformId id)
 {
-  //Move the last element to the gap
-  mComponentCount--;
   TransformId index = mIds[id];
-  mTxComponentAnimatable[index] = mTxComponentAnimatable[mComponentCount];
-  mTxComponentStatic[index] = mTxComponentStatic[mComponentCount];
-  mInheritanceMode[index] = mInheritanceMode[mComponentCount];
-  mSize[index] = mSize[mComponentCount];
-  mParent[index] = mParent[mComponentCount];
-  mWorld[index] = mWorld[mComponentCount];
-  mLocal[index] = mLocal[mComponentCount];
-  mTxComponentAnimatableBaseValue[index] = mTxComponentAnimatableBaseValue[mComponentCount];
-  mSizeBase[index] = mSizeBase[mComponentCount];
-  mComponentDirty[index] = mComponentDirty[mComponentCount];
-  mLocalMatrixDirty[index] = mLocalMatrixDirty[mComponentCount];
-  mBoundingSpheres[index] = mBoundingSpheres[mComponentCount];
-
-  TransformId lastItemId = mComponentId[mComponentCount];
-  mIds[ lastItemId ] = index;
-  mComponentId[index] = lastItemId;
+  if( mParent[index] != INVALID_TRANSFORM_ID )
+  {
+    mChildCount[ mIds[ mParent[index] ] ]--;
+  }
+
+  //Move the component to the last level and swap it with the last component
+  if( !mReorder )
+  {
+    const uint32_t lastLevel = mLevelOffsets.Count() - 1u;
+    index = MoveComponent( index, GetLevel( index ), lastLevel );
+  }
+  mComponentCount--;
+  if( index != mComponentCount )
+  {
+    SwapComponents( index, mComponentCount );
+  }
   mIds.Remove( id );
 
-  mReorder = true;
+  TrimLevels();
 }
 
 void TransformManager::SetParent( TransformId id, TransformId parentId )
 {
   DALI_ASSERT_ALWAYS( id != parentId );
   TransformId index = mIds[id];
-  mParent[ index ] = parentId;
   mComponentDirty[ index ] = true;
-  mReorder = true;
+  if( mParent[ index ] == parentId )
+  {
+    return;
+  }
+
+  if( mParent[ index ] != INVALID_TRANSFORM_ID )
+  {
+    mChildCount[ mIds[ mParent[index] ] ]--;
+  }
+  mParent[ index ] = parentId;
+
+  uint32_t parentIndex = INVALID_TRANSFORM_ID;
+  if( parentId != INVALID_TRANSFORM_ID )
+  {
+    parentIndex = mIds[parentId];
+    mChildCount[ parentIndex ]++;
+  }
+
+  if( !mReorder )
+  {
+    MoveSubtree( index, parentIndex );
+  }
 }
 
 const Matrix& TransformManager::GetWorldMatrix( TransformId id ) const
@@ -221,109 +269,252 @@ void TransformManager::SetInheritOrientation( TransformId id, bool inherit )
 
 void TransformManager::ResetToBaseValue()
 {
+  //Only the components whose current value differs from the base value become dirty
+  for( uint32_t i = 0u; i < mComponentCount; ++i )
+  {
+    if( memcmp( &mTxComponentAnimatable[i], &mTxComponentAnimatableBaseValue[i], sizeof(TransformComponentAnimatable) ) != 0 )
+    {
+      mTxComponentAnimatable[i] = mTxComponentAnimatableBaseValue[i];
+      mComponentDirty[i] = true;
+    }
+
+    if( memcmp( &mSize[i], &mSizeBase[i], sizeof(Vector3) ) != 0 )
+    {
+      mSize[i] = mSizeBase[i];
+      mComponentDirty[i] = true;
+    }
+  }
+
   if( mComponentCount )
   {
-    memcpy( &mTxComponentAnimatable[0], &mTxComponentAnimatableBaseValue[0], sizeof(TransformComponentAnimatable)*mComponentCount );
-    memcpy( &mSize[0], &mSizeBase[0], sizeof(Vector3)*mComponentCount );
     memset( &mLocalMatrixDirty[0], false, sizeof(bool)*mComponentCount );
   }
 }
 
+void TransformManager::SetThreadPool( Dali::ThreadPool* threadPool )
+{
+  mThreadPool = threadPool;
+}
+
 void TransformManager::Update()
 {
   if( mReorder )
   {
-    //If some transform component has change its parent or has been removed since last update
-    //we need to reorder the vectors
     ReorderComponents();
-    mReorder = false;
   }
 
-  //Iterate through all components to compute its world matrix
+  //Components of a level only depend on components of the previous levels
+  const bool parallel = mThreadPool && mThreadPool->GetWorkerCount() > 0u;
+  const uint32_t levelCount = mLevelOffsets.Count();
+  for( uint32_t level = 0u; level < levelCount; ++level )
+  {
+    const uint32_t begin = mLevelOffsets[level];
+    const uint32_t end = ( level + 1u < levelCount ) ? mLevelOffsets[level + 1u] : mComponentCount;
+    if( parallel )
+    {
+      UpdateComponentsInParallel( begin, end );
+    }
+    else
+    {
+      UpdateComponents( begin, end );
+    }
+  }
+}
+
+void TransformManager::UpdateComponents( uint32_t begin, uint32_t end )
+{
+  if( begin == end )
+  {
+    return;
+  }
+
+  //Local matrices waiting to be computed by the batched kernel
+  Matrix* batchMatrices[TransformKernels::BATCH_SIZE];
+  const Vector3* batchScales[TransformKernels::BATCH_SIZE];
+  const Quaternion* batchOrientations[TransformKernels::BATCH_SIZE];
+  Vector3 batchPositions[TransformKernels::BATCH_SIZE];
+  uint32_t batchCount = 0u;
+
+  //Compute the local matrices
   Vector3 centerPosition;
-  Vector3 localPosition;
-  const Vector3 half( 0.5f,0.5f,0.5f );
-  const Vector3 topLeft( 0.0f, 0.0f, 0.5f );
-  for( unsigned int i(0); i<mComponentCount; ++i )
+  for( uint32_t i = begin; i < end; ++i )
   {
     if( DALI_LIKELY( mInheritanceMode[i] != DONT_INHERIT_TRANSFORM && mParent[i] != INVALID_TRANSFORM_ID ) )
     {
-      const TransformId& parentIndex = mIds[mParent[i] ];
+      const TransformId parentIndex = mIds[mParent[i] ];
       if( DALI_LIKELY( mInheritanceMode[i] == INHERIT_ALL ) )
       {
-        if( mComponentDirty[i] || mLocalMatrixDirty[parentIndex])
+        if( !mComponentDirty[i] && !mLocalMatrixDirty[parentIndex] )
         {
-          //Full transform inherited
-          mLocalMatrixDirty[i] = true;
-          CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], half, topLeft );
-          localPosition = mTxComponentAnimatable[i].mPosition + centerPosition + ( mTxComponentStatic[i].mParentOrigin - half ) *  mSize[parentIndex];
-          mLocal[i].SetTransformComponents( mTxComponentAnimatable[i].mScale, mTxComponentAnimatable[i].mOrientation, localPosition );
+          //Local matrix didn't change
+          continue;
         }
 
-        //Update the world matrix
-        Matrix::Multiply( mWorld[i], mLocal[i], mWorld[parentIndex]);
+        //Full transform inherited
+        mLocalMatrixDirty[i] = true;
+        CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], HALF, TOP_LEFT );
+        batchPositions[batchCount] = mTxComponentAnimatable[i].mPosition + centerPosition + ( mTxComponentStatic[i].mParentOrigin - HALF ) *  mSize[parentIndex];
       }
       else
       {
-        //Some components are not inherited
-        Vector3 parentPosition, parentScale;
-        Quaternion parentOrientation;
-        const Matrix& parentMatrix = mWorld[parentIndex];
-        parentMatrix.GetTransformComponents( parentPosition, parentOrientation, parentScale );
-
-        Vector3 localScale = mTxComponentAnimatable[i].mScale;
-        if( (mInheritanceMode[i] & INHERIT_SCALE) == 0 )
+        //Some components are not inherited, the world matrix is computed here as well
+        mWorldMatrixDirty[i] = mComponentDirty[i] || mWorldMatrixDirty[parentIndex];
+        if( mWorldMatrixDirty[i] )
         {
-          //Don't inherit scale
-          localScale /= parentScale;
+          UpdatePartiallyInheritedComponent( i, parentIndex );
         }
+        continue;
+      }
+    }
+    else  //Component has no parent or doesn't inherit transform
+    {
+      if( !mComponentDirty[i] )
+      {
+        //Local matrix didn't change
+        continue;
+      }
 
-        Quaternion localOrientation( mTxComponentAnimatable[i].mOrientation );
-        if( (mInheritanceMode[i] & INHERIT_ORIENTATION) == 0 )
-        {
-          //Don't inherit orientation
-          parentOrientation.Invert();
-          localOrientation = parentOrientation * mTxComponentAnimatable[i].mOrientation;
-        }
+      mLocalMatrixDirty[i] = true;
+      CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], HALF, TOP_LEFT );
+      batchPositions[batchCount] = mTxComponentAnimatable[i].mPosition + centerPosition;
+    }
 
-        if( (mInheritanceMode[i] & INHERIT_POSITION) == 0 )
-        {
-          //Don't inherit position
-          CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], half, topLeft );
-          mLocal[i].SetTransformComponents( localScale, localOrientation, Vector3::ZERO );
-          Matrix::Multiply( mWorld[i], mLocal[i], parentMatrix );
-          mWorld[i].SetTranslation( mTxComponentAnimatable[i].mPosition + centerPosition );
-        }
-        else
+    batchMatrices[batchCount] = &mLocal[i];
+    batchScales[batchCount] = &mTxComponentAnimatable[i].mScale;
+    batchOrientations[batchCount] = &mTxComponentAnimatable[i].mOrientation;
+    if( ++batchCount == TransformKernels::BATCH_SIZE )
+    {
+      TransformKernels::ComposeTransforms( batchMatrices, batchScales, batchOrientations, batchPositions );
+      batchCount = 0u;
+    }
+  }
+
+  for( uint32_t j = 0u; j < batchCount; ++j )
+  {
+    batchMatrices[j]->SetTransformComponents( *batchScales[j], *batchOrientations[j], batchPositions[j] );
+  }
+
+  //Update the world matrices whose local matrix or parent's world matrix changed
+  for( uint32_t i = begin; i < end; ++i )
+  {
+    if( DALI_LIKELY( mInheritanceMode[i] != DONT_INHERIT_TRANSFORM && mParent[i] != INVALID_TRANSFORM_ID ) )
+    {
+      if( DALI_LIKELY( mInheritanceMode[i] == INHERIT_ALL ) )
+      {
+        const TransformId parentIndex = mIds[mParent[i] ];
+        mWorldMatrixDirty[i] = mLocalMatrixDirty[i] || mWorldMatrixDirty[parentIndex];
+        if( mWorldMatrixDirty[i] )
         {
-          CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], half, topLeft );
-          localPosition = mTxComponentAnimatable[i].mPosition + centerPosition + ( mTxComponentStatic[i].mParentOrigin - half ) *  mSize[parentIndex];
-          mLocal[i].SetTransformComponents( localScale, localOrientation, localPosition );
-          Matrix::Multiply( mWorld[i], mLocal[i], parentMatrix );
+          TransformKernels::Multiply( mWorld[i], mLocal[i], mWorld[parentIndex] );
         }
-
-        mLocalMatrixDirty[i] = true;
       }
     }
-    else  //Component has no parent or doesn't inherit transform
+    else
     {
-      CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], half, topLeft );
-      localPosition = mTxComponentAnimatable[i].mPosition + centerPosition;
-      mLocal[i].SetTransformComponents( mTxComponentAnimatable[i].mScale, mTxComponentAnimatable[i].mOrientation, localPosition );
-      mWorld[i] = mLocal[i];
-      mLocalMatrixDirty[i] = true;
+      mWorldMatrixDirty[i] = mLocalMatrixDirty[i];
+      if( mWorldMatrixDirty[i] )
+      {
+        mWorld[i] = mLocal[i];
+      }
+    }
+  }
+
+  //Update the bounding spheres of each run of consecutive components whose world matrix changed
+  uint32_t runBegin = begin;
+  while( runBegin < end )
+  {
+    while( runBegin < end && !mWorldMatrixDirty[runBegin] )
+    {
+      ++runBegin;
+    }
+
+    uint32_t runEnd = runBegin;
+    while( runEnd < end && mWorldMatrixDirty[runEnd] )
+    {
+      ++runEnd;
     }
 
-    //Update the bounding sphere
-    Vec3 centerToEdge = { mSize[i].Length() * 0.5f, 0.0f, 0.0f };
-    Vec3 centerToEdgeWorldSpace;
-    TransformVector3( centerToEdgeWorldSpace, mWorld[i].AsFloat(), centerToEdge );
+    if( runBegin < runEnd )
+    {
+      TransformKernels::ComputeBoundingSpheres( &mBoundingSpheres[runBegin], &mWorld[runBegin], &mSize[runBegin], runEnd - runBegin );
+    }
+    runBegin = runEnd;
+  }
+
+  memset( &mComponentDirty[begin], false, sizeof(bool) * ( end - begin ) );
+}
+
+void TransformManager::UpdatePartiallyInheritedComponent( uint32_t i, uint32_t parentIndex )
+{
+  Vector3 centerPosition;
+  Vector3 parentPosition, parentScale;
+  Quaternion parentOrientation;
+  const Matrix& parentMatrix = mWorld[parentIndex];
+  parentMatrix.GetTransformComponents( parentPosition, parentOrientation, parentScale );
+
+  Vector3 localScale = mTxComponentAnimatable[i].mScale;
+  if( (mInheritanceMode[i] & INHERIT_SCALE) == 0 )
+  {
+    //Don't inherit scale
+    localScale /= parentScale;
+  }
+
+  Quaternion localOrientation( mTxComponentAnimatable[i].mOrientation );
+  if( (mInheritanceMode[i] & INHERIT_ORIENTATION) == 0 )
+  {
+    //Don't inherit orientation
+    parentOrientation.Invert();
+    localOrientation = parentOrientation * mTxComponentAnimatable[i].mOrientation;
+  }
+
+  if( (mInheritanceMode[i] & INHERIT_POSITION) == 0 )
+  {
+    //Don't inherit position
+    CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], HALF, TOP_LEFT );
+    mLocal[i].SetTransformComponents( localScale, localOrientation, Vector3::ZERO );
+    Matrix::Multiply( mWorld[i], mLocal[i], parentMatrix );
+    mWorld[i].SetTranslation( mTxComponentAnimatable[i].mPosition + centerPosition );
+  }
+  else
+  {
+    CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], HALF, TOP_LEFT );
+    const Vector3 localPosition = mTxComponentAnimatable[i].mPosition + centerPosition + ( mTxComponentStatic[i].mParentOrigin - HALF ) *  mSize[parentIndex];
+    mLocal[i].SetTransformComponents( localScale, localOrientation, localPosition );
+    Matrix::Multiply( mWorld[i], mLocal[i], parentMatrix );
+  }
 
-    mBoundingSpheres[i] = mWorld[i].GetTranslation();
-    mBoundingSpheres[i].w = Length( centerToEdgeWorldSpace );
+  mLocalMatrixDirty[i] = true;
+}
 
-    mComponentDirty[i] = false;
+void TransformManager::UpdateComponentsInParallel( uint32_t begin, uint32_t end )
+{
+  const uint32_t count = end - begin;
+  const uint32_t taskCount = std::min( static_cast<uint32_t>( mThreadPool->GetWorkerCount() ) + 1u, count / MINIMUM_COMPONENTS_PER_TASK );
+  if( taskCount < 2u )
+  {
+    UpdateComponents( begin, end );
+    return;
   }
+
+  //The calling thread updates the last range while the workers update the others
+  const uint32_t componentsPerTask = count / taskCount;
+  std::vector< Task > tasks;
+  tasks.reserve( taskCount - 1u );
+  for( uint32_t task = 0u; task < taskCount - 1u; ++task )
+  {
+    const uint32_t taskBegin = begin + task * componentsPerTask;
+    const uint32_t taskEnd = taskBegin + componentsPerTask;
+    tasks.push_back( [this, taskBegin, taskEnd]( uint32_t /*workerIndex*/ )
+    {
+      UpdateComponents( taskBegin, taskEnd );
+    } );
+  }
+
+  UniqueFutureGroup futures = mThreadPool->SubmitTasks( tasks, static_cast<uint32_t>( tasks.size() ) );
+
+  UpdateComponents( begin + ( taskCount - 1u ) * componentsPerTask, end );
+
+  futures->Wait();
 }
 
 void TransformManager::SwapComponents( unsigned int i, unsigned int j )
@@ -338,41 +529,150 @@ void TransformManager::SwapComponents( unsigned int i, unsigned int j )
   std::swap( mSizeBase[i], mSizeBase[j] );
   std::swap( mLocal[i], mLocal[j] );
   std::swap( mComponentDirty[i], mComponentDirty[j] );
+  std::swap( mLocalMatrixDirty[i], mLocalMatrixDirty[j] );
+  std::swap( mWorldMatrixDirty[i], mWorldMatrixDirty[j] );
   std::swap( mBoundingSpheres[i], mBoundingSpheres[j] );
   std::swap( mWorld[i], mWorld[j] );
+  std::swap( mChildCount[i], mChildCount[j] );
 
   mIds[ mComponentId[i] ] = i;
   mIds[ mComponentId[j] ] = j;
 }
 
+uint32_t TransformManager::GetLevel( uint32_t index ) const
+{
+  //Empty levels share their offset with the next level, so the last level starting at or before index is the right one
+  return static_cast<uint32_t>( std::upper_bound( mLevelOffsets.Begin(), mLevelOffsets.End(), index ) - mLevelOffsets.Begin() ) - 1u;
+}
+
+uint32_t TransformManager::MoveComponent( uint32_t index, uint32_t fromLevel, uint32_t toLevel )
+{
+  //Each step swaps the component with the last component of its level, or the first, and moves the level boundary over it
+  for( ; fromLevel < toLevel; ++fromLevel )
+  {
+    if( fromLevel + 1u == mLevelOffsets.Count() )
+    {
+      mLevelOffsets.PushBack( mComponentCount );
+    }
+
+    const uint32_t last = --mLevelOffsets[fromLevel + 1u];
+    if( index != last )
+    {
+      SwapComponents( index, last );
+      index = last;
+    }
+  }
+
+  for( ; fromLevel > toLevel; --fromLevel )
+  {
+    const uint32_t first = mLevelOffsets[fromLevel]++;
+    if( index != first )
+    {
+      SwapComponents( index, first );
+      index = first;
+    }
+  }
+
+  return index;
+}
+
+void TransformManager::MoveSubtree( uint32_t index, uint32_t parentIndex )
+{
+  const uint32_t level = GetLevel( index );
+  const uint32_t newLevel = ( parentIndex != INVALID_TRANSFORM_ID ) ? GetLevel( parentIndex ) + 1u : 0u;
+  if( level == newLevel )
+  {
+    return;
+  }
+
+  if( mChildCount[index] > 0u )
+  {
+    //Finding the descendants needs a pass over the components, so all the components are sorted by level once, before the next update
+    mReorder = true;
+    return;
+  }
+
+  MoveComponent( index, level, newLevel );
+  TrimLevels();
+}
+
 void TransformManager::ReorderComponents()
 {
-  mOrderedComponents.Resize(mComponentCount);
+  //Find the level of each component. Parents may be after their children, so the levels are found walking up the hierarchy
+  mComponentLevel.Resize( mComponentCount );
+  if( mComponentCount )
+  {
+    memset( &mComponentLevel[0], 0xff, sizeof(uint32_t)*mComponentCount );
+  }
 
-  TransformId parentId;
-  for( TransformId i = 0; i<mComponentCount; ++i )
+  uint32_t levelCount = 1u;
+  for( uint32_t i = 0u; i < mComponentCount; ++i )
   {
-    mOrderedComponents[i].id = mComponentId[i];
-    mOrderedComponents[i].level = 0u;
+    //Walk up to the first ancestor whose level is known, or to the root
+    uint32_t ancestor = i;
+    uint32_t depth = 0u;
+    while( mComponentLevel[ancestor] == INVALID_LEVEL )
+    {
+      if( mParent[ancestor] == INVALID_TRANSFORM_ID )
+      {
+        mComponentLevel[ancestor] = 0u;
+        break;
+      }
+      ancestor = mIds[ mParent[ancestor] ];
+      ++depth;
+    }
 
-    parentId = mParent[i];
-    while( parentId != INVALID_TRANSFORM_ID )
+    //Set the levels of the components on the way
+    uint32_t level = mComponentLevel[ancestor] + depth;
+    levelCount = std::max( levelCount, level + 1u );
+    for( uint32_t j = i; mComponentLevel[j] == INVALID_LEVEL; j = mIds[ mParent[j] ] )
     {
-      mOrderedComponents[i].level++;
-      parentId = mParent[ mIds[parentId] ];
+      mComponentLevel[j] = level--;
     }
   }
 
-  std::stable_sort( mOrderedComponents.Begin(), mOrderedComponents.End());
-  TransformId previousIndex = 0;
-  for( TransformId newIndex = 0; newIndex < mComponentCount-1; ++newIndex )
+  //Counting sort of the components by level, which keeps the order of the components of each level.
+  //The offsets are first the ends of the levels, which move back to their beginnings as the new indices are taken
+  mLevelOffsets.Resize( levelCount );
+  memset( &mLevelOffsets[0], 0, sizeof(uint32_t)*levelCount );
+  for( uint32_t i = 0u; i < mComponentCount; ++i )
+  {
+    ++mLevelOffsets[ mComponentLevel[i] ];
+  }
+  for( uint32_t level = 1u; level < levelCount; ++level )
   {
-    previousIndex = mIds[mOrderedComponents[newIndex].id];
-    if( previousIndex != newIndex )
+    mLevelOffsets[level] += mLevelOffsets[level - 1u];
+  }
+
+  Vector< uint32_t >& newIndex = mComponentLevel;
+  for( uint32_t i = mComponentCount; i > 0u; --i )
+  {
+    newIndex[i - 1u] = --mLevelOffsets[ newIndex[i - 1u] ];
+  }
+
+  //Move each component to its new index, following the cycles of the permutation
+  for( uint32_t i = 0u; i < mComponentCount; ++i )
+  {
+    while( newIndex[i] != i )
     {
-      SwapComponents( previousIndex, newIndex);
+      const uint32_t j = newIndex[i];
+      SwapComponents( i, j );
+      std::swap( newIndex[i], newIndex[j] );
     }
   }
+
+  TrimLevels();
+  mReorder = false;
+}
+
+void TransformManager::TrimLevels()
+{
+  uint32_t levelCount = mLevelOffsets.Count();
+  while( levelCount > 1u && mLevelOffsets[levelCount - 1u] == mComponentCount )
+  {
+    --levelCount;
+  }
+  mLevelOffsets.Resize( levelCount );
 }
 
 Vector3& TransformManager::GetVector3PropertyValue( TransformId id, TransformManagerProperty property )
@@ -598,6 +898,89 @@ void TransformManager::BakeVector3PropertyValue( TransformId id, TransformManage
   }
 }
 
+void TransformManager::GetVector3PropertyValues( const TransformId* ids, uint32_t count, TransformManagerProperty property, Vector3* values ) const
+{
+  if( property == TRANSFORM_PROPERTY_SIZE )
+  {
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      if( ids[i] != INVALID_TRANSFORM_ID )
+      {
+        values[i] = mSize[ mIds[ ids[i] ] ];
+      }
+    }
+  }
+  else
+  {
+    Vector3 TransformComponentAnimatable::* member = GetAnimatableVector3Member( property );
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      if( ids[i] != INVALID_TRANSFORM_ID )
+      {
+        values[i] = mTxComponentAnimatable[ mIds[ ids[i] ] ].*member;
+      }
+    }
+  }
+}
+
+void TransformManager::SetVector3PropertyValues( const TransformId* ids, uint32_t count, TransformManagerProperty property, const Vector3* values )
+{
+  if( property == TRANSFORM_PROPERTY_SIZE )
+  {
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      if( ids[i] != INVALID_TRANSFORM_ID )
+      {
+        const TransformId index( mIds[ ids[i] ] );
+        mComponentDirty[ index ] = true;
+        mSize[ index ] = values[i];
+      }
+    }
+  }
+  else
+  {
+    Vector3 TransformComponentAnimatable::* member = GetAnimatableVector3Member( property );
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      if( ids[i] != INVALID_TRANSFORM_ID )
+      {
+        const TransformId index( mIds[ ids[i] ] );
+        mComponentDirty[ index ] = true;
+        mTxComponentAnimatable[ index ].*member = values[i];
+      }
+    }
+  }
+}
+
+void TransformManager::BakeVector3PropertyValues( const TransformId* ids, uint32_t count, TransformManagerProperty property, const Vector3* values )
+{
+  if( property == TRANSFORM_PROPERTY_SIZE )
+  {
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      if( ids[i] != INVALID_TRANSFORM_ID )
+      {
+        const TransformId index( mIds[ ids[i] ] );
+        mComponentDirty[ index ] = true;
+        mSize[ index ] = mSizeBase[ index ] = values[i];
+      }
+    }
+  }
+  else
+  {
+    Vector3 TransformComponentAnimatable::* member = GetAnimatableVector3Member( property );
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      if( ids[i] != INVALID_TRANSFORM_ID )
+      {
+        const TransformId index( mIds[ ids[i] ] );
+        mComponentDirty[ index ] = true;
+        mTxComponentAnimatable[ index ].*member = mTxComponentAnimatableBaseValue[ index ].*member = values[i];
+      }
+    }
+  }
+}
+
 void TransformManager::BakeRelativeVector3PropertyValue( TransformId id, TransformManagerProperty property, const Vector3& value )
 {
   TransformId index( mIds[id] );
@@ -29,6 +29,8 @@
 namespace Dali
 {
 
+class ThreadPool;
+
 namespace Internal
 {
 
@@ -169,6 +171,16 @@ public:
     return mLocalMatrixDirty[mIds[id]];
   }
 
+  /**
+   * Checks if the world transform was updated in the last Update
+   * @param[in] id Id of the transform
+   * @return true if world matrix changed in the last update, false otherwise
+   */
+  bool IsWorldMatrixDirty( TransformId id ) const
+  {
+    return mWorldMatrixDirty[mIds[id]];
+  }
+
   /**
    * Sets position inheritance mode.
    * @param[in] id Id of the transform
@@ -191,7 +203,15 @@ public:
   void SetInheritOrientation( TransformId id, bool inherit );
 
   /**
-   * Recomputes all world transform matrices
+   * Sets the thread pool used to recompute the world transform matrices in parallel.
+   * Components are updated one hierarchy level at a time so the results are identical to the serial update.
+   * @param[in] threadPool The thread pool to use, or nullptr to update serially. Not owned.
+   */
+  void SetThreadPool( Dali::ThreadPool* threadPool );
+
+  /**
+   * Recomputes the world transform matrices and bounding spheres of the components which changed,
+   * or whose ancestors changed, since the last update
    */
   void Update();
 
@@ -247,6 +267,33 @@ public:
    */
   void BakeVector3PropertyValue( TransformId id, TransformManagerProperty property, const Vector3& value );
 
+  /**
+   * Get the values of a Vector3 property of several transform components
+   * @param[in] ids Ids of the transform components. Components with INVALID_TRANSFORM_ID are skipped
+   * @param[in] count The number of ids
+   * @param[in] property The property; the position, scale or size
+   * @param[out] values The values, one for each id
+   */
+  void GetVector3PropertyValues( const TransformId* ids, uint32_t count, TransformManagerProperty property, Vector3* values ) const;
+
+  /**
+   * Set the values of a Vector3 property of several transform components
+   * @param[in] ids Ids of the transform components. Components with INVALID_TRANSFORM_ID are skipped
+   * @param[in] count The number of ids
+   * @param[in] property The property; the position, scale or size
+   * @param[in] values The new values, one for each id
+   */
+  void SetVector3PropertyValues( const TransformId* ids, uint32_t count, TransformManagerProperty property, const Vector3* values );
+
+  /**
+   * Bakes the values of a Vector3 property of several transform components
+   * @param[in] ids Ids of the transform components. Components with INVALID_TRANSFORM_ID are skipped
+   * @param[in] count The number of ids
+   * @param[in] property The property; the position, scale or size
+   * @param[in] values The new values, one for each id
+   */
+  void BakeVector3PropertyValues( const TransformId* ids, uint32_t count, TransformManagerProperty property, const Vector3* values );
+
   /**
    * Bakes the value of a Vector3 property relative to the current value
    * @param[in] id Id of the transform component
@@ -352,15 +399,6 @@ public:
 
 private:
 
-  //Helper struct to order components
-  struct SOrderItem
-  {
-    bool operator<(const SOrderItem& item) const {return level < item.level;}
-
-    TransformId  id;
-    uint32_t level;
-  };
-
   /**
    * Swaps two components in the vectors
    * @param[in] i Index of a component
@@ -369,11 +407,63 @@ private:
   void SwapComponents( uint32_t i, uint32_t j );
 
   /**
-   * Reorders components in hierarchical order so update can iterate sequentially
-   * updating the world transforms
+   * Gets the hierarchy level of a component
+   * @param[in] index Index of the component
+   * @return The level of the component, 0 for the components without a parent
+   */
+  uint32_t GetLevel( uint32_t index ) const;
+
+  /**
+   * Moves a component to another hierarchy level, swapping it with the components at the
+   * boundaries of the levels in between so the components stay sorted by level
+   * @param[in] index Index of the component
+   * @param[in] fromLevel Current level of the component
+   * @param[in] toLevel Level the component has to be moved to
+   * @return The new index of the component
+   */
+  uint32_t MoveComponent( uint32_t index, uint32_t fromLevel, uint32_t toLevel );
+
+  /**
+   * Moves a component to the level below a new parent. If the component has descendants, which
+   * have to be moved as well, all the components are sorted by level before the next update instead
+   * @param[in] index Index of the component
+   * @param[in] parentIndex Index of the new parent or INVALID_TRANSFORM_ID if the component has no parent
+   */
+  void MoveSubtree( uint32_t index, uint32_t parentIndex );
+
+  /**
+   * Sorts all the components by level, keeping the order of the components of each level
    */
   void ReorderComponents();
 
+  /**
+   * Removes the empty levels at the end of the level offsets, keeping at least one level
+   */
+  void TrimLevels();
+
+  /**
+   * Computes the local and world matrices and the bounding spheres of the components in the range [begin, end)
+   * @pre None of the components in the range is an ancestor of another component in the range
+   * @param[in] begin Index of the first component
+   * @param[in] end Index one past the last component
+   */
+  void UpdateComponents( uint32_t begin, uint32_t end );
+
+  /**
+   * Computes the local and world matrices of a component which doesn't inherit all of its parent's transform
+   * @param[in] i Index of the component
+   * @param[in] parentIndex Index of the parent of the component
+   */
+  void UpdatePartiallyInheritedComponent( uint32_t i, uint32_t parentIndex );
+
+  /**
+   * Updates the components in the range [begin, end) using the worker threads.
+   * @pre None of the components in the range is an ancestor of another component in the range
+   * @param[in] begin Index of the first component
+   * @param[in] end Index one past the last component
+   */
+  void UpdateComponentsInParallel( uint32_t begin, uint32_t end );
+
   uint32_t mComponentCount;                                               ///< Total number of components
   FreeList mIds;                                                          ///< FreeList of Ids
   Vector< TransformComponentAnimatable > mTxComponentAnimatable;          ///< Animatable part of the components
@@ -389,8 +479,12 @@ private:
   Vector< Vector3 > mSizeBase;                                            ///< Base value for the size of the components
   Vector< bool > mComponentDirty;                                         ///< 1u if some of the parts of the component has changed in this frame, 0 otherwise
   Vector< bool > mLocalMatrixDirty;                                       ///< 1u if the local matrix has been updated in this frame, 0 otherwise
-  Vector< SOrderItem > mOrderedComponents;                                ///< Used to reorder components when hierarchy changes
-  bool mReorder;                                                          ///< Flag to determine if the components have to reordered in the next Update
+  Vector< bool > mWorldMatrixDirty;                                       ///< 1u if the world matrix has been updated in the last Update, 0 otherwise
+  Vector< uint32_t > mChildCount;                                         ///< Number of children of the components
+  Vector< uint32_t > mLevelOffsets;                                       ///< Index of the first component of each hierarchy level. Components are sorted by level, unless mReorder is set
+  Vector< uint32_t > mComponentLevel;                                     ///< Used to find the level, then the new index, of each component when they are sorted by level
+  Dali::ThreadPool* mThreadPool;                                          ///< Thread pool used to update the components in parallel, not owned
+  bool mReorder;                                                          ///< Whether the components have to be sorted by level before the next update
 };
 
 } //namespace SceneGraph
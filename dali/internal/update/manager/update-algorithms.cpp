@@ -20,11 +20,14 @@
 
 // EXTERNAL INCLUDES
 #include <algorithm>
+#include <atomic>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/actors/draw-mode.h>
 #include <dali/public-api/math/matrix.h>
 #include <dali/public-api/math/vector3.h>
+#include <dali/devel-api/threading/thread-pool.h>
+#include <dali/internal/update/nodes/flattened-node-tree.h>
 #include <dali/internal/update/nodes/node.h>
 #include <dali/internal/update/animation/scene-graph-constraint-base.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
@@ -45,6 +48,26 @@ namespace SceneGraph
 Debug::Filter* gUpdateFilter = Debug::Filter::New(Debug::Concise, false, "LOG_UPDATE_ALGORITHMS");
 #endif
 
+namespace
+{
+
+const uint32_t MINIMUM_NODES_PER_SUBTREE_UPDATE = 64u; ///< Smaller subtrees are not worth a task of their own
+const uint32_t SUBTREE_UPDATES_PER_THREAD = 4u;       ///< Tasks per thread, so threads finishing early can take more work
+
+/**
+ * The values which the children of a node inherit from it
+ */
+struct InheritedState
+{
+  NodePropertyFlags dirtyFlags; ///< The dirty flags of the node
+  Layer* layer;                 ///< The layer of the node
+  uint32_t drawMode;            ///< The draw mode of the node
+};
+
+typedef std::vector< InheritedState > InheritedStateContainer;
+
+} // unnamed namespace
+
 /******************************************************************************
  *********************** Apply Constraints ************************************
  ******************************************************************************/
@@ -99,78 +122,191 @@ inline void UpdateNodeOpacity( Node& node, NodePropertyFlags nodeDirtyFlags, Buf
 }
 
 /**
- * This is called recursively for all children of the root Node
+ * Updates the nodes of a range of entries of the flattened tree, which contains whole subtrees.
+ * @param[in] nodeTree The nodes in depth first order
+ * @param[in] begin The index of the first entry of the range
+ * @param[in] end The index one past the last entry of the range
+ * @param[in] parentState The values inherited from the parent of the first node of the range
+ * @param[in] subtree The subtree being updated by a worker thread, or nullptr on the update thread
+ * @param[in] subtreeUpdates If not nullptr, the subtrees to update in the worker threads are added here instead of being updated
+ * @param[in] maximumSubtreeSize The number of entries up to which subtrees are added to subtreeUpdates, rather than descended into
+ * @param[in] states Used to store the values inherited by the nodes at each depth
+ * @return The cumulative (ORed) dirty flags for the updated nodes
  */
-inline NodePropertyFlags UpdateNodes( Node& node,
-                                      NodePropertyFlags parentFlags,
+inline NodePropertyFlags UpdateNodes( const FlattenedNodeTree& nodeTree,
+                                      uint32_t begin,
+                                      uint32_t end,
+                                      const InheritedState& parentState,
                                       BufferIndex updateBufferIndex,
                                       RenderQueue& renderQueue,
-                                      Layer& currentLayer,
-                                      uint32_t inheritedDrawMode )
+                                      SubtreeUpdate* subtree,
+                                      SubtreeUpdateContainer* subtreeUpdates,
+                                      uint32_t maximumSubtreeSize,
+                                      InheritedStateContainer& states )
 {
-  // Apply constraints to the node
-  ConstrainPropertyOwner( node, updateBufferIndex );
+  NodePropertyFlags cumulativeDirtyFlags = NodePropertyFlags::NOTHING;
 
-  // Short-circuit for invisible nodes
-  if ( !node.IsVisible( updateBufferIndex ) )
-  {
-    return NodePropertyFlags::NOTHING;
-  }
+  // The nodes at depth baseDepth + n inherit the values stored in states[n]
+  const uint32_t baseDepth = nodeTree[begin].depth;
+  states.resize( 1u );
+  states[0] = parentState;
 
-  // If the node was not previously visible
-  BufferIndex previousBuffer = updateBufferIndex ? 0u : 1u;
-  if ( !node.IsVisible( previousBuffer ) )
+  for( uint32_t i = begin; i < end; )
   {
-    // The node was skipped in the previous update; it must recalculate everything
-    node.SetAllDirtyFlags();
+    const FlattenedNodeTree::Entry& entry = nodeTree[i];
+    if( !entry.node )
+    {
+      // Skip the nodes disconnected since the tree was built
+      i += entry.subtreeSize;
+      continue;
+    }
+
+    Node& node = *entry.node;
+    const uint32_t level = entry.depth - baseDepth;
+    const InheritedState parent = states[level];
+
+    if( subtreeUpdates && entry.subtreeSize <= maximumSubtreeSize )
+    {
+      // Siblings following each other share a task, as long as it doesn't grow too big
+      SubtreeUpdate* previous = subtreeUpdates->empty() ? nullptr : &subtreeUpdates->back();
+      if( previous && previous->end == i && nodeTree[previous->begin].depth == entry.depth &&
+          previous->end - previous->begin + entry.subtreeSize <= maximumSubtreeSize )
+      {
+        previous->end += entry.subtreeSize;
+      }
+      else
+      {
+        subtreeUpdates->push_back( { i, i + entry.subtreeSize, parent.layer, parent.dirtyFlags, parent.drawMode, NodePropertyFlags::NOTHING, true } );
+      }
+      i += entry.subtreeSize;
+      continue;
+    }
+
+    // Short-circuit for invisible nodes
+    if ( !node.IsVisible( updateBufferIndex ) )
+    {
+      i += entry.subtreeSize;
+      continue;
+    }
+
+    // If the node was not previously visible
+    BufferIndex previousBuffer = updateBufferIndex ? 0u : 1u;
+    if ( !node.IsVisible( previousBuffer ) )
+    {
+      // The node was skipped in the previous update; it must recalculate everything
+      node.SetAllDirtyFlags();
+    }
+
+    // Some dirty flags are inherited from parent
+    NodePropertyFlags nodeDirtyFlags = node.GetInheritedDirtyFlags( parent.dirtyFlags );
+
+    cumulativeDirtyFlags |= nodeDirtyFlags;
+
+    Layer* layer = parent.layer;
+    uint32_t inheritedDrawMode = parent.drawMode;
+    Layer* nodeIsLayer( node.GetLayer() );
+    if( nodeIsLayer )
+    {
+      // all childs go to this layer
+      layer = nodeIsLayer;
+
+      // assume layer is clean to begin with
+      layer->SetReuseRenderers( updateBufferIndex, true );
+
+      // Layers do not inherit the DrawMode from their parents
+      inheritedDrawMode = DrawMode::NORMAL;
+    }
+    DALI_ASSERT_DEBUG( NULL != layer );
+
+    UpdateNodeOpacity( node, nodeDirtyFlags, updateBufferIndex );
+
+    // Draw mode inheritance is treated as or-ing the modes together (as they are a bit-mask).
+    inheritedDrawMode |= node.GetDrawMode();
+
+    node.PrepareRender( updateBufferIndex );
+
+    // if any child node has moved or had its sort modifier changed, layer is not clean and old frame cannot be reused
+    // also if node has been deleted, dont reuse old render items
+    if( nodeDirtyFlags & RenderableUpdateFlags )
+    {
+      if( subtree && layer == subtree->layer )
+      {
+        // The layer is shared with other subtrees
+        subtree->reuseRenderers = false;
+      }
+      else
+      {
+        layer->SetReuseRenderers( updateBufferIndex, false );
+      }
+    }
+
+    // The children follow the node
+    if( states.size() <= level + 1u )
+    {
+      states.resize( level + 2u );
+    }
+    states[level + 1u] = { nodeDirtyFlags, layer, inheritedDrawMode };
+    ++i;
   }
 
-  // Some dirty flags are inherited from parent
-  NodePropertyFlags nodeDirtyFlags = node.GetInheritedDirtyFlags( parentFlags );
-
-  NodePropertyFlags cumulativeDirtyFlags = nodeDirtyFlags;
+  return cumulativeDirtyFlags;
+}
 
-  Layer* layer = &currentLayer;
-  Layer* nodeIsLayer( node.GetLayer() );
-  if( nodeIsLayer )
+/**
+ * Updates the subtrees collected by UpdateNodes, using the worker threads if there are several of them
+ */
+NodePropertyFlags UpdateSubtrees( const FlattenedNodeTree& nodeTree,
+                                  SubtreeUpdateContainer& subtreeUpdates,
+                                  BufferIndex updateBufferIndex,
+                                  RenderQueue& renderQueue,
+                                  Dali::ThreadPool& threadPool )
+{
+  // The threads take the next subtree which is not updated yet, as the subtrees can have very different sizes
+  std::atomic< uint32_t > nextSubtree( 0u );
+  const uint32_t subtreeCount = static_cast<uint32_t>( subtreeUpdates.size() );
+  auto updateSubtrees = [&]( uint32_t /*workerIndex*/ )
   {
-    // all childs go to this layer
-    layer = nodeIsLayer;
-
-    // assume layer is clean to begin with
-    layer->SetReuseRenderers( updateBufferIndex, true );
-
-    // Layers do not inherit the DrawMode from their parents
-    inheritedDrawMode = DrawMode::NORMAL;
+    InheritedStateContainer states;
+    for( uint32_t i = nextSubtree++; i < subtreeCount; i = nextSubtree++ )
+    {
+      SubtreeUpdate& subtree = subtreeUpdates[i];
+      const InheritedState parentState = { subtree.parentFlags, subtree.layer, subtree.inheritedDrawMode };
+      subtree.cumulativeDirtyFlags = UpdateNodes( nodeTree,
+                                                  subtree.begin,
+                                                  subtree.end,
+                                                  parentState,
+                                                  updateBufferIndex,
+                                                  renderQueue,
+                                                  &subtree,
+                                                  nullptr,
+                                                  0u,
+                                                  states );
+    }
+  };
+
+  // The calling thread updates subtrees as well
+  const uint32_t taskCount = std::min( static_cast<uint32_t>( threadPool.GetWorkerCount() ), subtreeCount - 1u );
+  if( taskCount > 0u )
+  {
+    std::vector< Task > tasks( taskCount, updateSubtrees );
+    UniqueFutureGroup futures = threadPool.SubmitTasks( tasks, taskCount );
+    updateSubtrees( 0u );
+    futures->Wait();
   }
-  DALI_ASSERT_DEBUG( NULL != layer );
-
-  UpdateNodeOpacity( node, nodeDirtyFlags, updateBufferIndex );
-
-  // Draw mode inheritance is treated as or-ing the modes together (as they are a bit-mask).
-  inheritedDrawMode |= node.GetDrawMode();
-
-  node.PrepareRender( updateBufferIndex );
-
-  // if any child node has moved or had its sort modifier changed, layer is not clean and old frame cannot be reused
-  // also if node has been deleted, dont reuse old render items
-  if( nodeDirtyFlags & RenderableUpdateFlags )
+  else
   {
-    layer->SetReuseRenderers( updateBufferIndex, false );
+    updateSubtrees( 0u );
   }
 
-  // recurse children
-  NodeContainer& children = node.GetChildren();
-  const NodeIter endIter = children.End();
-  for ( NodeIter iter = children.Begin(); iter != endIter; ++iter )
+  // Merge the results which affect the nodes outside of the subtrees
+  NodePropertyFlags cumulativeDirtyFlags = NodePropertyFlags::NOTHING;
+  for( auto&& subtree : subtreeUpdates )
   {
-    Node& child = **iter;
-    cumulativeDirtyFlags |=UpdateNodes( child,
-                                        nodeDirtyFlags,
-                                        updateBufferIndex,
-                                        renderQueue,
-                                        *layer,
-                                        inheritedDrawMode );
+    cumulativeDirtyFlags |= subtree.cumulativeDirtyFlags;
+    if( !subtree.reuseRenderers )
+    {
+      subtree.layer->SetReuseRenderers( updateBufferIndex, false );
+    }
   }
 
   return cumulativeDirtyFlags;
@@ -180,10 +316,14 @@ inline NodePropertyFlags UpdateNodes( Node& node,
  * The root node is treated separately; it cannot inherit values since it has no parent
  */
 NodePropertyFlags UpdateNodeTree( Layer& rootNode,
+                                  const FlattenedNodeTree& nodeTree,
                                   BufferIndex updateBufferIndex,
-                                  RenderQueue& renderQueue )
+                                  RenderQueue& renderQueue,
+                                  Dali::ThreadPool* threadPool,
+                                  SubtreeUpdateContainer& subtreeUpdates )
 {
   DALI_ASSERT_DEBUG( rootNode.IsRoot() );
+  DALI_ASSERT_DEBUG( nodeTree.Count() > 0u && nodeTree[0].node == &rootNode );
 
   // Short-circuit for invisible nodes
   if ( DALI_UNLIKELY( !rootNode.IsVisible( updateBufferIndex ) ) ) // almost never ever true
@@ -207,18 +347,38 @@ NodePropertyFlags UpdateNodeTree( Layer& rootNode,
 
   DrawMode::Type drawMode( rootNode.GetDrawMode() );
 
-  // recurse children
-  NodeContainer& children = rootNode.GetChildren();
-  const NodeIter endIter = children.End();
-  for ( NodeIter iter = children.Begin(); iter != endIter; ++iter )
+  // Without worker threads the whole tree is updated here, otherwise the subtrees to update in parallel are collected
+  subtreeUpdates.clear();
+  SubtreeUpdateContainer* subtreesToSplit = nullptr;
+  uint32_t maximumSubtreeSize = 0u;
+  if( threadPool && threadPool->GetWorkerCount() > 0u )
   {
-    Node& child = **iter;
-    cumulativeDirtyFlags |= UpdateNodes( child,
-                                         nodeDirtyFlags,
+    // Nodes with bigger subtrees are updated here, so the tasks come out of similar sizes
+    const uint32_t threadCount = static_cast<uint32_t>( threadPool->GetWorkerCount() ) + 1u;
+    subtreesToSplit = &subtreeUpdates;
+    maximumSubtreeSize = std::max( MINIMUM_NODES_PER_SUBTREE_UPDATE, nodeTree.Count() / ( threadCount * SUBTREE_UPDATES_PER_THREAD ) );
+  }
+
+  // The descendants of the root follow it in the tree
+  if( nodeTree.Count() > 1u )
+  {
+    InheritedStateContainer states;
+    const InheritedState rootState = { nodeDirtyFlags, &rootNode, drawMode };
+    cumulativeDirtyFlags |= UpdateNodes( nodeTree,
+                                         1u,
+                                         nodeTree.Count(),
+                                         rootState,
                                          updateBufferIndex,
                                          renderQueue,
-                                         rootNode,
-                                         drawMode );
+                                         nullptr,
+                                         subtreesToSplit,
+                                         maximumSubtreeSize,
+                                         states );
+  }
+
+  if( !subtreeUpdates.empty() )
+  {
+    cumulativeDirtyFlags |= UpdateSubtrees( nodeTree, subtreeUpdates, updateBufferIndex, renderQueue, *threadPool );
   }
 
   return cumulativeDirtyFlags;
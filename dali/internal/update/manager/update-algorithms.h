@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <vector>
+
 // INTERNAL INCLUDES
 #include <dali/internal/common/buffer-index.h>
 #include <dali/internal/update/nodes/node-declarations.h>
@@ -25,12 +28,15 @@
 namespace Dali
 {
 
+class ThreadPool;
+
 namespace Internal
 {
 
 namespace SceneGraph
 {
 
+class FlattenedNodeTree;
 class Layer;
 class PropertyOwner;
 class RenderQueue;
@@ -42,17 +48,43 @@ class RenderQueue;
  */
 void ConstrainPropertyOwner( PropertyOwner& propertyOwner, BufferIndex updateBufferIndex );
 
+/**
+ * Consecutive sibling subtrees of the node hierarchy which are updated by a worker thread.
+ * The results which affect nodes outside of the subtrees are stored here and merged once all the subtrees are updated.
+ */
+struct SubtreeUpdate
+{
+  uint32_t begin;                         ///< The index of the entry of the first root in the FlattenedNodeTree
+  uint32_t end;                           ///< The index one past the last entry of the last subtree
+  Layer* layer;                           ///< The layer which the roots belong to
+  NodePropertyFlags parentFlags;          ///< The dirty flags of the parent of the roots
+  uint32_t inheritedDrawMode;             ///< The draw mode inherited by the roots
+  NodePropertyFlags cumulativeDirtyFlags; ///< The cumulative (ORed) dirty flags of the nodes of the subtrees
+  bool reuseRenderers;                    ///< False if the layer can not reuse its renderers because of a node of the subtrees
+};
+
+typedef std::vector< SubtreeUpdate > SubtreeUpdateContainer;
+
 /**
  * Update a tree of nodes
  * The inherited properties of each node are recalculated if necessary.
+ * When a thread pool is given, the nodes with big subtrees are updated on the calling thread, and the
+ * subtrees below them are grouped into tasks of similar numbers of nodes, which are updated by the worker threads.
+ * @note The constraints of the nodes are applied beforehand, by the ConstraintScheduler.
  * @param[in] rootNode The root of a tree of nodes.
+ * @param[in] nodeTree The nodes of the tree in depth first order.
  * @param[in] updateBufferIndex The current update buffer index.
  * @param[in] renderQueue Used to query messages for the next Render.
+ * @param[in] threadPool The worker threads used to update the subtrees, or nullptr to update serially.
+ * @param[in] subtreeUpdates Used to store the subtrees updated by the worker threads.
  * @return The cumulative (ORed) dirty flags for the updated nodes
  */
 NodePropertyFlags UpdateNodeTree( Layer& rootNode,
+                                  const FlattenedNodeTree& nodeTree,
                                   BufferIndex updateBufferIndex,
-                                  RenderQueue& renderQueue );
+                                  RenderQueue& renderQueue,
+                                  Dali::ThreadPool* threadPool,
+                                  SubtreeUpdateContainer& subtreeUpdates );
 
 } // namespace SceneGraph
 
@@ -18,10 +18,14 @@
 // CLASS HEADER
 #include <dali/internal/update/manager/update-manager.h>
 
+// EXTERNAL INCLUDES
+#include <unordered_map>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/common/stage.h>
 #include <dali/devel-api/common/owner-container.h>
 #include <dali/devel-api/threading/mutex.h>
+#include <dali/devel-api/threading/thread-pool.h>
 
 #include <dali/integration-api/core.h>
 #include <dali/integration-api/render-controller.h>
@@ -44,6 +48,7 @@
 #include <dali/internal/update/controllers/render-message-dispatcher.h>
 #include <dali/internal/update/controllers/scene-controller-impl.h>
 #include <dali/internal/update/gestures/scene-graph-pan-gesture.h>
+#include <dali/internal/update/manager/constraint-scheduler.h>
 #include <dali/internal/update/manager/frame-callback-processor.h>
 #include <dali/internal/update/manager/render-task-processor.h>
 #include <dali/internal/update/manager/sorted-layers.h>
@@ -51,6 +56,7 @@
 #include <dali/internal/update/manager/update-algorithms.h>
 #include <dali/internal/update/manager/update-manager-debug.h>
 #include <dali/internal/update/manager/transform-manager.h>
+#include <dali/internal/update/nodes/flattened-node-tree.h>
 #include <dali/internal/update/nodes/node.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
 #include <dali/internal/update/queue/update-message-queue.h>
@@ -160,7 +166,8 @@ struct UpdateManager::Impl
   struct SceneInfo
   {
     SceneInfo( Layer* root )                             ///< Constructor
-    : root( root )
+    : root( root ),
+      nodeTree( *root )
     {
     }
 
@@ -173,8 +180,11 @@ struct UpdateManager::Impl
     Layer* root{ nullptr };                                   ///< Root node (root is a layer). The layer is not stored in the node memory pool.
     OwnerPointer< RenderTaskList > taskList;                  ///< Scene graph render task list
     SortedLayerPointers sortedLayerList;                      ///< List of Layer pointers sorted by depth (one list of sorted layers per root)
+    FlattenedNodeTree nodeTree;                               ///< The nodes of the scene in depth first order
   };
 
+  typedef std::pair< size_t, bool > ReadyProgram;             ///< The hash of a ready program, and whether it was compiled in the background
+
   Impl( NotificationManager& notificationManager,
         CompleteNotificationInterface& animationPlaylist,
         PropertyNotifier& propertyNotifier,
@@ -271,6 +281,29 @@ struct UpdateManager::Impl
     return *frameCallbackProcessor;
   }
 
+  /**
+   * Finds the flattened tree of the scene which a node is connected to.
+   * @param[in]  node  A node connected to a scene
+   * @return The flattened tree of the scene, or nullptr if the node is not connected to an installed root
+   */
+  FlattenedNodeTree* FindNodeTree( Node& node )
+  {
+    Node* root = &node;
+    while( root->GetParent() )
+    {
+      root = root->GetParent();
+    }
+
+    for( auto&& scene : scenes )
+    {
+      if( scene && scene->root == root )
+      {
+        return &scene->nodeTree;
+      }
+    }
+    return nullptr;
+  }
+
   SceneGraphBuffers                    sceneGraphBuffers;             ///< Used to keep track of which buffers are being written or read
   RenderMessageDispatcher              renderMessageDispatcher;       ///< Used for passing messages to the render-thread
   NotificationManager&                 notificationManager;           ///< Queues notification messages for the event-thread.
@@ -292,6 +325,7 @@ struct UpdateManager::Impl
   std::vector< SceneInfoPtr >          scenes;                        ///< A container of SceneInfo.
 
   Vector<Node*>                        nodes;                         ///< A container of all instantiated nodes
+  std::unordered_map< uint32_t, Node* > nodeIds;                      ///< The nodes and root layers, by their IDs
 
   OwnerContainer< Camera* >            cameras;                       ///< A container of cameras
   OwnerContainer< PropertyOwner* >     customObjects;                 ///< A container of owned objects (with custom properties)
@@ -307,9 +341,14 @@ struct UpdateManager::Impl
   MessageQueue                         messageQueue;                  ///< The messages queued from the event-thread
   std::vector<Internal::ShaderDataPtr> renderCompiledShaders;         ///< Shaders compiled on Render thread are inserted here for update thread to pass on to event thread.
   std::vector<Internal::ShaderDataPtr> updateCompiledShaders;         ///< Shaders to be sent from Update to Event
+  std::vector<ReadyProgram>            renderReadyPrograms;           ///< Programs which became ready on Render thread, for update thread to pass on to event thread.
+  std::vector<ReadyProgram>            updateReadyPrograms;           ///< Ready programs to be sent from Update to Event
   Mutex                                compiledShaderMutex;           ///< lock to ensure no corruption on the renderCompiledShaders
 
   OwnerPointer<FrameCallbackProcessor> frameCallbackProcessor;        ///< Owned FrameCallbackProcessor, only created if required.
+  std::unique_ptr<Dali::ThreadPool>    threadPool;                    ///< Worker threads used to parallelise the update, only created if required.
+  SubtreeUpdateContainer               subtreeUpdates;                ///< Subtrees of the scene graph updated by the worker threads
+  ConstraintScheduler                  constraintScheduler;           ///< Applies the constraints of the nodes in the order of their dependencies
 
   float                                keepRenderingSeconds;          ///< Set via Dali::Stage::KeepRendering
   NodePropertyFlags                    nodeDirtyFlags;                ///< cumulative node dirty flags from previous frame
@@ -372,6 +411,7 @@ void UpdateManager::InstallRoot( OwnerPointer<Layer>& layer )
 
   rootLayer->CreateTransform( &mImpl->transformManager );
   rootLayer->SetRoot(true);
+  mImpl->nodeIds[ rootLayer->GetId() ] = rootLayer;
 
   mImpl->scenes.emplace_back( new Impl::SceneInfo( rootLayer ) );
 }
@@ -389,6 +429,7 @@ void UpdateManager::UninstallRoot( Layer* layer )
       break;
     }
   }
+  mImpl->nodeIds.erase( layer->GetId() );
 
   mImpl->discardQueue.Add( mSceneGraphBuffers.GetUpdateBufferIndex(), layer );
 
@@ -410,6 +451,7 @@ void UpdateManager::AddNode( OwnerPointer<Node>& node )
     if( rawNode > (*iter) )
     {
       mImpl->nodes.Insert((iter+1), rawNode );
+      mImpl->nodeIds[ rawNode->GetId() ] = rawNode;
       rawNode->CreateTransform( &mImpl->transformManager );
       return;
     }
@@ -426,6 +468,12 @@ void UpdateManager::ConnectNode( Node* parent, Node* node )
 
   parent->ConnectChild( node );
 
+  FlattenedNodeTree* nodeTree = mImpl->FindNodeTree( *parent );
+  if( nodeTree )
+  {
+    nodeTree->NodeConnected( *node );
+  }
+
   // Inform the frame-callback-processor, if set, about the node-hierarchy changing
   if( mImpl->frameCallbackProcessor )
   {
@@ -441,6 +489,12 @@ void UpdateManager::DisconnectNode( Node* node )
   DALI_ASSERT_ALWAYS( NULL != parent );
   parent->SetDirtyFlag( NodePropertyFlags::CHILD_DELETED ); // make parent dirty so that render items dont get reused
 
+  FlattenedNodeTree* nodeTree = mImpl->FindNodeTree( *parent );
+  if( nodeTree )
+  {
+    nodeTree->NodeDisconnected( *node );
+  }
+
   parent->DisconnectChild( mSceneGraphBuffers.GetUpdateBufferIndex(), *node );
 
   // Inform the frame-callback-processor, if set, about the node-hierarchy changing
@@ -467,6 +521,7 @@ void UpdateManager::DestroyNode( Node* node )
       break;
     }
   }
+  mImpl->nodeIds.erase( node->GetId() );
 
   mImpl->discardQueue.Add( mSceneGraphBuffers.GetUpdateBufferIndex(), node );
 
@@ -474,6 +529,12 @@ void UpdateManager::DestroyNode( Node* node )
   node->OnDestroy();
 }
 
+Node* UpdateManager::GetNodeWithId( uint32_t id ) const
+{
+  auto iter = mImpl->nodeIds.find( id );
+  return ( iter != mImpl->nodeIds.end() ) ? iter->second : NULL;
+}
+
 void UpdateManager::AddCamera( OwnerPointer< Camera >& camera )
 {
   mImpl->cameras.PushBack( camera.Release() ); // takes ownership
@@ -615,6 +676,13 @@ void UpdateManager::SaveBinary( Internal::ShaderDataPtr shaderData )
   }
 }
 
+void UpdateManager::ProgramReady( size_t shaderHash, bool compiledInBackground )
+{
+  // lock as update might be sending previously ready programs to event thread
+  Mutex::ScopedLock lock( mImpl->compiledShaderMutex );
+  mImpl->renderReadyPrograms.push_back( Impl::ReadyProgram( shaderHash, compiledInBackground ) );
+}
+
 void UpdateManager::SetShaderSaver( ShaderSaver& upstream )
 {
   mImpl->shaderSaver = &upstream;
@@ -772,6 +840,20 @@ void UpdateManager::ConstrainCustomObjects( BufferIndex bufferIndex )
   }
 }
 
+void UpdateManager::ConstrainNodes( BufferIndex bufferIndex )
+{
+  for ( auto&& scene : mImpl->scenes )
+  {
+    if ( scene && scene->root )
+    {
+      scene->nodeTree.Update();
+      mImpl->constraintScheduler.AddNodes( scene->nodeTree, bufferIndex );
+    }
+  }
+
+  mImpl->constraintScheduler.Apply( bufferIndex );
+}
+
 void UpdateManager::ConstrainRenderTasks( BufferIndex bufferIndex )
 {
   // Constrain render-tasks
@@ -809,8 +891,10 @@ void UpdateManager::ProcessPropertyNotifications( BufferIndex bufferIndex )
   }
 }
 
-void UpdateManager::ForwardCompiledShadersToEventThread()
+bool UpdateManager::ForwardCompiledShadersToEventThread()
 {
+  bool programsCompiled = false;
+
   DALI_ASSERT_DEBUG( (mImpl->shaderSaver != 0) && "shaderSaver should be wired-up during startup." );
   if( mImpl->shaderSaver )
   {
@@ -819,6 +903,7 @@ void UpdateManager::ForwardCompiledShadersToEventThread()
       // render might be attempting to send us more binaries at the same time
       Mutex::ScopedLock lock( mImpl->compiledShaderMutex );
       mImpl->renderCompiledShaders.swap( mImpl->updateCompiledShaders );
+      mImpl->renderReadyPrograms.swap( mImpl->updateReadyPrograms );
     }
 
     if( mImpl->updateCompiledShaders.size() > 0 )
@@ -831,7 +916,20 @@ void UpdateManager::ForwardCompiledShadersToEventThread()
       // we don't need them in update anymore
       mImpl->updateCompiledShaders.clear();
     }
+
+    if( mImpl->updateReadyPrograms.size() > 0 )
+    {
+      ShaderSaver& factory = *mImpl->shaderSaver;
+      for( auto&& program : mImpl->updateReadyPrograms )
+      {
+        mImpl->notificationManager.QueueMessage( ProgramReadyMessage( factory, program.first, program.second ) );
+        programsCompiled |= program.second;
+      }
+      mImpl->updateReadyPrograms.clear();
+    }
   }
+
+  return programsCompiled;
 }
 
 void UpdateManager::UpdateRenderers( BufferIndex bufferIndex )
@@ -855,9 +953,13 @@ void UpdateManager::UpdateNodes( BufferIndex bufferIndex )
     {
       // Prepare resources, update shaders, for each node
       // And add the renderers to the sorted layers. Start from root, which is also a layer
+      scene->nodeTree.Update();
       mImpl->nodeDirtyFlags |= UpdateNodeTree( *scene->root,
+                                              scene->nodeTree,
                                               bufferIndex,
-                                              mImpl->renderQueue );
+                                              mImpl->renderQueue,
+                                              mImpl->threadPool.get(),
+                                              mImpl->subtreeUpdates );
     }
   }
 }
@@ -898,8 +1000,8 @@ uint32_t UpdateManager::Update( float elapsedSeconds,
   // be set again
   updateScene |= mImpl->messageQueue.ProcessMessages( bufferIndex );
 
-  //Forward compiled shader programs to event thread for saving
-  ForwardCompiledShadersToEventThread();
+  //Forward compiled shader programs to event thread for saving, and draw the ones compiled in the background
+  updateScene |= ForwardCompiledShadersToEventThread();
 
   // Although the scene-graph may not require an update, we still need to synchronize double-buffered
   // renderer lists if the scene was updated in the previous frame.
@@ -933,7 +1035,10 @@ uint32_t UpdateManager::Update( float elapsedSeconds,
       mImpl->frameCallbackProcessor->Update( bufferIndex, elapsedSeconds );
     }
 
-    //Update node hierarchy, apply constraints and perform sorting / culling.
+    //Apply constraints to nodes, after the nodes their inputs are read from
+    ConstrainNodes( bufferIndex );
+
+    //Update node hierarchy and perform sorting / culling.
     //This will populate each Layer with a list of renderers which are ready.
     UpdateNodes( bufferIndex );
 
@@ -979,7 +1084,7 @@ uint32_t UpdateManager::Update( float elapsedSeconds,
         {
           keepRendererRendering |= mImpl->renderTaskProcessor.Process( bufferIndex,
                                               *scene->taskList,
-                                              *scene->root,
+                                              scene->nodeTree,
                                               scene->sortedLayerList,
                                               mImpl->renderInstructions,
                                               renderToFboEnabled,
@@ -1112,6 +1217,21 @@ void UpdateManager::SetRenderingBehavior( DevelStage::Rendering renderingBehavio
   mImpl->renderingBehavior = renderingBehavior;
 }
 
+void UpdateManager::SetUpdateThreadCount( uint32_t threadCount )
+{
+  mImpl->transformManager.SetThreadPool( nullptr );
+  mImpl->constraintScheduler.SetThreadPool( nullptr );
+  mImpl->threadPool.reset();
+
+  if( threadCount > 0u )
+  {
+    mImpl->threadPool = std::unique_ptr<Dali::ThreadPool>( new Dali::ThreadPool() );
+    mImpl->threadPool->Initialize( threadCount );
+    mImpl->transformManager.SetThreadPool( mImpl->threadPool.get() );
+    mImpl->constraintScheduler.SetThreadPool( mImpl->threadPool.get() );
+  }
+}
+
 void UpdateManager::SetLayerDepths( const SortedLayerPointers& layers, const Layer* rootLayer )
 {
   for ( auto&& scene : mImpl->scenes )
@@ -200,6 +200,13 @@ public:
    */
   void DestroyNode( Node* node );
 
+  /**
+   * Retrieves a node owned by UpdateManager, or a root layer, by its ID.
+   * @param[in] id The ID of the node
+   * @return The node, or NULL if there is no node with the ID
+   */
+  Node* GetNodeWithId( uint32_t id ) const;
+
   /**
    * Add a camera on scene
    * @param[in] camera The camera to add
@@ -325,6 +332,13 @@ public:
    */
   virtual void SaveBinary( Internal::ShaderDataPtr shaderData );
 
+  /**
+   * @brief Accept the programs which are ready, passed back on render thread for notifying.
+   * @param[in] shaderHash The hash of the sources of the program.
+   * @param[in] compiledInBackground True if the program has been compiled in the background since it was created.
+   */
+  virtual void ProgramReady( size_t shaderHash, bool compiledInBackground );
+
   /**
    * @brief Set the destination for compiled shader binaries to be passed on to.
    * The dispatcher passed in will be called from the update thread.
@@ -609,6 +623,11 @@ public:
    */
   void SetRenderingBehavior( DevelStage::Rendering renderingBehavior );
 
+  /**
+   * @copydoc Dali::Integration::Core::SetUpdateThreadCount()
+   */
+  void SetUpdateThreadCount( uint32_t threadCount );
+
   /**
    * Sets the depths of all layers.
    * @param layers The layers in depth order.
@@ -684,6 +703,12 @@ private:
    */
   void ConstrainCustomObjects( BufferIndex bufferIndex );
 
+  /**
+   * Applies constraints to the nodes of the scenes
+   * @param[in] bufferIndex to use
+   */
+  void ConstrainNodes( BufferIndex bufferIndex );
+
   /**
    * Applies constraints to RenderTasks
    * @param[in] bufferIndex to use
@@ -703,9 +728,10 @@ private:
   void ProcessPropertyNotifications( BufferIndex bufferIndex );
 
   /**
-   * Pass shader binaries queued here on to event thread.
+   * Pass shader binaries and ready programs queued here on to event thread.
+   * @return true if programs compiled in the background have become ready, so their renderers should be drawn
    */
-  void ForwardCompiledShadersToEventThread();
+  bool ForwardCompiledShadersToEventThread();
 
   /**
    * Update node shaders, opacity, geometry etc.
@@ -1035,6 +1061,17 @@ inline void SetRenderingBehaviorMessage( UpdateManager& manager, DevelStage::Ren
   new (slot) LocalType( &manager, &UpdateManager::SetRenderingBehavior, renderingBehavior );
 }
 
+inline void SetUpdateThreadCountMessage( UpdateManager& manager, uint32_t threadCount )
+{
+  typedef MessageValue1< UpdateManager, uint32_t > LocalType;
+
+  // Reserve some memory inside the message queue
+  uint32_t* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetUpdateThreadCount, threadCount );
+}
+
 /**
  * Create a message for setting the depth of a layer
  * @param[in] manager The update manager
@@ -19,6 +19,7 @@
 #include <dali/internal/update/manager/update-proxy-impl.h>
 
 // INTERNAL INCLUDES
+#include <dali/internal/update/manager/update-manager.h>
 #include <dali/internal/update/manager/update-proxy-property-modifier.h>
 
 namespace Dali
@@ -30,27 +31,22 @@ namespace Internal
 namespace
 {
 
-SceneGraph::Node* FindNodeInSceneGraph( uint32_t id, SceneGraph::Node& node )
+/**
+ * @brief Checks whether a node is the root node or one of its descendants.
+ * @param[in]  node      The node to check
+ * @param[in]  rootNode  The root node
+ * @return true if the node is in the tree of the root node
+ */
+bool IsNodeInTree( const SceneGraph::Node& node, const SceneGraph::Node& rootNode )
 {
-  SceneGraph::Node* matchingNode = NULL;
-
-  if( node.mId == id )
-  {
-    matchingNode = &node;
-  }
-  else
+  for( const SceneGraph::Node* ancestor = &node; ancestor; ancestor = ancestor->GetParent() )
   {
-    for( auto&& i : node.GetChildren() )
+    if( ancestor == &rootNode )
     {
-      matchingNode = FindNodeInSceneGraph( id, *i );
-      if( matchingNode )
-      {
-        break;
-      }
+      return true;
     }
   }
-
-  return matchingNode;
+  return false;
 }
 
 } // unnamed namespace
@@ -58,6 +54,7 @@ SceneGraph::Node* FindNodeInSceneGraph( uint32_t id, SceneGraph::Node& node )
 UpdateProxy::UpdateProxy( SceneGraph::UpdateManager& updateManager, SceneGraph::TransformManager& transformManager, SceneGraph::Node& rootNode )
 : mNodeContainer(),
   mLastCachedIdNodePair( { 0u, NULL } ),
+  mTransformIds(),
   mCurrentBufferIndex( 0u ),
   mUpdateManager( updateManager ),
   mTransformManager( transformManager ),
@@ -231,6 +228,116 @@ bool UpdateProxy::BakeColor( uint32_t id, const Vector4& color )
   return success;
 }
 
+uint32_t UpdateProxy::GetPositions( const uint32_t* ids, Vector3* positions, uint32_t count ) const
+{
+  const uint32_t found = GetTransformIds( ids, count );
+  mTransformManager.GetVector3PropertyValues( mTransformIds.data(), count, SceneGraph::TRANSFORM_PROPERTY_POSITION, positions );
+  return found;
+}
+
+uint32_t UpdateProxy::SetPositions( const uint32_t* ids, const Vector3* positions, uint32_t count )
+{
+  const uint32_t found = GetTransformIds( ids, count );
+  mTransformManager.SetVector3PropertyValues( mTransformIds.data(), count, SceneGraph::TRANSFORM_PROPERTY_POSITION, positions );
+  return found;
+}
+
+uint32_t UpdateProxy::BakePositions( const uint32_t* ids, const Vector3* positions, uint32_t count )
+{
+  const uint32_t found = GetTransformIds( ids, count );
+  mTransformManager.BakeVector3PropertyValues( mTransformIds.data(), count, SceneGraph::TRANSFORM_PROPERTY_POSITION, positions );
+  return found;
+}
+
+uint32_t UpdateProxy::GetSizes( const uint32_t* ids, Vector3* sizes, uint32_t count ) const
+{
+  const uint32_t found = GetTransformIds( ids, count );
+  mTransformManager.GetVector3PropertyValues( mTransformIds.data(), count, SceneGraph::TRANSFORM_PROPERTY_SIZE, sizes );
+  return found;
+}
+
+uint32_t UpdateProxy::SetSizes( const uint32_t* ids, const Vector3* sizes, uint32_t count )
+{
+  const uint32_t found = GetTransformIds( ids, count );
+  mTransformManager.SetVector3PropertyValues( mTransformIds.data(), count, SceneGraph::TRANSFORM_PROPERTY_SIZE, sizes );
+  return found;
+}
+
+uint32_t UpdateProxy::BakeSizes( const uint32_t* ids, const Vector3* sizes, uint32_t count )
+{
+  const uint32_t found = GetTransformIds( ids, count );
+  mTransformManager.BakeVector3PropertyValues( mTransformIds.data(), count, SceneGraph::TRANSFORM_PROPERTY_SIZE, sizes );
+  return found;
+}
+
+uint32_t UpdateProxy::GetScales( const uint32_t* ids, Vector3* scales, uint32_t count ) const
+{
+  const uint32_t found = GetTransformIds( ids, count );
+  mTransformManager.GetVector3PropertyValues( mTransformIds.data(), count, SceneGraph::TRANSFORM_PROPERTY_SCALE, scales );
+  return found;
+}
+
+uint32_t UpdateProxy::SetScales( const uint32_t* ids, const Vector3* scales, uint32_t count )
+{
+  const uint32_t found = GetTransformIds( ids, count );
+  mTransformManager.SetVector3PropertyValues( mTransformIds.data(), count, SceneGraph::TRANSFORM_PROPERTY_SCALE, scales );
+  return found;
+}
+
+uint32_t UpdateProxy::BakeScales( const uint32_t* ids, const Vector3* scales, uint32_t count )
+{
+  const uint32_t found = GetTransformIds( ids, count );
+  mTransformManager.BakeVector3PropertyValues( mTransformIds.data(), count, SceneGraph::TRANSFORM_PROPERTY_SCALE, scales );
+  return found;
+}
+
+uint32_t UpdateProxy::GetColors( const uint32_t* ids, Vector4* colors, uint32_t count ) const
+{
+  uint32_t found = 0u;
+  for( uint32_t i = 0u; i < count; ++i )
+  {
+    const SceneGraph::Node* node = GetNodeWithId( ids[i] );
+    if( node )
+    {
+      colors[i] = node->mColor.Get( mCurrentBufferIndex );
+      ++found;
+    }
+  }
+  return found;
+}
+
+uint32_t UpdateProxy::SetColors( const uint32_t* ids, const Vector4* colors, uint32_t count )
+{
+  uint32_t found = 0u;
+  for( uint32_t i = 0u; i < count; ++i )
+  {
+    SceneGraph::Node* node = GetNodeWithId( ids[i] );
+    if( node )
+    {
+      node->mColor.Set( mCurrentBufferIndex, colors[i] );
+      node->SetDirtyFlag( SceneGraph::NodePropertyFlags::COLOR );
+      AddResetter( *node, node->mColor );
+      ++found;
+    }
+  }
+  return found;
+}
+
+uint32_t UpdateProxy::BakeColors( const uint32_t* ids, const Vector4* colors, uint32_t count )
+{
+  uint32_t found = 0u;
+  for( uint32_t i = 0u; i < count; ++i )
+  {
+    SceneGraph::Node* node = GetNodeWithId( ids[i] );
+    if( node )
+    {
+      node->mColor.Bake( mCurrentBufferIndex, colors[i] );
+      ++found;
+    }
+  }
+  return found;
+}
+
 void UpdateProxy::NodeHierarchyChanged()
 {
   mLastCachedIdNodePair = { 0u, NULL };
@@ -242,39 +349,61 @@ SceneGraph::Node* UpdateProxy::GetNodeWithId( uint32_t id ) const
 {
   SceneGraph::Node* node = NULL;
 
-  // Cache the last accessed node so we don't have to traverse
+  // Cache the last accessed node so we don't have to look it up
   if( mLastCachedIdNodePair.node && mLastCachedIdNodePair.id == id )
   {
     node = mLastCachedIdNodePair.node;
   }
   else
   {
-    // Find node in vector
-    for( auto&& pair : mNodeContainer )
+    auto iter = mNodeContainer.find( id );
+    if( iter != mNodeContainer.end() )
     {
-      if( pair.id == id )
+      node = iter->second;
+    }
+    else
+    {
+      // Node not cached, look it up in the update-manager's index and check it's in our tree
+      node = mUpdateManager.GetNodeWithId( id );
+      if( node && IsNodeInTree( *node, mRootNode ) )
       {
-        node = pair.node;
-        mLastCachedIdNodePair = pair;
-        break;
+        mNodeContainer.insert( { id, node } );
+      }
+      else
+      {
+        node = NULL;
       }
     }
 
-    if( ! node )
+    if( node )
     {
-      // Node not in vector, find in scene-graph
-      node = FindNodeInSceneGraph( id, mRootNode );
-      if( node )
-      {
-        mNodeContainer.push_back( { id, node } );
-        mLastCachedIdNodePair = *mNodeContainer.rbegin();
-      }
+      mLastCachedIdNodePair = { id, node };
     }
   }
 
   return node;
 }
 
+uint32_t UpdateProxy::GetTransformIds( const uint32_t* ids, uint32_t count ) const
+{
+  uint32_t found = 0u;
+  mTransformIds.resize( count );
+  for( uint32_t i = 0u; i < count; ++i )
+  {
+    const SceneGraph::Node* node = GetNodeWithId( ids[i] );
+    if( node )
+    {
+      mTransformIds[i] = node->mTransformId;
+      ++found;
+    }
+    else
+    {
+      mTransformIds[i] = SceneGraph::INVALID_TRANSFORM_ID;
+    }
+  }
+  return found;
+}
+
 void UpdateProxy::AddResetter( SceneGraph::Node& node, SceneGraph::PropertyBase& propertyBase )
 {
   if( ! mPropertyModifier )
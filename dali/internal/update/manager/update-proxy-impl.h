@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <cstdint>
 #include <memory>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/vector-wrapper.h>
@@ -137,6 +138,66 @@ public:
    */
   bool BakeColor( uint32_t id, const Vector4& color );
 
+  /**
+   * @copydoc Dali::UpdateProxy::GetPositions()
+   */
+  uint32_t GetPositions( const uint32_t* ids, Vector3* positions, uint32_t count ) const;
+
+  /**
+   * @copydoc Dali::UpdateProxy::SetPositions()
+   */
+  uint32_t SetPositions( const uint32_t* ids, const Vector3* positions, uint32_t count );
+
+  /**
+   * @copydoc Dali::UpdateProxy::BakePositions()
+   */
+  uint32_t BakePositions( const uint32_t* ids, const Vector3* positions, uint32_t count );
+
+  /**
+   * @copydoc Dali::UpdateProxy::GetSizes()
+   */
+  uint32_t GetSizes( const uint32_t* ids, Vector3* sizes, uint32_t count ) const;
+
+  /**
+   * @copydoc Dali::UpdateProxy::SetSizes()
+   */
+  uint32_t SetSizes( const uint32_t* ids, const Vector3* sizes, uint32_t count );
+
+  /**
+   * @copydoc Dali::UpdateProxy::BakeSizes()
+   */
+  uint32_t BakeSizes( const uint32_t* ids, const Vector3* sizes, uint32_t count );
+
+  /**
+   * @copydoc Dali::UpdateProxy::GetScales()
+   */
+  uint32_t GetScales( const uint32_t* ids, Vector3* scales, uint32_t count ) const;
+
+  /**
+   * @copydoc Dali::UpdateProxy::SetScales()
+   */
+  uint32_t SetScales( const uint32_t* ids, const Vector3* scales, uint32_t count );
+
+  /**
+   * @copydoc Dali::UpdateProxy::BakeScales()
+   */
+  uint32_t BakeScales( const uint32_t* ids, const Vector3* scales, uint32_t count );
+
+  /**
+   * @copydoc Dali::UpdateProxy::GetColors()
+   */
+  uint32_t GetColors( const uint32_t* ids, Vector4* colors, uint32_t count ) const;
+
+  /**
+   * @copydoc Dali::UpdateProxy::SetColors()
+   */
+  uint32_t SetColors( const uint32_t* ids, const Vector4* colors, uint32_t count );
+
+  /**
+   * @copydoc Dali::UpdateProxy::BakeColors()
+   */
+  uint32_t BakeColors( const uint32_t* ids, const Vector4* colors, uint32_t count );
+
   /**
    * @brief Retrieves the root-node used by this class
    * @return The root node used by this class.
@@ -163,13 +224,22 @@ public:
 private:
 
   /**
-   * @brief Retrieves the node with the specified ID.
+   * @brief Retrieves the node with the specified ID, if it's the root node or one of its descendants.
    * @param[in]  id  The ID of the node required
    * @return A pointer to the required node if found.
-   * @note This caches the last accessed node.
+   * @note This caches the nodes found, until the node hierarchy changes.
    */
   SceneGraph::Node* GetNodeWithId( uint32_t id ) const;
 
+  /**
+   * @brief Retrieves the transform IDs of several nodes into mTransformIds.
+   * @param[in]  ids    The IDs of the nodes
+   * @param[in]  count  The number of IDs
+   * @return The number of nodes found.
+   * @note The transform ID of a node which isn't found is INVALID_TRANSFORM_ID.
+   */
+  uint32_t GetTransformIds( const uint32_t* ids, uint32_t count ) const;
+
   /**
    * @brief Adds a property-resetter for non-transform properties so that they can be reset to their base value every frame.
    * @param[in]  node          The node the property belongs to
@@ -191,8 +261,9 @@ private:
   class PropertyModifier;
   using PropertyModifierPtr = std::unique_ptr< PropertyModifier >;
 
-  mutable std::vector< IdNodePair > mNodeContainer; ///< Used to store cached pointers to already searched for Nodes.
+  mutable std::unordered_map< uint32_t, SceneGraph::Node* > mNodeContainer; ///< Used to store cached pointers to already searched for Nodes.
   mutable IdNodePair mLastCachedIdNodePair; ///< Used to cache the last retrieved id-node pair.
+  mutable std::vector< SceneGraph::TransformId > mTransformIds; ///< Used to store the transform IDs of the nodes accessed in a batch.
   BufferIndex mCurrentBufferIndex;
 
   SceneGraph::UpdateManager& mUpdateManager; ///< Reference to the Update Manager.
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/nodes/bounding-volume-hierarchy.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/constants.h>
+#include <dali/internal/update/manager/transform-kernels.h>
+#include <dali/internal/update/nodes/scene-graph-layer.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+namespace
+{
+
+/**
+ * The maximum number of spheres in a leaf volume, which are checked against the frustum together
+ */
+const uint32_t MAXIMUM_LEAF_SPHERES = TransformKernels::BATCH_SIZE * 2u;
+
+/**
+ * The maximum depth of the hierarchy, as the spheres are split in halves
+ */
+const uint32_t MAXIMUM_DEPTH = 32u;
+
+/**
+ * Where a bounding box is relative to a view frustum
+ */
+enum Containment
+{
+  OUTSIDE,   ///< The box is outside of one of the planes
+  INSIDE,    ///< The box is inside all the planes
+  INTERSECTS ///< The box crosses at least one of the planes
+};
+
+/**
+ * Checks where a bounding box is relative to a view frustum
+ * @param[in] minimum The minimum corner of the box
+ * @param[in] maximum The maximum corner of the box
+ * @param[in] planes The planes of the frustum
+ * @return Where the box is
+ */
+Containment CheckBoxInFrustum( const Vector3& minimum, const Vector3& maximum, const Vector4* planes )
+{
+  Containment containment = INSIDE;
+  for( uint32_t i = 0u; i < TransformKernels::FRUSTUM_PLANE_COUNT; ++i )
+  {
+    const Vector4& plane = planes[i];
+
+    // The corners furthest inside and outside of the plane
+    const Vector3 insideCorner( plane.x >= 0.0f ? maximum.x : minimum.x,
+                                plane.y >= 0.0f ? maximum.y : minimum.y,
+                                plane.z >= 0.0f ? maximum.z : minimum.z );
+    if( plane.w + plane.x * insideCorner.x + plane.y * insideCorner.y + plane.z * insideCorner.z < 0.0f )
+    {
+      return OUTSIDE;
+    }
+
+    const Vector3 outsideCorner( plane.x >= 0.0f ? minimum.x : maximum.x,
+                                 plane.y >= 0.0f ? minimum.y : maximum.y,
+                                 plane.z >= 0.0f ? minimum.z : maximum.z );
+    if( plane.w + plane.x * outsideCorner.x + plane.y * outsideCorner.y + plane.z * outsideCorner.z < 0.0f )
+    {
+      containment = INTERSECTS;
+    }
+  }
+  return containment;
+}
+
+} // unnamed namespace
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy()
+: mNodes(),
+  mOrder(),
+  mSpheres(),
+  mVolumes()
+{
+}
+
+BoundingVolumeHierarchy::~BoundingVolumeHierarchy()
+{
+}
+
+void BoundingVolumeHierarchy::Update( const Renderable* renderables, uint32_t count )
+{
+  bool rebuild = ( mNodes.Count() != count );
+  if( !rebuild )
+  {
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      if( mNodes[i] != renderables[i].mNode )
+      {
+        rebuild = true;
+        break;
+      }
+    }
+  }
+
+  if( rebuild )
+  {
+    mNodes.Resize( count );
+    mOrder.Resize( count );
+    mSpheres.Resize( count );
+    for( uint32_t i = 0u; i < count; ++i )
+    {
+      mNodes[i] = renderables[i].mNode;
+      mOrder[i] = i;
+      mSpheres[i] = renderables[i].mNode->GetBoundingSphere();
+    }
+
+    mVolumes.Clear();
+    if( count > 0u )
+    {
+      Build( 0u, count );
+    }
+  }
+
+  // Gather the spheres in the order of the volumes
+  for( uint32_t i = 0u; i < count; ++i )
+  {
+    mSpheres[i] = renderables[ mOrder[i] ].mNode->GetBoundingSphere();
+  }
+
+  Refit();
+}
+
+void BoundingVolumeHierarchy::CheckInFrustum( const Vector4* planes, bool* inside ) const
+{
+  const uint32_t count = mOrder.Count();
+  std::fill( inside, inside + count, false );
+  if( mVolumes.Empty() )
+  {
+    return;
+  }
+
+  bool leafInside[ MAXIMUM_LEAF_SPHERES ];
+  uint32_t stack[ MAXIMUM_DEPTH + 1u ];
+  uint32_t stackSize = 0u;
+  stack[ stackSize++ ] = 0u;
+  while( stackSize > 0u )
+  {
+    const Volume& volume = mVolumes[ stack[ --stackSize ] ];
+    const Containment containment = CheckBoxInFrustum( volume.minimum, volume.maximum, planes );
+    if( containment == INSIDE )
+    {
+      // Only the spheres which are too small to be visible are culled
+      for( uint32_t i = volume.first; i < volume.first + volume.count; ++i )
+      {
+        inside[ mOrder[i] ] = ( mSpheres[i].w > Math::MACHINE_EPSILON_1000 );
+      }
+    }
+    else if( containment == INTERSECTS )
+    {
+      if( volume.secondChild == 0u )
+      {
+        TransformKernels::CheckSpheresInFrustum( leafInside, mSpheres.Begin() + volume.first, planes, volume.count );
+        for( uint32_t i = 0u; i < volume.count; ++i )
+        {
+          inside[ mOrder[ volume.first + i ] ] = leafInside[i];
+        }
+      }
+      else
+      {
+        const uint32_t volumeIndex = static_cast<uint32_t>( &volume - mVolumes.Begin() );
+        stack[ stackSize++ ] = volume.secondChild;
+        stack[ stackSize++ ] = volumeIndex + 1u;
+      }
+    }
+  }
+}
+
+void BoundingVolumeHierarchy::Clear()
+{
+  mNodes.Release();
+  mOrder.Release();
+  mSpheres.Release();
+  mVolumes.Release();
+}
+
+void BoundingVolumeHierarchy::Build( uint32_t first, uint32_t count )
+{
+  const uint32_t index = mVolumes.Count();
+  mVolumes.PushBack( Volume() );
+  mVolumes[index].first = first;
+  mVolumes[index].count = count;
+  mVolumes[index].secondChild = 0u;
+
+  if( count <= MAXIMUM_LEAF_SPHERES )
+  {
+    return;
+  }
+
+  // Split the spheres in halves along the longest axis of their centers
+  Vector3 minimum( mSpheres[ mOrder[first] ] );
+  Vector3 maximum( minimum );
+  for( uint32_t i = first + 1u; i < first + count; ++i )
+  {
+    const Vector4& center = mSpheres[ mOrder[i] ];
+    minimum.x = std::min( minimum.x, center.x );
+    minimum.y = std::min( minimum.y, center.y );
+    minimum.z = std::min( minimum.z, center.z );
+    maximum.x = std::max( maximum.x, center.x );
+    maximum.y = std::max( maximum.y, center.y );
+    maximum.z = std::max( maximum.z, center.z );
+  }
+
+  const Vector3 extent = maximum - minimum;
+  const uint32_t axis = ( extent.x >= extent.y && extent.x >= extent.z ) ? 0u : ( extent.y >= extent.z ? 1u : 2u );
+  const Vector4* spheres = mSpheres.Begin();
+  uint32_t* begin = mOrder.Begin() + first;
+  std::nth_element( begin, begin + count / 2u, begin + count,
+                    [ spheres, axis ]( uint32_t lhs, uint32_t rhs ) { return spheres[lhs].AsFloat()[axis] < spheres[rhs].AsFloat()[axis]; } );
+
+  Build( first, count / 2u );
+  mVolumes[index].secondChild = mVolumes.Count();
+  Build( first + count / 2u, count - count / 2u );
+}
+
+void BoundingVolumeHierarchy::Refit()
+{
+  // Children follow their parents, so the volumes are refit from the last one
+  for( uint32_t index = mVolumes.Count(); index > 0u; --index )
+  {
+    Volume& volume = mVolumes[ index - 1u ];
+    if( volume.secondChild == 0u )
+    {
+      const Vector4& sphere = mSpheres[ volume.first ];
+      volume.minimum = Vector3( sphere.x - sphere.w, sphere.y - sphere.w, sphere.z - sphere.w );
+      volume.maximum = Vector3( sphere.x + sphere.w, sphere.y + sphere.w, sphere.z + sphere.w );
+      for( uint32_t i = volume.first + 1u; i < volume.first + volume.count; ++i )
+      {
+        const Vector4& other = mSpheres[i];
+        volume.minimum.x = std::min( volume.minimum.x, other.x - other.w );
+        volume.minimum.y = std::min( volume.minimum.y, other.y - other.w );
+        volume.minimum.z = std::min( volume.minimum.z, other.z - other.w );
+        volume.maximum.x = std::max( volume.maximum.x, other.x + other.w );
+        volume.maximum.y = std::max( volume.maximum.y, other.y + other.w );
+        volume.maximum.z = std::max( volume.maximum.z, other.z + other.w );
+      }
+    }
+    else
+    {
+      const Volume& firstChild = mVolumes[ index ];
+      const Volume& secondChild = mVolumes[ volume.secondChild ];
+      volume.minimum.x = std::min( firstChild.minimum.x, secondChild.minimum.x );
+      volume.minimum.y = std::min( firstChild.minimum.y, secondChild.minimum.y );
+      volume.minimum.z = std::min( firstChild.minimum.z, secondChild.minimum.z );
+      volume.maximum.x = std::max( firstChild.maximum.x, secondChild.maximum.x );
+      volume.maximum.y = std::max( firstChild.maximum.y, secondChild.maximum.y );
+      volume.maximum.z = std::max( firstChild.maximum.z, secondChild.maximum.z );
+    }
+  }
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
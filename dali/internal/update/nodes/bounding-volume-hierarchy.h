@@ -0,0 +1,129 @@
+#ifndef DALI_INTERNAL_SCENE_GRAPH_BOUNDING_VOLUME_HIERARCHY_H
+#define DALI_INTERNAL_SCENE_GRAPH_BOUNDING_VOLUME_HIERARCHY_H
+
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/math/vector4.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+class Node;
+struct Renderable;
+
+/**
+ * A hierarchy of axis aligned bounding boxes around the bounding spheres of renderables,
+ * so the renderables outside a view frustum can be rejected a group at a time.
+ *
+ * The hierarchy is built by splitting the renderables along the longest axis of their centers.
+ * While the renderables stay the same, only the bounding boxes are refit to the bounding
+ * spheres of the current frame, so the hierarchy stays valid as the renderables move.
+ */
+class BoundingVolumeHierarchy
+{
+public:
+
+  /**
+   * Constructor
+   */
+  BoundingVolumeHierarchy();
+
+  /**
+   * Non-virtual destructor
+   */
+  ~BoundingVolumeHierarchy();
+
+  /**
+   * Updates the hierarchy to the current bounding spheres of the renderables.
+   * The hierarchy is rebuilt if the nodes of the renderables changed, and refit otherwise.
+   * @param[in] renderables The renderables
+   * @param[in] count The number of renderables
+   */
+  void Update( const Renderable* renderables, uint32_t count );
+
+  /**
+   * Checks whether the bounding spheres of the renderables are inside a view frustum.
+   * The result of a renderable is the same as TransformKernels::CheckSpheresInFrustum() for its bounding sphere,
+   * apart from spheres within rounding errors of a plane.
+   * @param[in] planes The planes of the frustum, with the normal in x, y, z and the distance in w
+   * @param[out] inside Whether each renderable is inside the frustum, in the order of the renderables
+   * @pre Update() has been called with the renderables
+   */
+  void CheckInFrustum( const Vector4* planes, bool* inside ) const;
+
+  /**
+   * Releases the memory of the hierarchy, when the renderables are culled without it
+   */
+  void Clear();
+
+private:
+
+  /**
+   * A bounding box around a contiguous range of the ordered spheres
+   */
+  struct Volume
+  {
+    Vector3 minimum;      ///< The minimum corner of the box
+    Vector3 maximum;      ///< The maximum corner of the box
+    uint32_t first;       ///< The first ordered sphere in the box
+    uint32_t count;       ///< The number of ordered spheres in the box
+    uint32_t secondChild; ///< The index of the second child, zero for a leaf. The first child follows its parent
+  };
+
+  /**
+   * Builds the volumes of a range of the ordered spheres, and of its children
+   * @param[in] first The first ordered sphere
+   * @param[in] count The number of ordered spheres
+   */
+  void Build( uint32_t first, uint32_t count );
+
+  /**
+   * Refits the bounding boxes of all the volumes to the ordered spheres
+   */
+  void Refit();
+
+  // Undefined
+  BoundingVolumeHierarchy( const BoundingVolumeHierarchy& );
+
+  // Undefined
+  BoundingVolumeHierarchy& operator=( const BoundingVolumeHierarchy& );
+
+private:
+
+  Dali::Vector< const Node* > mNodes; ///< The nodes of the renderables the hierarchy was built for
+  Dali::Vector< uint32_t > mOrder;    ///< The index of the renderable of each ordered sphere
+  Dali::Vector< Vector4 > mSpheres;   ///< The bounding spheres, ordered so the spheres of a volume are contiguous
+  Dali::Vector< Volume > mVolumes;    ///< The volumes, parents first
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SCENE_GRAPH_BOUNDING_VOLUME_HIERARCHY_H
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/nodes/flattened-node-tree.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/update/nodes/node.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+namespace
+{
+
+/**
+ * @param[in] node The root of a subtree
+ * @return The number of nodes of the subtree, including its root
+ */
+uint32_t CountSubtree( Node& node )
+{
+  uint32_t count = 1u;
+  NodeContainer& children = node.GetChildren();
+  const NodeIter endIter = children.End();
+  for( NodeIter iter = children.Begin(); iter != endIter; ++iter )
+  {
+    count += CountSubtree( **iter );
+  }
+  return count;
+}
+
+} // unnamed namespace
+
+FlattenedNodeTree::FlattenedNodeTree( Node& root )
+: mEntries(),
+  mConnectedNodes(),
+  mRoot( root ),
+  mGapSize( 0u ),
+  mRebuild( true )
+{
+}
+
+FlattenedNodeTree::~FlattenedNodeTree()
+{
+}
+
+void FlattenedNodeTree::NodeConnected( Node& node )
+{
+  if( !mRebuild )
+  {
+    mConnectedNodes.PushBack( &node );
+  }
+}
+
+void FlattenedNodeTree::NodeDisconnected( Node& node )
+{
+  uint32_t index = 0u;
+  if( mRebuild || !FindNode( node, index ) )
+  {
+    return;
+  }
+
+  // Leave a gap which keeps its size, so the gap is skipped as a single subtree
+  const uint32_t subtreeSize = mEntries[index].subtreeSize;
+  for( uint32_t i = index; i < index + subtreeSize; ++i )
+  {
+    mEntries[i].node = nullptr;
+  }
+
+  // Compact the entries once the gaps take as much space as the nodes
+  mGapSize += subtreeSize;
+  if( mGapSize * 2u > mEntries.Count() )
+  {
+    mRebuild = true;
+  }
+}
+
+void FlattenedNodeTree::Update()
+{
+  const Dali::Vector< Node* >::Iterator endIter = mConnectedNodes.End();
+  for( Dali::Vector< Node* >::Iterator iter = mConnectedNodes.Begin(); !mRebuild && iter != endIter; ++iter )
+  {
+    mRebuild = !AddConnectedNode( **iter );
+  }
+  mConnectedNodes.Clear();
+
+  if( mRebuild )
+  {
+    mEntries.Clear();
+    AddSubtree( mRoot, 0u );
+    mGapSize = 0u;
+    mRebuild = false;
+  }
+}
+
+bool FlattenedNodeTree::FindNode( const Node& node, uint32_t& index ) const
+{
+  index = node.GetFlattenedTreeIndex();
+  return ( index < mEntries.Count() ) && ( mEntries[index].node == &node );
+}
+
+void FlattenedNodeTree::AddSubtree( Node& node, uint32_t depth )
+{
+  const uint32_t index = mEntries.Count();
+  node.SetFlattenedTreeIndex( index );
+  mEntries.PushBack( { &node, 1u, depth } );
+
+  NodeContainer& children = node.GetChildren();
+  const NodeIter endIter = children.End();
+  for( NodeIter iter = children.Begin(); iter != endIter; ++iter )
+  {
+    AddSubtree( **iter, depth + 1u );
+  }
+
+  mEntries[index].subtreeSize = mEntries.Count() - index;
+}
+
+bool FlattenedNodeTree::AddConnectedNode( Node& node )
+{
+  // The node was added with the subtree of an ancestor, or has been disconnected from the tree since
+  Node* parent = node.GetParent();
+  uint32_t index = 0u;
+  uint32_t parentIndex = 0u;
+  if( FindNode( node, index ) || !parent || !FindNode( *parent, parentIndex ) )
+  {
+    return true;
+  }
+
+  const uint32_t depth = mEntries[parentIndex].depth + 1u;
+  const uint32_t parentEnd = parentIndex + mEntries[parentIndex].subtreeSize;
+  if( parentEnd == mEntries.Count() )
+  {
+    AddSubtree( node, depth );
+
+    // The subtrees of all the ancestors end at the new entries
+    const uint32_t subtreeSize = mEntries[ node.GetFlattenedTreeIndex() ].subtreeSize;
+    for( Node* ancestor = parent; ancestor; ancestor = ancestor->GetParent() )
+    {
+      mEntries[ ancestor->GetFlattenedTreeIndex() ].subtreeSize += subtreeSize;
+    }
+    return true;
+  }
+
+  // The node is the last child of its parent, so it can only be written into the gaps after the other children
+  uint32_t gapStart = parentEnd;
+  for( uint32_t i = parentIndex + 1u; i < parentEnd; i += mEntries[i].subtreeSize )
+  {
+    if( mEntries[i].node )
+    {
+      gapStart = parentEnd;
+    }
+    else if( gapStart == parentEnd )
+    {
+      gapStart = i;
+    }
+  }
+
+  const uint32_t subtreeEnd = gapStart + CountSubtree( node );
+  if( subtreeEnd > parentEnd )
+  {
+    return false;
+  }
+
+  SetSubtree( node, depth, gapStart );
+  if( subtreeEnd < parentEnd )
+  {
+    mEntries[subtreeEnd] = { nullptr, parentEnd - subtreeEnd, depth };
+  }
+  mGapSize -= subtreeEnd - gapStart;
+  return true;
+}
+
+uint32_t FlattenedNodeTree::SetSubtree( Node& node, uint32_t depth, uint32_t index )
+{
+  node.SetFlattenedTreeIndex( index );
+
+  uint32_t next = index + 1u;
+  NodeContainer& children = node.GetChildren();
+  const NodeIter endIter = children.End();
+  for( NodeIter iter = children.Begin(); iter != endIter; ++iter )
+  {
+    next = SetSubtree( **iter, depth + 1u, next );
+  }
+
+  mEntries[index] = { &node, next - index, depth };
+  return next;
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
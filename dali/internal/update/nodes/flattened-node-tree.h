@@ -0,0 +1,158 @@
+#ifndef DALI_INTERNAL_SCENE_GRAPH_FLATTENED_NODE_TREE_H
+#define DALI_INTERNAL_SCENE_GRAPH_FLATTENED_NODE_TREE_H
+
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+class Node;
+
+/**
+ * The nodes of a scene-graph in depth first order, so the scene-graph can be traversed iteratively.
+ * Each entry stores the size of the subtree of its node, so a subtree can be skipped by jumping over its entries.
+ *
+ * Disconnecting a node leaves a gap in place of its subtree. Connected nodes are queued, and added in the
+ * next Update() with the subtrees they have by then: a subtree is appended if its parent's subtree is at the
+ * end of the entries, or written into a gap left by the last children of its parent. Any other change is
+ * applied by rebuilding the entries once.
+ */
+class FlattenedNodeTree
+{
+public:
+
+  /**
+   * An entry of the tree
+   */
+  struct Entry
+  {
+    Node* node;           ///< The node, or nullptr if the node was disconnected
+    uint32_t subtreeSize; ///< The number of entries of the subtree of the node, including its own
+    uint32_t depth;       ///< The number of ancestors of the node
+  };
+
+  /**
+   * Constructor
+   * @param[in] root The root of the scene-graph
+   */
+  FlattenedNodeTree( Node& root );
+
+  /**
+   * Non-virtual destructor
+   */
+  ~FlattenedNodeTree();
+
+  /**
+   * Informs the tree that a node has been connected to its parent
+   * @param[in] node The node, which has no children yet
+   */
+  void NodeConnected( Node& node );
+
+  /**
+   * Informs the tree that a node is about to be disconnected from its parent
+   * @param[in] node The node, still connected to its parent
+   */
+  void NodeDisconnected( Node& node );
+
+  /**
+   * Adds the connected nodes, or rebuilds the entries if the hierarchy changed in a way which can't be applied incrementally
+   */
+  void Update();
+
+  /**
+   * Retrieves the index of the entry of a node
+   * @param[in] node The node
+   * @param[out] index The index of the entry of the node
+   * @return true if the node is in the tree, false otherwise
+   * @pre The tree is up to date
+   */
+  bool FindNode( const Node& node, uint32_t& index ) const;
+
+  /**
+   * @return The number of entries
+   */
+  uint32_t Count() const
+  {
+    return mEntries.Count();
+  }
+
+  /**
+   * @param[in] index The index of an entry
+   * @return The entry
+   */
+  const Entry& operator[]( uint32_t index ) const
+  {
+    return mEntries[index];
+  }
+
+private:
+
+  /**
+   * Adds the entries of a subtree
+   * @param[in] node The root of the subtree
+   * @param[in] depth The depth of the node
+   */
+  void AddSubtree( Node& node, uint32_t depth );
+
+  /**
+   * Adds the entries of the subtree of a connected node, unless the node is already in the tree
+   * @param[in] node The connected node
+   * @return false if the subtree can't be added without rebuilding the entries
+   */
+  bool AddConnectedNode( Node& node );
+
+  /**
+   * Overwrites entries with the entries of a subtree
+   * @param[in] node The root of the subtree
+   * @param[in] depth The depth of the node
+   * @param[in] index The index of the first entry to overwrite
+   * @return The index after the last entry of the subtree
+   */
+  uint32_t SetSubtree( Node& node, uint32_t depth, uint32_t index );
+
+  // Undefined
+  FlattenedNodeTree( const FlattenedNodeTree& );
+
+  // Undefined
+  FlattenedNodeTree& operator=( const FlattenedNodeTree& );
+
+private:
+
+  Dali::Vector< Entry > mEntries;        ///< The entries in depth first order
+  Dali::Vector< Node* > mConnectedNodes; ///< The nodes connected since the last Update(), in the order they were connected
+  Node& mRoot;                           ///< The root of the scene-graph
+  uint32_t mGapSize;                     ///< The number of entries of the disconnected nodes
+  bool mRebuild;                         ///< Whether the entries have to be rebuilt in the next Update()
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SCENE_GRAPH_FLATTENED_NODE_TREE_H
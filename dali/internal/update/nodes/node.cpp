@@ -78,6 +78,16 @@ void Node::Delete( Node* node )
   }
 }
 
+uint32_t Node::TrimMemoryPool()
+{
+  return gNodeMemoryPool.TrimThreadSafe();
+}
+
+FixedSizeMemoryPool::Statistics Node::GetMemoryPoolStatistics()
+{
+  return gNodeMemoryPool.GetStatistics();
+}
+
 Node::Node()
 : mTransformManager( NULL ),
   mTransformId( INVALID_TRANSFORM_ID ),
@@ -103,6 +113,7 @@ Node::Node()
   mClippingDepth( 0u ),
   mScissorDepth( 0u ),
   mDepthIndex( 0u ),
+  mFlattenedTreeIndex( 0u ),
   mDirtyFlags( NodePropertyFlags::ALL ),
   mRegenerateUniformMap( 0 ),
   mDrawMode( DrawMode::NORMAL ),
@@ -217,6 +228,10 @@ void Node::PrepareRender( BufferIndex bufferIndex )
     --mRegenerateUniformMap;
     mUniformMapChanged[bufferIndex] = 1u;
   }
+  else
+  {
+    mUniformMapChanged[bufferIndex] = 0u;
+  }
 }
 
 void Node::ConnectChild( Node* childNode )
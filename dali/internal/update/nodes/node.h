@@ -25,6 +25,7 @@
 #include <dali/public-api/math/math-utils.h>
 #include <dali/public-api/math/vector3.h>
 #include <dali/integration-api/debug.h>
+#include <dali/internal/common/fixed-size-memory-pool.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/render/data-providers/node-data-provider.h>
@@ -86,6 +87,18 @@ public:
    */
   static void Delete( Node* node );
 
+  /**
+   * Releases the blocks of the global memory pool in which no nodes are allocated.
+   * @return The number of blocks released
+   */
+  static uint32_t TrimMemoryPool();
+
+  /**
+   * Retrieves the usage of the memory of the global memory pool of nodes.
+   * @return The statistics of the memory pool
+   */
+  static FixedSizeMemoryPool::Statistics GetMemoryPoolStatistics();
+
   /**
    * Called during UpdateManager::DestroyNode shortly before Node is destroyed.
    */
@@ -650,6 +663,16 @@ public:
            (mTransformManager->IsLocalMatrixDirty( mTransformId ));
   }
 
+  /**
+   * Checks if world matrix has changed since last update
+   * @return true if world matrix has changed, false otherwise
+   */
+  bool IsWorldMatrixDirty() const
+  {
+    return (mTransformId != INVALID_TRANSFORM_ID) &&
+           (mTransformManager->IsWorldMatrixDirty( mTransformId ));
+  }
+
   /**
    * Retrieve the cached world-matrix of a node.
    * @param[in] bufferIndex The buffer to read from.
@@ -732,6 +755,24 @@ public:
     return mDepthIndex;
   }
 
+  /**
+   * @brief Sets the index of the entry of the node in the FlattenedNodeTree of its scene-graph
+   * @param[in] index The index of the entry
+   */
+  void SetFlattenedTreeIndex( uint32_t index )
+  {
+    mFlattenedTreeIndex = index;
+  }
+
+  /**
+   * @brief Get the index of the entry of the node in the FlattenedNodeTree of its scene-graph
+   * @return The index of the entry, which is only valid while the node is connected
+   */
+  uint32_t GetFlattenedTreeIndex() const
+  {
+    return mFlattenedTreeIndex;
+  }
+
   /**
    * @brief Sets the boolean which states whether the position should use the anchor-point.
    * @param[in] positionUsesAnchorPoint True if the position should use the anchor-point
@@ -910,6 +951,7 @@ protected:
   uint32_t                           mScissorDepth;           ///< The number of scissor clipping nodes deep this node is
 
   uint32_t                           mDepthIndex;             ///< Depth index of the node
+  uint32_t                           mFlattenedTreeIndex;     ///< Index of the node in the FlattenedNodeTree of its scene-graph
 
   // flags, compressed to bitfield
   NodePropertyFlags                  mDirtyFlags;             ///< Dirty flags for each of the Node properties
@@ -21,6 +21,7 @@
 // INTERNAL INCLUDES
 #include <dali/public-api/actors/layer.h>
 #include <dali/internal/event/common/event-thread-services.h>
+#include <dali/internal/update/nodes/bounding-volume-hierarchy.h>
 #include <dali/internal/update/nodes/node.h>
 
 namespace Dali
@@ -193,6 +194,18 @@ public:
     return bReturn;
   }
 
+  /**
+   * Checks if it is ok to patch the renderers of the previous use in place. Renderers can be patched if the
+   * ModelView transform of the renderers which have not moved is the same as in the previous use.
+   * @param[in] camera A pointer to the camera that we want to use to render the list.
+   * @return True if the camera we are going to use is the same as the one used before
+   * @note Must be called before CanReuseRenderers(), which records the camera.
+   */
+  bool CanPatchRenderers( Camera* camera ) const
+  {
+    return camera == mLastCamera;
+  }
+
   /**
    * @return True if default sort function is used
    */
@@ -225,6 +238,9 @@ public: // For update-algorithms
   RenderableContainer colorRenderables;
   RenderableContainer overlayRenderables;
 
+  BoundingVolumeHierarchy colorBoundingVolumes;   ///< Used to cull the color renderables of large layers
+  BoundingVolumeHierarchy overlayBoundingVolumes; ///< Used to cull the overlay renderables of large layers
+
 private:
 
   SortFunctionType mSortFunction;     ///< Used to sort semi-transparent geometry
@@ -289,7 +289,7 @@ const PropertyInputImpl* Camera::GetViewMatrix() const
 void Camera::Update( BufferIndex updateBufferIndex )
 {
   // if owning node has changes in world position we need to update camera for next 2 frames
-  if( mNode->IsLocalMatrixDirty() )
+  if( mNode->IsWorldMatrixDirty() )
   {
     mUpdateViewFlag = UPDATE_COUNT;
   }
@@ -330,6 +330,11 @@ bool Camera::ViewMatrixUpdated()
   return 0u != mUpdateViewFlag;
 }
 
+bool Camera::ProjectionMatrixUpdated()
+{
+  return 0u != mUpdateProjectionFlag;
+}
+
 uint32_t Camera::UpdateViewMatrix( BufferIndex updateBufferIndex )
 {
   uint32_t retval( mUpdateViewFlag );
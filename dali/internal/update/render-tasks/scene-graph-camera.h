@@ -188,6 +188,18 @@ public:
    */
   bool CheckAABBInFrustum( BufferIndex bufferIndex, const Vector3& origin, const Vector3& halfExtents );
 
+  /**
+   * @brief Retrieve the planes of the view frustum.
+   *
+   * @param bufferIndex The buffer to read from.
+   *
+   * @return The planes of the frustum, with normals pointing inside.
+   */
+  const FrustumPlanes& GetFrustumPlanes( BufferIndex bufferIndex ) const
+  {
+    return mFrustum[ bufferIndex ];
+  }
+
   /**
    * Retrieve the projection-matrix; this is double buffered for input handling.
    * @param[in] bufferIndex The buffer to read from.
@@ -228,6 +240,11 @@ public:
    */
   bool ViewMatrixUpdated();
 
+  /**
+   * @return true if the projection matrix of camera is updated this or the previous frame
+   */
+  bool ProjectionMatrixUpdated();
+
 private:
 
   /**
@@ -58,6 +58,16 @@ void RenderTaskList::operator delete( void* ptr )
   gRenderTaskListMemoryPool.FreeThreadSafe( static_cast<RenderTaskList*>( ptr ) );
 }
 
+uint32_t RenderTaskList::TrimMemoryPool()
+{
+  return gRenderTaskListMemoryPool.TrimThreadSafe();
+}
+
+FixedSizeMemoryPool::Statistics RenderTaskList::GetMemoryPoolStatistics()
+{
+  return gRenderTaskListMemoryPool.GetStatistics();
+}
+
 void RenderTaskList::SetRenderMessageDispatcher( RenderMessageDispatcher* renderMessageDispatcher )
 {
   mRenderMessageDispatcher = renderMessageDispatcher;
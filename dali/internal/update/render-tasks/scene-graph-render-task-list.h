@@ -20,6 +20,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/common/owner-container.h>
+#include <dali/internal/common/fixed-size-memory-pool.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/update/render-tasks/scene-graph-render-task.h>
@@ -63,6 +64,18 @@ public:
    */
   void operator delete( void* ptr );
 
+  /**
+   * Releases the blocks of the global memory pool in which no render task lists are allocated.
+   * @return The number of blocks released
+   */
+  static uint32_t TrimMemoryPool();
+
+  /**
+   * Retrieves the usage of the memory of the global memory pool of render task lists.
+   * @return The statistics of the memory pool
+   */
+  static FixedSizeMemoryPool::Statistics GetMemoryPoolStatistics();
+
   /**
    * Set the renderMessageDispatcher to send message.
    * @param[in] renderMessageDispatcher The renderMessageDispatcher to send messages.
@@ -403,6 +403,16 @@ bool RenderTask::ViewMatrixUpdated()
   return retval;
 }
 
+bool RenderTask::ProjectionMatrixUpdated()
+{
+  bool retval = false;
+  if( mCamera )
+  {
+    retval = mCamera->ProjectionMatrixUpdated();
+  }
+  return retval;
+}
+
 void RenderTask::SetViewportPosition( BufferIndex updateBufferIndex, const Vector2& value )
 {
   mViewportPosition.Set( updateBufferIndex, value );
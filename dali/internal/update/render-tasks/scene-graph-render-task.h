@@ -320,6 +320,11 @@ public:
    */
   bool ViewMatrixUpdated();
 
+  /**
+   * @return true if the projection matrix has been updated during this or last frame
+   */
+  bool ProjectionMatrixUpdated();
+
   /**
    * Indicate whether GL sync is required for native render target.
    * @param[in] requiresSync whether GL sync is required for native render target
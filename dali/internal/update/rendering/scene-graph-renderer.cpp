@@ -173,6 +173,16 @@ void Renderer::operator delete( void* ptr )
   gRendererMemoryPool.FreeThreadSafe( static_cast<Renderer*>( ptr ) );
 }
 
+uint32_t Renderer::TrimMemoryPool()
+{
+  return gRendererMemoryPool.TrimThreadSafe();
+}
+
+FixedSizeMemoryPool::Statistics Renderer::GetMemoryPoolStatistics()
+{
+  return gRendererMemoryPool.GetStatistics();
+}
+
 
 void Renderer::PrepareRender( BufferIndex updateBufferIndex )
 {
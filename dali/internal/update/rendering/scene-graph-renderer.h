@@ -21,6 +21,7 @@
 #include <dali/public-api/rendering/renderer.h> // Dali::Renderer
 #include <dali/devel-api/rendering/renderer-devel.h>
 #include <dali/internal/common/blending-options.h>
+#include <dali/internal/common/fixed-size-memory-pool.h>
 #include <dali/internal/common/type-abstraction-enums.h>
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/update/common/property-owner.h>
@@ -84,6 +85,18 @@ public:
    */
   void operator delete( void* ptr );
 
+  /**
+   * Releases the blocks of the global memory pool in which no renderers are allocated.
+   * @return The number of blocks released
+   */
+  static uint32_t TrimMemoryPool();
+
+  /**
+   * Retrieves the usage of the memory of the global memory pool of renderers.
+   * @return The statistics of the memory pool
+   */
+  static FixedSizeMemoryPool::Statistics GetMemoryPoolStatistics();
+
   /**
    * Set the texture set for the renderer
    * @param[in] textureSet The texture set this renderer will use
@@ -62,6 +62,16 @@ void TextureSet::operator delete( void* ptr )
   gTextureSetMemoryPool.FreeThreadSafe( static_cast<TextureSet*>( ptr ) );
 }
 
+uint32_t TextureSet::TrimMemoryPool()
+{
+  return gTextureSetMemoryPool.TrimThreadSafe();
+}
+
+FixedSizeMemoryPool::Statistics TextureSet::GetMemoryPoolStatistics()
+{
+  return gTextureSetMemoryPool.GetStatistics();
+}
+
 void TextureSet::SetSampler( uint32_t index, Render::Sampler* sampler )
 {
   const uint32_t samplerCount = static_cast<uint32_t>( mSamplers.Size() );
@@ -20,6 +20,7 @@
 // INTERNAL INCLUDES
 #include <dali/public-api/rendering/texture-set.h>
 #include <dali/internal/common/buffer-index.h>
+#include <dali/internal/common/fixed-size-memory-pool.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/event/common/event-thread-services.h>
 
@@ -57,6 +58,18 @@ public:
    */
   void operator delete( void* ptr );
 
+  /**
+   * Releases the blocks of the global memory pool in which no texture sets are allocated.
+   * @return The number of blocks released
+   */
+  static uint32_t TrimMemoryPool();
+
+  /**
+   * Retrieves the usage of the memory of the global memory pool of texture sets.
+   * @return The statistics of the memory pool
+   */
+  static FixedSizeMemoryPool::Statistics GetMemoryPoolStatistics();
+
   /**
    * Set the sampler to be used by the texture at position "index"
    * @param[in] index The index of the texture